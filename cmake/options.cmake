@@ -17,6 +17,9 @@ cmake_print_variables(TC_ENABLE_BENCHMARKS)
 option(TC_ENABLE_EXAMPLES "Enable Examples" True)
 cmake_print_variables(TC_ENABLE_EXAMPLES)
 
+option(TC_ENABLE_NATIVE_ARCH "Enable instruction sets of the host CPU (AVX2, FMA, ...)" False)
+cmake_print_variables(TC_ENABLE_NATIVE_ARCH)
+
 option(TC_ENABLE_WARNINGS_ERROR "Enable treat Warnings as Errors" True)
 cmake_print_variables(TC_ENABLE_WARNINGS_ERROR)
 
@@ -57,6 +57,7 @@ class TeiaCareImage(ConanFile):
         tc.variables["TC_ENABLE_UNIT_TESTS_COVERAGE"] = False
         tc.variables["TC_ENABLE_BENCHMARKS"] = False
         tc.variables["TC_ENABLE_EXAMPLES"] = False
+        tc.variables["TC_ENABLE_NATIVE_ARCH"] = False
         tc.variables["TC_ENABLE_WARNINGS_ERROR"] = True
         tc.variables["TC_ENABLE_SANITIZER_ADDRESS"] = False
         tc.variables["TC_ENABLE_SANITIZER_THREAD"] = False
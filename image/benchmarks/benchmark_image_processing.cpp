@@ -0,0 +1,421 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <teiacare/image/basic_image.hpp>
+#include <teiacare/image/image_border.hpp>
+#include <teiacare/image/image_convert.hpp>
+#include <teiacare/image/image_draw.hpp>
+#include <teiacare/image/image_filter.hpp>
+#include <teiacare/image/image_processing.hpp>
+#include <teiacare/image/image_resize.hpp>
+#include <teiacare/image/image_stats.hpp>
+#include <teiacare/image/image_view.hpp>
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+// Reference implementation of create_blob before the single pass kernel: one strided pass per channel
+template <typename T>
+void create_blob_per_channel(const std::vector<std::uint8_t>& image, int width, int height, int channels, std::vector<T>& blob, T scale_factor, const std::vector<T>& mean, bool swapRB_channels)
+{
+    for (int c = 0; c < channels; ++c)
+    {
+        const int channel_offset = (swapRB_channels ? (2 - c) : c);
+        for (int y = 0; y < height; ++y)
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                const int idx_offset = y * width + x;
+                blob[c * height * width + idx_offset] = static_cast<T>(image[idx_offset * channels + channel_offset]) * scale_factor - mean[c];
+            }
+        }
+    }
+}
+
+// Reference mask overlay: per pixel class lookup and floating point blend
+void overlay_mask_scalar(std::vector<std::uint8_t>& image, int width, int height, const std::vector<std::uint8_t>& mask, int mask_width, int mask_height, const std::vector<tc::img::color>& palette, float alpha)
+{
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            const std::uint8_t k = mask[(y * mask_height / height) * mask_width + x * mask_width / width];
+            if (k >= palette.size())
+                continue;
+
+            const std::uint8_t color[3] = {palette[k].r, palette[k].g, palette[k].b};
+            for (int c = 0; c < 3; ++c)
+            {
+                std::uint8_t& value = image[(y * width + x) * 3 + c];
+                value = static_cast<std::uint8_t>(std::lround(value * (1.0f - alpha) + color[c] * alpha));
+            }
+        }
+    }
+}
+
+std::vector<std::uint8_t> create_test_image(int width, int height, int channels)
+{
+    std::vector<std::uint8_t> image(static_cast<std::size_t>(width) * height * channels);
+    for (std::size_t i = 0; i < image.size(); ++i)
+        image[i] = static_cast<std::uint8_t>(i * 31 % 251);
+    return image;
+}
+
+const std::vector<float> imagenet_mean = {0.485f, 0.456f, 0.406f};
+const std::vector<float> imagenet_std = {0.229f, 0.224f, 0.225f};
+
+void BM_create_blob_per_channel(benchmark::State& state)
+{
+    const int width = static_cast<int>(state.range(0));
+    const int height = static_cast<int>(state.range(1));
+    const auto image = create_test_image(width, height, 3);
+    std::vector<float> blob(image.size());
+    for (auto _ : state)
+    {
+        create_blob_per_channel(image, width, height, 3, blob, 1.0f / 255.0f, imagenet_mean, true);
+        benchmark::DoNotOptimize(blob.data());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(image.size()));
+}
+
+void BM_create_blob(benchmark::State& state)
+{
+    const int width = static_cast<int>(state.range(0));
+    const int height = static_cast<int>(state.range(1));
+    const auto image = create_test_image(width, height, 3);
+    std::vector<float> blob;
+    for (auto _ : state)
+    {
+        tc::img::create_blob(image, width, height, 3, blob, 1.0f / 255.0f, imagenet_mean, true);
+        benchmark::DoNotOptimize(blob.data());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(image.size()));
+}
+
+void BM_create_blob_std(benchmark::State& state)
+{
+    const int width = static_cast<int>(state.range(0));
+    const int height = static_cast<int>(state.range(1));
+    const int channels = static_cast<int>(state.range(2));
+    const auto image = create_test_image(width, height, channels);
+    std::vector<float> blob;
+    for (auto _ : state)
+    {
+        tc::img::create_blob(image, width, height, channels, blob, 1.0f / 255.0f, imagenet_mean, false, imagenet_std);
+        benchmark::DoNotOptimize(blob.data());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(image.size()));
+}
+
+void BM_create_blob_nhwc(benchmark::State& state)
+{
+    const auto image = create_test_image(640, 640, 3);
+    const bool swap = state.range(0) != 0;
+    std::vector<float> blob;
+    for (auto _ : state)
+    {
+        tc::img::create_blob(image, 640, 640, 3, blob, 1.0f / 255.0f, imagenet_mean, swap, imagenet_std, tc::img::blob_layout::nhwc);
+        benchmark::DoNotOptimize(blob.data());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(image.size()));
+}
+
+template <typename T>
+void BM_create_blob_half(benchmark::State& state)
+{
+    const int width = static_cast<int>(state.range(0));
+    const int height = static_cast<int>(state.range(1));
+    const auto image = create_test_image(width, height, 3);
+    std::vector<T> blob;
+    for (auto _ : state)
+    {
+        tc::img::create_blob(image, width, height, 3, blob, 1.0f / 255.0f, imagenet_mean, true, imagenet_std);
+        benchmark::DoNotOptimize(blob.data());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(image.size()));
+}
+
+void BM_create_quantized_blob(benchmark::State& state)
+{
+    const int width = static_cast<int>(state.range(0));
+    const int height = static_cast<int>(state.range(1));
+    const auto image = create_test_image(width, height, 3);
+    std::vector<std::int8_t> blob;
+    for (auto _ : state)
+    {
+        tc::img::create_quantized_blob(image, width, height, 3, blob, {0.0186f}, {-14}, 1.0f / 255.0f, imagenet_mean, true, imagenet_std);
+        benchmark::DoNotOptimize(blob.data());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(image.size()));
+}
+
+void BM_blob_to_image(benchmark::State& state)
+{
+    const int width = static_cast<int>(state.range(0));
+    const int height = static_cast<int>(state.range(1));
+    const int channels = static_cast<int>(state.range(2));
+    const bool swap = channels >= 3;
+    const auto blob = tc::img::create_blob(create_test_image(width, height, channels), width, height, channels, 1.0f / 255.0f, imagenet_mean, swap, imagenet_std);
+    std::vector<std::uint8_t> image;
+    for (auto _ : state)
+    {
+        tc::img::blob_to_image(blob, width, height, channels, image, 1.0f / 255.0f, imagenet_mean, swap, imagenet_std);
+        benchmark::DoNotOptimize(image.data());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(image.size()));
+}
+
+template <bool Scalar>
+void BM_overlay_mask(benchmark::State& state)
+{
+    // 1080p frame with a 4x lower resolution mask of 21 classes, as returned by segmentation models
+    auto image = create_test_image(1920, 1080, 3);
+    auto mask = create_test_image(480, 270, 1);
+    for (auto& k : mask)
+        k %= 21;
+    std::vector<tc::img::color> palette;
+    for (int k = 0; k < 21; ++k)
+        palette.emplace_back(static_cast<std::uint8_t>(k * 12), static_cast<std::uint8_t>(255 - k * 12), static_cast<std::uint8_t>(k * 50));
+
+    for (auto _ : state)
+    {
+        if constexpr (Scalar)
+            overlay_mask_scalar(image, 1920, 1080, mask, 480, 270, palette, 0.5f);
+        else
+            tc::img::overlay_mask(image, 1920, 1080, 3, mask, 480, 270, palette, 0.5f);
+        benchmark::DoNotOptimize(image.data());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(image.size()));
+}
+
+void BM_letterbox_then_create_blob(benchmark::State& state)
+{
+    const auto image = create_test_image(1920, 1080, 3);
+    std::vector<std::uint8_t> resized;
+    std::vector<float> blob;
+    for (auto _ : state)
+    {
+        tc::img::image_resize_aspect_ratio(image, 1920, 1080, 3, 640, 640, resized, {114});
+        tc::img::create_blob(resized, 640, 640, 3, blob, 1.0f / 255.0f, imagenet_mean, true, imagenet_std);
+        benchmark::DoNotOptimize(blob.data());
+    }
+}
+
+void BM_letterbox_blob(benchmark::State& state)
+{
+    const auto image = create_test_image(1920, 1080, 3);
+    std::vector<float> blob;
+    for (auto _ : state)
+    {
+        tc::img::letterbox_blob(image, 1920, 1080, 3, 640, 640, blob, 1.0f / 255.0f, imagenet_mean, true, imagenet_std, {114});
+        benchmark::DoNotOptimize(blob.data());
+    }
+}
+
+void BM_convert(benchmark::State& state)
+{
+    const auto src_format = static_cast<tc::img::pixel_format>(state.range(0));
+    const auto dst_format = static_cast<tc::img::pixel_format>(state.range(1));
+    const auto src = create_test_image(1920, 1080, tc::img::pixel_format_channels(src_format));
+    std::vector<std::uint8_t> dst;
+    for (auto _ : state)
+    {
+        tc::img::convert(src, src_format, dst, dst_format);
+        benchmark::DoNotOptimize(dst.data());
+    }
+}
+
+// Reference statistics: one pass per channel accumulating every statistic separately
+std::vector<tc::img::channel_stats> image_stats_scalar(const std::vector<std::uint8_t>& image, int channels)
+{
+    std::vector<tc::img::channel_stats> stats(channels);
+    for (int c = 0; c < channels; ++c)
+    {
+        auto& s = stats[c];
+        s.min = 255;
+        for (std::size_t i = c; i < image.size(); i += channels)
+        {
+            const std::uint8_t v = image[i];
+            ++s.count;
+            s.sum += v;
+            s.sum_squares += static_cast<std::uint64_t>(v) * v;
+            s.min = std::min(s.min, v);
+            s.max = std::max(s.max, v);
+            ++s.histogram[v];
+        }
+    }
+    return stats;
+}
+
+template <bool Scalar>
+void BM_image_stats(benchmark::State& state)
+{
+    const int channels = static_cast<int>(state.range(0));
+    const auto image = create_test_image(1920, 1080, channels);
+    for (auto _ : state)
+    {
+        auto stats = Scalar ? image_stats_scalar(image, channels) : tc::img::image_stats(image, channels);
+        benchmark::DoNotOptimize(stats.data());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(image.size()));
+}
+
+void BM_copy_make_border(benchmark::State& state)
+{
+    const auto border = static_cast<tc::img::border_mode>(state.range(0));
+    const auto image = create_test_image(1920, 1080, 3);
+    std::vector<std::uint8_t> padded;
+    for (auto _ : state)
+    {
+        tc::img::copy_make_border(image, 1920, 1080, 3, 32, 32, 32, 32, padded, border, {114});
+        benchmark::DoNotOptimize(padded.data());
+    }
+}
+
+void BM_box_blur(benchmark::State& state)
+{
+    const int radius = static_cast<int>(state.range(0));
+    const auto image = create_test_image(1920, 1080, 3);
+    std::vector<std::uint8_t> blurred;
+    for (auto _ : state)
+    {
+        tc::img::box_blur(image, 1920, 1080, 3, radius, blurred);
+        benchmark::DoNotOptimize(blurred.data());
+    }
+}
+
+void BM_gaussian_blur(benchmark::State& state)
+{
+    const float sigma = static_cast<float>(state.range(0));
+    const auto image = create_test_image(1920, 1080, 3);
+    std::vector<std::uint8_t> blurred;
+    for (auto _ : state)
+    {
+        tc::img::gaussian_blur(image, 1920, 1080, 3, sigma, blurred);
+        benchmark::DoNotOptimize(blurred.data());
+    }
+}
+
+void BM_nv12_to_rgb(benchmark::State& state)
+{
+    const auto nv12 = create_test_image(1920, 1080 * 3 / 2, 1);
+    std::vector<std::uint8_t> rgb;
+    for (auto _ : state)
+    {
+        tc::img::nv12_to_rgb(nv12, 1920, 1080, rgb, tc::img::yuv_matrix::bt709);
+        benchmark::DoNotOptimize(rgb.data());
+    }
+}
+
+void BM_nv12_to_rgb_then_letterbox_blob(benchmark::State& state)
+{
+    const auto nv12 = create_test_image(1920, 1080 * 3 / 2, 1);
+    std::vector<std::uint8_t> rgb;
+    std::vector<float> blob;
+    for (auto _ : state)
+    {
+        tc::img::nv12_to_rgb(nv12, 1920, 1080, rgb, tc::img::yuv_matrix::bt709);
+        tc::img::letterbox_blob(rgb, 1920, 1080, 3, 640, 640, blob, 1.0f / 255.0f, imagenet_mean, false, imagenet_std, {114});
+        benchmark::DoNotOptimize(blob.data());
+    }
+}
+
+void BM_nv12_letterbox_blob(benchmark::State& state)
+{
+    const auto nv12 = create_test_image(1920, 1080 * 3 / 2, 1);
+    std::vector<float> blob;
+    for (auto _ : state)
+    {
+        tc::img::nv12_letterbox_blob(nv12, 1920, 1080, 640, 640, blob, 1.0f / 255.0f, imagenet_mean, false, imagenet_std, {114}, tc::img::yuv_matrix::bt709);
+        benchmark::DoNotOptimize(blob.data());
+    }
+}
+
+void BM_image_resize_aspect_ratio(benchmark::State& state)
+{
+    const int channels = static_cast<int>(state.range(0));
+    const auto image = create_test_image(1920, 1080, channels);
+    std::vector<std::uint8_t> resized;
+    for (auto _ : state)
+    {
+        tc::img::image_resize_aspect_ratio(image, 1920, 1080, channels, 1280, 1280, resized, {114});
+        benchmark::DoNotOptimize(resized.data());
+    }
+}
+
+void BM_draw_rectangle(benchmark::State& state)
+{
+    auto image = create_test_image(1920, 1080, 3);
+    const auto color = tc::img::color::green();
+    for (auto _ : state)
+    {
+        for (int i = 0; i < 64; ++i)
+            tc::img::draw_rectangle(image, 1920, 1080, 10 * i, 5 * i, 400, 300, color, 3);
+        benchmark::DoNotOptimize(image.data());
+    }
+}
+
+// Blob of a 1280x720 region of a 1080p frame, read through a strided view or first copied to a packed image
+template <bool CopyCrop>
+void BM_create_blob_crop(benchmark::State& state)
+{
+    const auto frame = create_test_image(1920, 1080, 3);
+    const tc::img::image_view crop = tc::img::image_view{frame, 1920, 1080, 3}.subview(320, 180, 1280, 720);
+    std::vector<float> blob;
+    for (auto _ : state)
+    {
+        if constexpr (CopyCrop)
+            tc::img::create_blob(tc::img::image{crop}, blob, 1.0f / 255.0f, imagenet_mean, true, imagenet_std);
+        else
+            tc::img::create_blob(crop, blob, 1.0f / 255.0f, imagenet_mean, true, imagenet_std);
+        benchmark::DoNotOptimize(blob.data());
+    }
+}
+
+}
+
+BENCHMARK(BM_create_blob_per_channel)->Args({224, 224})->Args({640, 640})->Args({1920, 1080});
+BENCHMARK(BM_create_blob)->Args({224, 224})->Args({640, 640})->Args({1920, 1080});
+BENCHMARK(BM_create_blob_std)->Args({640, 640, 1})->Args({640, 640, 3})->Args({640, 640, 4});
+BENCHMARK(BM_create_blob_nhwc)->Arg(0)->Arg(1);
+BENCHMARK(BM_create_blob_half<tc::img::float16>)->Args({640, 640})->Args({1920, 1080});
+BENCHMARK(BM_create_blob_half<tc::img::bfloat16>)->Args({640, 640})->Args({1920, 1080});
+BENCHMARK(BM_create_quantized_blob)->Args({640, 640})->Args({1920, 1080});
+BENCHMARK(BM_blob_to_image)->Args({640, 640, 1})->Args({640, 640, 3})->Args({640, 640, 4})->Args({1920, 1080, 3});
+BENCHMARK(BM_overlay_mask<true>);
+BENCHMARK(BM_overlay_mask<false>);
+BENCHMARK(BM_letterbox_then_create_blob);
+BENCHMARK(BM_letterbox_blob);
+BENCHMARK(BM_nv12_to_rgb);
+// Formats in tc::img::pixel_format order: gray, rgb, bgr, rgba, bgra
+BENCHMARK(BM_convert)->Args({1, 2})->Args({3, 4})->Args({1, 4})->Args({4, 1})->Args({1, 0})->Args({3, 0})->Args({0, 1})->Args({0, 3});
+BENCHMARK(BM_nv12_to_rgb_then_letterbox_blob);
+BENCHMARK(BM_nv12_letterbox_blob);
+// Border modes in tc::img::border_mode order: constant, replicate, reflect, wrap
+BENCHMARK(BM_copy_make_border)->Arg(0)->Arg(1)->Arg(2)->Arg(3);
+BENCHMARK(BM_box_blur)->Arg(1)->Arg(5)->Arg(25);
+BENCHMARK(BM_gaussian_blur)->Arg(1)->Arg(3);
+BENCHMARK(BM_image_stats<true>)->Arg(1)->Arg(3);
+BENCHMARK(BM_image_stats<false>)->Arg(1)->Arg(3);
+BENCHMARK(BM_create_blob_crop<true>);
+BENCHMARK(BM_create_blob_crop<false>);
+BENCHMARK(BM_image_resize_aspect_ratio)->Arg(1)->Arg(3)->Arg(4);
+BENCHMARK(BM_draw_rectangle);
+
+BENCHMARK_MAIN();
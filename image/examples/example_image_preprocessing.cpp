@@ -41,11 +41,17 @@ int main(int argc, char** argv)
     const bool swapRB_channels = false;
 
     const std::vector<std::uint8_t> resized_image = tc::img::image_resize_aspect_ratio(img_data, width, height, channels, target_width, target_height);
-    const std::vector<float> blob = tc::img::create_blob(resized_image, target_width, target_height, channels, scale_factor, mean, swapRB_channels);
+    const tc::img::tensor<float> blob = tc::img::create_blob(resized_image, target_width, target_height, channels, scale_factor, mean, swapRB_channels);
 
+    std::cout << "Blob shape: [" << blob.shape()[0] << ", " << blob.shape()[1] << ", " << blob.shape()[2] << "]" << std::endl;
     std::cout << "Blob size: " << blob.size() << std::endl;
     std::cout << "Img size: " << target_width * target_height * channels << std::endl;
     assert(blob.size() == target_width * target_height * channels);
 
+    // Same preprocessing fused in a single pass, without the intermediate resized image
+    const tc::img::tensor<float> fused_blob = tc::img::letterbox_blob(img_data, width, height, channels, target_width, target_height, scale_factor, mean, swapRB_channels);
+    std::cout << "Fused blob size: " << fused_blob.size() << std::endl;
+    assert(fused_blob == blob);
+
     return 0;
 }
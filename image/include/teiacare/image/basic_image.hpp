@@ -0,0 +1,395 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <teiacare/image/image_view.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace tc::img
+{
+/*!
+ * \brief Channel count of the images and kernels whose number of channels is only known at run time.
+ */
+inline constexpr int dynamic_channels = 0;
+
+/*!
+ * \brief Call a kernel with the channel count as a compile time constant for the common counts 1, 3 and 4.
+ * \param channels Number of channels known at run time
+ * \param f Callable taking a std::integral_constant<int, C>, C being 1, 3, 4 or dynamic_channels for any other count
+ * \return Result of f
+ *
+ * Runtime-typed entry points use it to run kernels instantiated for a fixed channel count, whose per pixel loops are fully unrolled.
+ */
+template <typename F>
+decltype(auto) visit_channels(int channels, F&& f)
+{
+    switch (channels)
+    {
+    case 1:
+        return std::forward<F>(f)(std::integral_constant<int, 1>{});
+    case 3:
+        return std::forward<F>(f)(std::integral_constant<int, 3>{});
+    case 4:
+        return std::forward<F>(f)(std::integral_constant<int, 4>{});
+    default:
+        return std::forward<F>(f)(std::integral_constant<int, dynamic_channels>{});
+    }
+}
+
+/*!
+ * \class basic_image
+ * \brief Owning, tightly packed interleaved image whose element type, and optionally channel count, are fixed at compile time.
+ * \tparam T Element type of each channel, trivially copyable
+ * \tparam Channels Number of interleaved channels, or dynamic_channels (default) when it is chosen at run time
+ *
+ * With a fixed channel count, pixel offsets are multiplications by a constant and loops over the channels of a pixel
+ * are fully unrolled by the compiler. 8-bit images convert implicitly to image_view and image_span,
+ * so they can be passed to every function taking a view.
+ */
+template <typename T, int Channels = dynamic_channels>
+class basic_image
+{
+    static_assert(std::is_trivially_copyable_v<T>, "image elements must be trivially copyable");
+    static_assert(Channels >= 0, "image channels must be positive or dynamic_channels");
+
+public:
+    using value_type = T;
+
+    /*!
+     * \brief Channel count fixed at compile time, or dynamic_channels.
+     */
+    static constexpr int static_channels = Channels;
+
+    /*!
+     * \brief Create an empty image.
+     */
+    basic_image() noexcept = default;
+
+    /*!
+     * \brief Create an image with every channel set to value.
+     * \param width Width of the image in pixels
+     * \param height Height of the image in pixels
+     * \param channels Number of interleaved channels of each pixel
+     * \param value Initial value of every channel, defaults to 0
+     * \throws std::runtime_error if the size is negative or channels is not positive
+     */
+    basic_image(int width, int height, int channels, T value = T{})
+        requires(Channels == dynamic_channels)
+        : _data(checked_size(width, height, channels), value)
+        , _width{width}
+        , _height{height}
+        , _channels{channels}
+    {
+    }
+
+    /*!
+     * \brief Create an image with the fixed channel count and every channel set to value.
+     * \param width Width of the image in pixels
+     * \param height Height of the image in pixels
+     * \param value Initial value of every channel, defaults to 0
+     * \throws std::runtime_error if the size is negative
+     */
+    basic_image(int width, int height, T value = T{})
+        requires(Channels != dynamic_channels)
+        : _data(checked_size(width, height, Channels), value)
+        , _width{width}
+        , _height{height}
+    {
+    }
+
+    /*!
+     * \brief Take ownership of a tightly packed image stored in a vector.
+     * \param data Vector holding width * height * channels elements
+     * \param width Width of the image in pixels
+     * \param height Height of the image in pixels
+     * \param channels Number of interleaved channels of each pixel, which must be Channels for images with a fixed channel count
+     * \throws std::runtime_error if the size or channel count are invalid or do not match the vector size
+     */
+    basic_image(std::vector<T> data, int width, int height, int channels)
+        : _data{std::move(data)}
+        , _width{width}
+        , _height{height}
+        , _channels{check_channels(channels)}
+    {
+        if (_data.size() != checked_size(width, height, channels))
+        {
+            throw std::runtime_error("Invalid image data: expected " + std::to_string(width) + "x" + std::to_string(height) + "x" + std::to_string(channels) + " values, got " + std::to_string(_data.size()));
+        }
+    }
+
+    /*!
+     * \brief Take ownership of a tightly packed image with the fixed channel count stored in a vector.
+     * \param data Vector holding width * height * Channels elements
+     * \param width Width of the image in pixels
+     * \param height Height of the image in pixels
+     * \throws std::runtime_error if the size is negative or does not match the vector size
+     */
+    basic_image(std::vector<T> data, int width, int height)
+        requires(Channels != dynamic_channels)
+        : basic_image{std::move(data), width, height, Channels}
+    {
+    }
+
+    /*!
+     * \brief Copy the pixels of a view into a new tightly packed image.
+     * \param view Image to copy, its rows possibly separated by padding bytes
+     * \throws std::runtime_error if the view channel count differs from a fixed channel count
+     */
+    explicit basic_image(image_view view)
+        requires std::is_same_v<T, std::uint8_t>
+        : _data(view.row_size() * view.height())
+        , _width{view.width()}
+        , _height{view.height()}
+        , _channels{check_channels(view.channels())}
+    {
+        if (view.is_contiguous())
+        {
+            if (!_data.empty())
+                std::memcpy(_data.data(), view.data(), _data.size());
+            return;
+        }
+
+        for (int y = 0; y < _height; ++y)
+            std::memcpy(_data.data() + y * view.row_size(), view.row(y), view.row_size());
+    }
+
+    /*!
+     * \brief Move the pixels of an image with another channel typing, such as a runtime-typed image into an RGB one.
+     * \param other Image to take the pixels of, left empty
+     * \throws std::runtime_error if the channel count of a non-empty image differs from a fixed channel count
+     */
+    template <int OtherChannels>
+        requires(OtherChannels != Channels)
+    explicit basic_image(basic_image<T, OtherChannels>&& other)
+        : _width{other.width()}
+        , _height{other.height()}
+        , _channels{other.empty() ? default_channels() : check_channels(other.channels())}
+    {
+        _data = other.release();
+    }
+
+    /*!
+     * \brief Change the size of the image, reusing its storage when it is large enough.
+     * \param width New width in pixels
+     * \param height New height in pixels
+     * \param channels New number of channels, which must be Channels for images with a fixed channel count
+     * \throws std::runtime_error if the size is negative or the channel count is invalid
+     *
+     * Pixel values are unspecified after a resize, as the layout of the existing values changes.
+     */
+    void resize(int width, int height, int channels)
+    {
+        _data.resize(checked_size(width, height, check_channels(channels)));
+        _width = width;
+        _height = height;
+        _channels = channels;
+    }
+
+    /*!
+     * \brief Change the size of an image with a fixed channel count, reusing its storage when it is large enough.
+     * \param width New width in pixels
+     * \param height New height in pixels
+     * \throws std::runtime_error if the size is negative
+     *
+     * Pixel values are unspecified after a resize, as the layout of the existing values changes.
+     */
+    void resize(int width, int height)
+        requires(Channels != dynamic_channels)
+    {
+        resize(width, height, Channels);
+    }
+
+    /*!
+     * \brief Move the pixels out as a tightly packed vector, leaving the image empty.
+     */
+    std::vector<T> release() noexcept
+    {
+        _width = 0;
+        _height = 0;
+        _channels = default_channels();
+        return std::exchange(_data, {});
+    }
+
+    T* data() noexcept
+    {
+        return _data.data();
+    }
+
+    const T* data() const noexcept
+    {
+        return _data.data();
+    }
+
+    /*!
+     * \brief Pixels as a tightly packed vector, for the functions taking (vector, width, height, channels) tuples.
+     */
+    const std::vector<T>& vector() const noexcept
+    {
+        return _data;
+    }
+
+    int width() const noexcept
+    {
+        return _width;
+    }
+
+    int height() const noexcept
+    {
+        return _height;
+    }
+
+    /*!
+     * \brief Number of channels, a compile time constant for images with a fixed channel count.
+     */
+    int channels() const noexcept
+    {
+        if constexpr (Channels == dynamic_channels)
+            return _channels;
+        else
+            return Channels;
+    }
+
+    /*!
+     * \brief Distance in elements between consecutive rows, always width * channels.
+     */
+    std::size_t stride() const noexcept
+    {
+        return static_cast<std::size_t>(_width) * channels();
+    }
+
+    /*!
+     * \brief Number of elements of the image, width * height * channels.
+     */
+    std::size_t size() const noexcept
+    {
+        return _data.size();
+    }
+
+    bool empty() const noexcept
+    {
+        return _data.empty();
+    }
+
+    T* row(int y) noexcept
+    {
+        return _data.data() + static_cast<std::size_t>(y) * stride();
+    }
+
+    const T* row(int y) const noexcept
+    {
+        return _data.data() + static_cast<std::size_t>(y) * stride();
+    }
+
+    /*!
+     * \brief Pointer to the first channel of pixel (x, y), with x in [0, width) and y in [0, height).
+     */
+    T* pixel(int x, int y) noexcept
+    {
+        return row(y) + static_cast<std::size_t>(x) * channels();
+    }
+
+    const T* pixel(int x, int y) const noexcept
+    {
+        return row(y) + static_cast<std::size_t>(x) * channels();
+    }
+
+    image_view view() const noexcept
+        requires std::is_same_v<T, std::uint8_t>
+    {
+        return image_view{_data.data(), _width, _height, channels()};
+    }
+
+    image_span span() noexcept
+        requires std::is_same_v<T, std::uint8_t>
+    {
+        return image_span{_data.data(), _width, _height, channels()};
+    }
+
+    operator image_view() const noexcept
+        requires std::is_same_v<T, std::uint8_t>
+    {
+        return view();
+    }
+
+    operator image_span() noexcept
+        requires std::is_same_v<T, std::uint8_t>
+    {
+        return span();
+    }
+
+    /*!
+     * \brief Images are equal when they have the same size, channel count and pixels.
+     */
+    friend bool operator==(const basic_image& lhs, const basic_image& rhs) = default;
+
+private:
+    static constexpr int default_channels() noexcept
+    {
+        return Channels == dynamic_channels ? 1 : Channels;
+    }
+
+    static int check_channels(int channels)
+    {
+        if (Channels != dynamic_channels && channels != Channels)
+        {
+            throw std::runtime_error("Invalid image channels: " + std::to_string(channels) + ", expected " + std::to_string(Channels));
+        }
+        return channels;
+    }
+
+    static std::size_t checked_size(int width, int height, int channels)
+    {
+        if (width < 0 || height < 0 || channels <= 0)
+        {
+            throw std::runtime_error("Invalid image size: " + std::to_string(width) + "x" + std::to_string(height) + "x" + std::to_string(channels));
+        }
+        return static_cast<std::size_t>(width) * height * channels;
+    }
+
+    std::vector<T> _data;
+    int _width = 0;
+    int _height = 0;
+    int _channels = default_channels();
+};
+
+/*!
+ * \brief 8-bit image whose channel count is chosen at run time.
+ */
+using image = basic_image<std::uint8_t>;
+
+/*!
+ * \brief Single channel 8-bit image.
+ */
+using image_gray = basic_image<std::uint8_t, 1>;
+
+/*!
+ * \brief 3-channel 8-bit image, such as RGB or BGR.
+ */
+using image_rgb = basic_image<std::uint8_t, 3>;
+
+/*!
+ * \brief 4-channel 8-bit image, such as RGBA or BGRA.
+ */
+using image_rgba = basic_image<std::uint8_t, 4>;
+
+}
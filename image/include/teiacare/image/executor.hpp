@@ -0,0 +1,59 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <functional>
+
+namespace tc::img
+{
+/*!
+ * \class executor
+ * \brief Interface used by batch operations to run the chunks of a parallel loop.
+ *
+ * Implement it to run library work on an existing thread pool (TBB, a task system, ...) instead of the default threads.
+ */
+class executor
+{
+public:
+    virtual ~executor() = default;
+
+    /*!
+     * \brief Split the range [0, count) in contiguous chunks and run task(begin, end) on each of them, returning when all the chunks are done.
+     * \param count Number of work items
+     * \param task Callable processing the work items in [begin, end), safe to call concurrently on disjoint ranges
+     * \param min_chunk_size Minimum number of work items worth assigning to a single thread
+     *
+     * Implementations must propagate the exceptions thrown by task to the caller.
+     */
+    virtual void parallel_for(int count, const std::function<void(int begin, int end)>& task, int min_chunk_size) = 0;
+};
+
+/*!
+ * \class sequential_executor
+ * \brief Executor running every task inline on the calling thread, for callers that already parallelize at a coarser level.
+ */
+class sequential_executor : public executor
+{
+public:
+    void parallel_for(int count, const std::function<void(int begin, int end)>& task, int min_chunk_size) override;
+};
+
+/*!
+ * \brief Get the executor used when none is supplied.
+ * \return Shared executor splitting work across up to std::thread::hardware_concurrency() short-lived threads
+ */
+executor& default_executor();
+
+}
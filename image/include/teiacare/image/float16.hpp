@@ -0,0 +1,175 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <type_traits>
+
+namespace tc::img
+{
+namespace detail
+{
+/*!
+ * \brief Convert a float to IEEE 754 binary16 bits, rounding to nearest even.
+ */
+inline std::uint16_t float_to_float16_bits(float value) noexcept
+{
+    std::uint32_t bits = std::bit_cast<std::uint32_t>(value);
+    const std::uint32_t sign = (bits >> 16) & 0x8000u;
+    bits &= 0x7FFFFFFFu;
+
+    // Values from 65520 round up to infinity, NaNs become quiet NaNs
+    if (bits >= 0x47800000u)
+        return static_cast<std::uint16_t>(sign | (bits > 0x7F800000u ? 0x7E00u : 0x7C00u));
+
+    // Below 2^-14 the result is subnormal: adding 0.5 lets the FPU round the value onto the 2^-24 grid
+    if (bits < 0x38800000u)
+        return static_cast<std::uint16_t>(sign | (std::bit_cast<std::uint32_t>(std::bit_cast<float>(bits) + 0.5f) - 0x3F000000u));
+
+    // Rebias the exponent and round the 13 dropped mantissa bits to nearest even
+    return static_cast<std::uint16_t>(sign | ((bits + 0xC8000FFFu + ((bits >> 13) & 1u)) >> 13));
+}
+
+/*!
+ * \brief Convert IEEE 754 binary16 bits to a float, exactly.
+ */
+inline float float16_bits_to_float(std::uint16_t value) noexcept
+{
+    const std::uint32_t sign = (static_cast<std::uint32_t>(value) & 0x8000u) << 16;
+    const std::uint32_t exponent = (value >> 10) & 0x1Fu;
+    const std::uint32_t mantissa = value & 0x3FFu;
+    if (exponent == 0x1Fu)
+        return std::bit_cast<float>(sign | 0x7F800000u | (mantissa << 13));
+    if (exponent == 0)
+    {
+        const float magnitude = static_cast<float>(mantissa) * 0x1p-24f;
+        return sign ? -magnitude : magnitude;
+    }
+    return std::bit_cast<float>(sign | ((exponent + 112) << 23) | (mantissa << 13));
+}
+
+/*!
+ * \brief Convert a float to bfloat16 bits, rounding to nearest even.
+ */
+inline std::uint16_t float_to_bfloat16_bits(float value) noexcept
+{
+    const std::uint32_t bits = std::bit_cast<std::uint32_t>(value);
+    if ((bits & 0x7FFFFFFFu) > 0x7F800000u)
+        return static_cast<std::uint16_t>((bits >> 16) | 0x0040u);
+    return static_cast<std::uint16_t>((bits + 0x7FFFu + ((bits >> 16) & 1u)) >> 16);
+}
+
+/*!
+ * \brief Convert bfloat16 bits to a float, exactly.
+ */
+inline float bfloat16_bits_to_float(std::uint16_t value) noexcept
+{
+    return std::bit_cast<float>(static_cast<std::uint32_t>(value) << 16);
+}
+}
+
+/*!
+ * \struct float16
+ * \brief IEEE 754 half precision value (1 sign, 5 exponent and 10 mantissa bits), stored as its raw bits.
+ *
+ * The layout matches _Float16 and the half types of inference runtimes, so blobs can be handed to them as-is.
+ */
+struct float16
+{
+    float16() = default;
+
+    /*!
+     * \brief Convert a float, rounding to nearest even.
+     */
+    explicit float16(float value) noexcept
+        : bits{detail::float_to_float16_bits(value)}
+    {
+    }
+
+    /*!
+     * \brief Create a value from its raw bits.
+     */
+    static constexpr float16 from_bits(std::uint16_t value) noexcept
+    {
+        float16 result;
+        result.bits = value;
+        return result;
+    }
+
+    /*!
+     * \brief Convert to float, exactly.
+     */
+    explicit operator float() const noexcept
+    {
+        return detail::float16_bits_to_float(bits);
+    }
+
+    friend constexpr bool operator==(float16, float16) noexcept = default;
+
+    std::uint16_t bits;
+};
+
+/*!
+ * \struct bfloat16
+ * \brief Brain floating point value (1 sign, 8 exponent and 7 mantissa bits), stored as its raw bits.
+ *
+ * It has the range of float with reduced precision, and converts to float by a plain shift.
+ */
+struct bfloat16
+{
+    bfloat16() = default;
+
+    /*!
+     * \brief Convert a float, rounding to nearest even.
+     */
+    explicit bfloat16(float value) noexcept
+        : bits{detail::float_to_bfloat16_bits(value)}
+    {
+    }
+
+    /*!
+     * \brief Create a value from its raw bits.
+     */
+    static constexpr bfloat16 from_bits(std::uint16_t value) noexcept
+    {
+        bfloat16 result;
+        result.bits = value;
+        return result;
+    }
+
+    /*!
+     * \brief Convert to float, exactly.
+     */
+    explicit operator float() const noexcept
+    {
+        return detail::bfloat16_bits_to_float(bits);
+    }
+
+    friend constexpr bool operator==(bfloat16, bfloat16) noexcept = default;
+
+    std::uint16_t bits;
+};
+
+static_assert(sizeof(float16) == 2 && std::is_trivially_copyable_v<float16>);
+static_assert(sizeof(bfloat16) == 2 && std::is_trivially_copyable_v<bfloat16>);
+
+/*!
+ * \brief Whether T is one of the 16-bit floating point types of the library.
+ */
+template <typename T>
+inline constexpr bool is_half_float_v = std::is_same_v<T, float16> || std::is_same_v<T, bfloat16>;
+
+}
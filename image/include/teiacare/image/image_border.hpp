@@ -0,0 +1,197 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace tc::img
+{
+/*!
+ * \enum border_mode
+ * \brief Strategy used to extrapolate pixels that fall outside the image.
+ *
+ * Examples refer to a row "abcdefgh" extended on both sides.
+ */
+enum class border_mode
+{
+    constant,  //!< Use a user provided value: iiiiii|abcdefgh|iiiiiii
+    replicate, //!< Repeat the edge pixel: aaaaaa|abcdefgh|hhhhhhh
+    reflect,   //!< Mirror around the edge pixel, without repeating it: gfedcb|abcdefgh|gfedcba
+    wrap       //!< Tile the image periodically: cdefgh|abcdefgh|abcdefg
+};
+
+/*!
+ * \class border_accessor
+ * \brief Read-only view of an image extended infinitely by a border mode, without materializing the padding.
+ *
+ * Pixels and rows at any coordinate, inside or outside the image, are read from the image or from the border value.
+ * The view does not copy the image data, which must outlive it.
+ */
+class border_accessor
+{
+public:
+    /*!
+     * \brief Create a view of an image extended by a border mode.
+     * \param image Input image data vector
+     * \param width Width of the input image in pixels
+     * \param height Height of the input image in pixels
+     * \param channels Number of color channels in the input image
+     * \param border Extrapolation method for pixels outside the image, defaults to border_mode::constant
+     * \param border_value Value used with border_mode::constant, either a single value for all channels or one value per channel, defaults to {0}
+     * \throws std::runtime_error if border_value has neither 1 nor channels components, or the image is empty and border is not border_mode::constant
+     */
+    border_accessor(
+        const std::vector<std::uint8_t>& image,
+        int width,
+        int height,
+        int channels,
+        border_mode border = border_mode::constant,
+        const std::vector<std::uint8_t>& border_value = {0});
+
+    /*!
+     * \brief Deleted overload for temporary images, which would be destroyed while the view still reads them.
+     */
+    border_accessor(
+        std::vector<std::uint8_t>&& image,
+        int width,
+        int height,
+        int channels,
+        border_mode border = border_mode::constant,
+        const std::vector<std::uint8_t>& border_value = {0}) = delete;
+
+    /*!
+     * \brief Get a pixel at any coordinate.
+     * \param x Column of the pixel, possibly outside [0, width)
+     * \param y Row of the pixel, possibly outside [0, height)
+     * \return Pointer to the channels values of the pixel, either inside the image or the border value
+     */
+    const std::uint8_t* pixel(int x, int y) const;
+
+    /*!
+     * \brief Get a row at any coordinate, without the columns outside the image.
+     * \param y Row index, possibly outside [0, height)
+     * \return Pointer to width * channels values, either a row of the image or a row filled with the border value
+     */
+    const std::uint8_t* row(int y) const;
+
+    /*!
+     * \brief Copy a row extended on both sides, as filters read it.
+     * \param y Row index, possibly outside [0, height)
+     * \param left Number of pixels before the first column
+     * \param right Number of pixels after the last column
+     * \param dst Output buffer of (left + width + right) * channels bytes
+     */
+    void copy_row(int y, int left, int right, std::uint8_t* dst) const;
+
+    int width() const noexcept
+    {
+        return _width;
+    }
+
+    int height() const noexcept
+    {
+        return _height;
+    }
+
+    int channels() const noexcept
+    {
+        return _channels;
+    }
+
+    border_mode border() const noexcept
+    {
+        return _border;
+    }
+
+    /*!
+     * \brief Border value expanded to one value per channel.
+     */
+    const std::vector<std::uint8_t>& border_pixel() const noexcept
+    {
+        return _border_pixel;
+    }
+
+private:
+    const std::uint8_t* _data;
+    int _width;
+    int _height;
+    int _channels;
+    border_mode _border;
+    std::vector<std::uint8_t> _border_pixel;
+    std::vector<std::uint8_t> _constant_row;
+};
+
+/*!
+ * \brief Pad an image on each side according to a border mode, storing result in provided vector.
+ * \param image Input image data vector
+ * \param width Width of the input image in pixels
+ * \param height Height of the input image in pixels
+ * \param channels Number of color channels in the input image
+ * \param top Number of rows added above the image
+ * \param bottom Number of rows added below the image
+ * \param left Number of columns added before the image
+ * \param right Number of columns added after the image
+ * \param padded_image Output vector, resized to (left + width + right) * (top + height + bottom) * channels if needed; it may be the same vector as image
+ * \param border Extrapolation method for the added pixels, defaults to border_mode::constant
+ * \param border_value Value used with border_mode::constant, either a single value for all channels or one value per channel, defaults to {0}
+ * \throws std::runtime_error if a padding size is negative, border_value has neither 1 nor channels components,
+ * or the image is empty and border is not border_mode::constant
+ *
+ * The image rows are copied with one memcpy each and the side borders are filled with block copies.
+ * Rows added above and below the image are copies of whole padded rows.
+ */
+void copy_make_border(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    int top,
+    int bottom,
+    int left,
+    int right,
+    std::vector<std::uint8_t>& padded_image,
+    border_mode border = border_mode::constant,
+    const std::vector<std::uint8_t>& border_value = {0});
+
+/*!
+ * \brief Pad an image on each side according to a border mode, returning result as new vector.
+ * \param image Input image data vector
+ * \param width Width of the input image in pixels
+ * \param height Height of the input image in pixels
+ * \param channels Number of color channels in the input image
+ * \param top Number of rows added above the image
+ * \param bottom Number of rows added below the image
+ * \param left Number of columns added before the image
+ * \param right Number of columns added after the image
+ * \param border Extrapolation method for the added pixels, defaults to border_mode::constant
+ * \param border_value Value used with border_mode::constant, either a single value for all channels or one value per channel, defaults to {0}
+ * \return Vector containing the padded image data, (left + width + right) x (top + height + bottom) pixels
+ * \throws std::runtime_error if a padding size is negative, border_value has neither 1 nor channels components,
+ * or the image is empty and border is not border_mode::constant
+ */
+std::vector<std::uint8_t> copy_make_border(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    int top,
+    int bottom,
+    int left,
+    int right,
+    border_mode border = border_mode::constant,
+    const std::vector<std::uint8_t>& border_value = {0});
+
+}
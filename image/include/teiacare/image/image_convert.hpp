@@ -0,0 +1,66 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace tc::img
+{
+/*!
+ * \enum pixel_format
+ * \brief Channel order of interleaved 8-bit pixels.
+ */
+enum class pixel_format
+{
+    gray, //!< Single luminance channel
+    rgb,  //!< Red, green, blue
+    bgr,  //!< Blue, green, red
+    rgba, //!< Red, green, blue, alpha
+    bgra  //!< Blue, green, red, alpha
+};
+
+/*!
+ * \brief Number of channels of a pixel format.
+ * \param format Pixel format
+ * \return 1 for gray, 3 for rgb and bgr, 4 for rgba and bgra
+ */
+int pixel_format_channels(pixel_format format);
+
+/*!
+ * \brief Convert interleaved pixels between two formats (in-place version).
+ * \param src Input pixel data in src_format
+ * \param src_format Channel order of the input
+ * \param dst Output pixel data in dst_format, resized to the same number of pixels; it may be the same vector as src
+ * \param dst_format Channel order of the output
+ * \throws std::runtime_error if the size of src is not a multiple of the channels of src_format
+ *
+ * Color channels are reordered, alpha is dropped or set to 255, gray is replicated to every color channel and
+ * colors are converted to gray with the BT.601 luminance weights in 14-bit fixed point, (4899 * R + 9617 * G + 1868 * B + 8192) >> 14.
+ * Each pair of formats has its own kernel built on byte shuffles (SSSE3 or NEON), with a scalar path for other targets.
+ */
+void convert(const std::vector<std::uint8_t>& src, pixel_format src_format, std::vector<std::uint8_t>& dst, pixel_format dst_format);
+
+/*!
+ * \brief Convert interleaved pixels between two formats (return version).
+ * \param src Input pixel data in src_format
+ * \param src_format Channel order of the input
+ * \param dst_format Channel order of the output
+ * \return Pixel data in dst_format, with the same number of pixels as src
+ * \throws std::runtime_error if the size of src is not a multiple of the channels of src_format
+ */
+std::vector<std::uint8_t> convert(const std::vector<std::uint8_t>& src, pixel_format src_format, pixel_format dst_format);
+
+}
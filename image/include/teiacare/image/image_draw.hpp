@@ -15,8 +15,10 @@
 #pragma once
 
 #include <teiacare/image/image_color.hpp>
+#include <teiacare/image/image_view.hpp>
 
 #include <cstdint>
+#include <utility>
 #include <vector>
 
 namespace tc::img
@@ -38,6 +40,20 @@ void set_pixel_rgb(
     int y,
     const tc::img::color& color);
 
+/*!
+ * \brief Set the RGB components of a specific pixel in an image view, other channels being left untouched.
+ * \param img Image view to modify, with at least 3 channels
+ * \param x X coordinate of the pixel to set
+ * \param y Y coordinate of the pixel to set
+ * \param color Color to set for the pixel
+ * \throws std::runtime_error if the image has less than 3 channels
+ */
+void set_pixel_rgb(
+    image_span img,
+    int x,
+    int y,
+    const tc::img::color& color);
+
 /*!
  * \brief Draw a rectangle on an image.
  * \param img Image data vector to draw on
@@ -61,6 +77,26 @@ void draw_rectangle(
     const tc::img::color& color,
     int thickness = 1);
 
+/*!
+ * \brief Draw a rectangle on an image view, such as a crop of a larger image.
+ * \param img Image view to draw on, with at least 3 channels
+ * \param x0 X coordinate of the rectangle's top-left corner
+ * \param y0 Y coordinate of the rectangle's top-left corner
+ * \param w Width of the rectangle
+ * \param h Height of the rectangle
+ * \param color Color to use for drawing the rectangle
+ * \param thickness Thickness of the rectangle border in pixels, defaults to 1
+ * \throws std::runtime_error if the image has less than 3 channels
+ */
+void draw_rectangle(
+    image_span img,
+    int x0,
+    int y0,
+    int w,
+    int h,
+    const tc::img::color& color,
+    int thickness = 1);
+
 /*!
  * \brief Draw a line between two points on an image.
  * \param img Image data vector to draw on
@@ -84,6 +120,26 @@ void draw_line(
     const tc::img::color& color,
     int thickness = 1);
 
+/*!
+ * \brief Draw a line between two points on an image view, such as a crop of a larger image.
+ * \param img Image view to draw on, with at least 3 channels
+ * \param x0 X coordinate of the line's start point
+ * \param y0 Y coordinate of the line's start point
+ * \param x1 X coordinate of the line's end point
+ * \param y1 Y coordinate of the line's end point
+ * \param color Color to use for drawing the line
+ * \param thickness Thickness of the line in pixels, defaults to 1
+ * \throws std::runtime_error if the image has less than 3 channels
+ */
+void draw_line(
+    image_span img,
+    int x0,
+    int y0,
+    int x1,
+    int y1,
+    const tc::img::color& color,
+    int thickness = 1);
+
 /*!
  * \brief Draw a polygon defined by two points on an image.
  * \param img Image data vector to draw on
@@ -123,4 +179,66 @@ void draw_polygon(
     const std::vector<std::pair<int, int>>& points,
     const tc::img::color& color,
     int thickness = 1);
+
+/*!
+ * \brief Draw a polygon defined by multiple points on an image view, such as a crop of a larger image.
+ * \param img Image view to draw on, with at least 3 channels
+ * \param points Vector of coordinate pairs defining the polygon vertices
+ * \param color Color to use for drawing the polygon
+ * \param thickness Thickness of the polygon lines in pixels, defaults to 1
+ * \throws std::runtime_error if the image has less than 3 channels
+ */
+void draw_polygon(
+    image_span img,
+    const std::vector<std::pair<int, int>>& points,
+    const tc::img::color& color,
+    int thickness = 1);
+
+/*!
+ * \brief Alpha-blend a segmentation mask over an image, coloring each pixel with the palette entry of its class.
+ * \param img Image data vector to draw on, with 3 (RGB) or 4 (RGBA) channels
+ * \param width Width of the image in pixels
+ * \param height Height of the image in pixels
+ * \param channels Number of channels of the image, 3 or 4
+ * \param mask Class index of each mask pixel
+ * \param mask_width Width of the mask, which may be lower than the image width
+ * \param mask_height Height of the mask, which may be lower than the image height
+ * \param palette Color of each class, its alpha component scaling the blend weight; classes past the end of the palette are left untouched
+ * \param alpha Opacity of the overlay in [0, 1], defaults to 0.5
+ * \throws std::runtime_error if channels is neither 3 nor 4, the image or mask data do not match their sizes, or alpha is outside [0, 1]
+ *
+ * Each channel becomes (pixel * (255 - w) + class_color * w) / 255 rounded to nearest, with w = round(alpha * class_color.a).
+ * The mask is upsampled to the image size with nearest neighbor sampling on the fly, and the alpha channel of RGBA images is preserved.
+ * Class colors and weights are looked up from 256-entry tables into row buffers, which are then blended 16 or 32 channel values
+ * per iteration in 8-bit fixed point with SIMD instructions.
+ */
+void overlay_mask(
+    std::vector<uint8_t>& img,
+    int width,
+    int height,
+    int channels,
+    const std::vector<uint8_t>& mask,
+    int mask_width,
+    int mask_height,
+    const std::vector<tc::img::color>& palette,
+    float alpha = 0.5f);
+
+/*!
+ * \brief Alpha-blend a segmentation mask over an image view, coloring each pixel with the palette entry of its class.
+ * \param img Image view to draw on, with 3 (RGB) or 4 (RGBA) channels
+ * \param mask Class index of each mask pixel
+ * \param mask_width Width of the mask, which may be lower than the image width
+ * \param mask_height Height of the mask, which may be lower than the image height
+ * \param palette Color of each class, its alpha component scaling the blend weight; classes past the end of the palette are left untouched
+ * \param alpha Opacity of the overlay in [0, 1], defaults to 0.5
+ * \throws std::runtime_error if the image has neither 3 nor 4 channels, the mask data do not match its size, or alpha is outside [0, 1]
+ * \see overlay_mask
+ */
+void overlay_mask(
+    image_span img,
+    const std::vector<uint8_t>& mask,
+    int mask_width,
+    int mask_height,
+    const std::vector<tc::img::color>& palette,
+    float alpha = 0.5f);
 }
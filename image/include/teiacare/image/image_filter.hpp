@@ -0,0 +1,120 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <teiacare/image/image_border.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace tc::img
+{
+/*!
+ * \brief Blur an image with a box filter, storing result in provided vector.
+ * \param image Input image data vector
+ * \param width Width of the input image in pixels
+ * \param height Height of the input image in pixels
+ * \param channels Number of color channels in the input image
+ * \param radius Radius of the filter, each output pixel being the mean of a (2 * radius + 1) x (2 * radius + 1) window, in [0, 1024]
+ * \param blurred_image Output vector to store the blurred image data, resized to width * height * channels if needed; it may be the same vector as image
+ * \param border Extrapolation method for window pixels outside the input image, defaults to border_mode::reflect
+ * \param border_value Value used with border_mode::constant, either a single value for all channels or one value per channel, defaults to {0}
+ * \throws std::runtime_error if radius is outside [0, 1024] or border_value has neither 1 nor channels components
+ *
+ * Window sums are updated incrementally along rows and columns, so the cost per pixel does not depend on the radius.
+ * The mean is rounded to nearest. Rows are processed in parallel bands.
+ */
+void box_blur(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    int radius,
+    std::vector<std::uint8_t>& blurred_image,
+    border_mode border = border_mode::reflect,
+    const std::vector<std::uint8_t>& border_value = {0});
+
+/*!
+ * \brief Blur an image with a box filter, returning result as new vector.
+ * \param image Input image data vector
+ * \param width Width of the input image in pixels
+ * \param height Height of the input image in pixels
+ * \param channels Number of color channels in the input image
+ * \param radius Radius of the filter, each output pixel being the mean of a (2 * radius + 1) x (2 * radius + 1) window, in [0, 1024]
+ * \param border Extrapolation method for window pixels outside the input image, defaults to border_mode::reflect
+ * \param border_value Value used with border_mode::constant, either a single value for all channels or one value per channel, defaults to {0}
+ * \return Vector containing the blurred image data
+ * \throws std::runtime_error if radius is outside [0, 1024] or border_value has neither 1 nor channels components
+ */
+std::vector<std::uint8_t> box_blur(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    int radius,
+    border_mode border = border_mode::reflect,
+    const std::vector<std::uint8_t>& border_value = {0});
+
+/*!
+ * \brief Blur an image with a Gaussian filter, storing result in provided vector.
+ * \param image Input image data vector
+ * \param width Width of the input image in pixels
+ * \param height Height of the input image in pixels
+ * \param channels Number of color channels in the input image
+ * \param sigma Standard deviation of the Gaussian in pixels, must be positive
+ * \param blurred_image Output vector to store the blurred image data, resized to width * height * channels if needed; it may be the same vector as image
+ * \param radius Radius of the filter, or 0 to use ceil(3 * sigma), defaults to 0
+ * \param border Extrapolation method for window pixels outside the input image, defaults to border_mode::reflect
+ * \param border_value Value used with border_mode::constant, either a single value for all channels or one value per channel, defaults to {0}
+ * \throws std::runtime_error if sigma is not positive, radius is negative or border_value has neither 1 nor channels components
+ *
+ * The filter is applied as a horizontal and a vertical pass with 14-bit fixed point weights, keeping 7 fractional bits
+ * between the passes. Both passes use SIMD multiply-adds of 16-bit values and rows are processed in parallel bands.
+ */
+void gaussian_blur(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    float sigma,
+    std::vector<std::uint8_t>& blurred_image,
+    int radius = 0,
+    border_mode border = border_mode::reflect,
+    const std::vector<std::uint8_t>& border_value = {0});
+
+/*!
+ * \brief Blur an image with a Gaussian filter, returning result as new vector.
+ * \param image Input image data vector
+ * \param width Width of the input image in pixels
+ * \param height Height of the input image in pixels
+ * \param channels Number of color channels in the input image
+ * \param sigma Standard deviation of the Gaussian in pixels, must be positive
+ * \param radius Radius of the filter, or 0 to use ceil(3 * sigma), defaults to 0
+ * \param border Extrapolation method for window pixels outside the input image, defaults to border_mode::reflect
+ * \param border_value Value used with border_mode::constant, either a single value for all channels or one value per channel, defaults to {0}
+ * \return Vector containing the blurred image data
+ * \throws std::runtime_error if sigma is not positive, radius is negative or border_value has neither 1 nor channels components
+ */
+std::vector<std::uint8_t> gaussian_blur(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    float sigma,
+    int radius = 0,
+    border_mode border = border_mode::reflect,
+    const std::vector<std::uint8_t>& border_value = {0});
+
+}
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <teiacare/image/image_view.hpp>
+
 #include <filesystem>
 #include <tuple>
 #include <vector>
@@ -89,4 +91,16 @@ void image_save(
     int width,
     int height,
     int channels);
+
+/*!
+ * \brief Save an image view to a file.
+ * \param output_path Path where the image file should be saved
+ * \param image Image view to save, possibly a crop of a larger image or a buffer with padded rows
+ * \throws std::runtime_error if the format is not supported or the file cannot be written
+ *
+ * PNG files are encoded straight from the view rows, other formats first copy padded rows to a packed buffer.
+ */
+void image_save(
+    const std::filesystem::path& output_path,
+    image_view image);
 }
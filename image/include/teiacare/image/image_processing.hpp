@@ -14,11 +14,322 @@
 
 #pragma once
 
+#include <teiacare/image/executor.hpp>
+#include <teiacare/image/float16.hpp>
+#include <teiacare/image/image_resize.hpp>
+#include <teiacare/image/image_view.hpp>
+#include <teiacare/image/image_yuv.hpp>
+#include <teiacare/image/tensor.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <numeric>
+#include <ranges>
+#include <stdexcept>
+#include <span>
+#include <string>
+#include <tuple>
+#include <type_traits>
 #include <vector>
 
 namespace tc::img
 {
+/*!
+ * \enum blob_layout
+ * \brief Memory layout of the blobs created from interleaved images.
+ */
+enum class blob_layout
+{
+    nchw, //!< Planar: one plane per channel, as expected by most ONNX and OpenCV DNN models
+    nhwc  //!< Interleaved: channels of each pixel stored together, as expected by TFLite and channels-last models
+};
+
+namespace detail
+{
+/*!
+ * \brief Single pass conversion of an interleaved uint8 image to a float blob, computing blob = pixel * scale + offset.
+ * \param image Input interleaved image, its rows possibly separated by padding bytes
+ * \param blob Output blob, with room for channels * width * height values
+ * \param scale Per output channel multiplier
+ * \param offset Per output channel addend
+ * \param swapRB_channels Whether output channel c reads input channel 2 - c for the first 3 channels
+ * \param layout Memory layout of the blob
+ *
+ * Channel count, channel order and layout select specialized loops: NCHW blobs deinterleave pixels with SIMD shuffles,
+ * NHWC blobs keeping the channel order are a vectorized convert-and-scale, and swapped channels read compile time source indices.
+ */
+void create_blob_kernel(
+    image_view image,
+    float* blob,
+    const float* scale,
+    const float* offset,
+    bool swapRB_channels,
+    blob_layout layout);
+
+/*!
+ * \brief Single pass conversion of an interleaved uint8 image to an IEEE half precision blob, computing blob = pixel * scale + offset.
+ * \see create_blob_kernel
+ */
+void create_blob_kernel(
+    image_view image,
+    float16* blob,
+    const float* scale,
+    const float* offset,
+    bool swapRB_channels,
+    blob_layout layout);
+
+/*!
+ * \brief Single pass conversion of an interleaved uint8 image to a bfloat16 blob, computing blob = pixel * scale + offset.
+ * \see create_blob_kernel
+ */
+void create_blob_kernel(
+    image_view image,
+    bfloat16* blob,
+    const float* scale,
+    const float* offset,
+    bool swapRB_channels,
+    blob_layout layout);
+
+/*!
+ * \brief Conversion of an interleaved uint8 image to an int8 blob, quantizing blob = pixel * scale + offset.
+ * \param quant_scale Quantization scale, either a single value or one value per output channel
+ * \param zero_point Quantization zero point, either a single value or one value per output channel
+ * \throws std::runtime_error if quant_scale or zero_point have neither 1 nor channels components, a quantization scale is not positive and finite
+ * or a zero point is out of the range of the output type
+ * \see create_blob_kernel
+ */
+void create_quantized_blob_kernel(
+    image_view image,
+    std::int8_t* blob,
+    const float* scale,
+    const float* offset,
+    const std::vector<float>& quant_scale,
+    const std::vector<int>& zero_point,
+    bool swapRB_channels,
+    blob_layout layout);
+
+/*!
+ * \brief Conversion of an interleaved uint8 image to a uint8 blob, quantizing blob = pixel * scale + offset.
+ * \see create_quantized_blob_kernel
+ */
+void create_quantized_blob_kernel(
+    image_view image,
+    std::uint8_t* blob,
+    const float* scale,
+    const float* offset,
+    const std::vector<float>& quant_scale,
+    const std::vector<int>& zero_point,
+    bool swapRB_channels,
+    blob_layout layout);
+
+/*!
+ * \brief Conversion of float blobs back to interleaved uint8 images, computing pixel = round((value * std_dev + mean) / scale_factor) saturated to [0, 255].
+ * \param blob Input blob values, either one image or a batch of images stored one after the other
+ * \param size Number of values in blob, which must be images.size() * channels * height * width
+ * \param width Width of each image in pixels
+ * \param height Height of each image in pixels
+ * \param channels Number of channels of each image
+ * \param images Output images, each one resized to channels * height * width bytes
+ * \param swapRB_channels Whether image channel c reads blob channel 2 - c for the first 3 channels
+ * \param layout Memory layout of the blob
+ * \param exec Executor splitting the rows of all the images across threads
+ * \throws std::runtime_error if the blob size does not match, the scale factor or a standard deviation is zero,
+ * or swapRB_channels is set for images with less than 3 channels
+ *
+ * Values are rounded to nearest, NaNs becoming 0, with SIMD convert and saturating pack instructions.
+ * NCHW blobs are converted plane by plane into an L1-resident buffer which is then interleaved into the image.
+ */
+void blob_to_image_kernel(
+    const float* blob,
+    std::size_t size,
+    int width,
+    int height,
+    int channels,
+    std::span<std::vector<std::uint8_t>> images,
+    float scale_factor,
+    const std::vector<float>& mean,
+    bool swapRB_channels,
+    const std::vector<float>& std_dev,
+    blob_layout layout,
+    executor& exec);
+
+/*!
+ * \brief Conversion of IEEE half precision blobs back to interleaved uint8 images.
+ * \see blob_to_image_kernel
+ */
+void blob_to_image_kernel(
+    const float16* blob,
+    std::size_t size,
+    int width,
+    int height,
+    int channels,
+    std::span<std::vector<std::uint8_t>> images,
+    float scale_factor,
+    const std::vector<float>& mean,
+    bool swapRB_channels,
+    const std::vector<float>& std_dev,
+    blob_layout layout,
+    executor& exec);
+
+/*!
+ * \brief Conversion of bfloat16 blobs back to interleaved uint8 images.
+ * \see blob_to_image_kernel
+ */
+void blob_to_image_kernel(
+    const bfloat16* blob,
+    std::size_t size,
+    int width,
+    int height,
+    int channels,
+    std::span<std::vector<std::uint8_t>> images,
+    float scale_factor,
+    const std::vector<float>& mean,
+    bool swapRB_channels,
+    const std::vector<float>& std_dev,
+    blob_layout layout,
+    executor& exec);
+
+/*!
+ * \brief Whether a contiguous range can be converted back to images by blob_to_image: float, float16 or bfloat16 values.
+ */
+template <typename Blob>
+inline constexpr bool is_image_blob_v = std::ranges::contiguous_range<Blob> && (std::is_same_v<std::ranges::range_value_t<Blob>, float> || is_half_float_v<std::ranges::range_value_t<Blob>>);
+
+/*!
+ * \brief Fold scale factor, mean and standard deviation into one multiplier and one addend per channel.
+ * \throws std::runtime_error if a standard deviation is zero or swapRB_channels is set for images with less than 3 channels
+ */
+template <typename T>
+void blob_coefficients(int channels, T scale_factor, const std::vector<T>& mean, const std::vector<T>& std_dev, bool swapRB_channels, std::vector<T>& scale, std::vector<T>& offset)
+{
+    if (swapRB_channels && channels < 3)
+    {
+        throw std::runtime_error("Invalid channels for swapRB_channels: " + std::to_string(channels) + ", at least 3 channels are required");
+    }
+
+    scale.resize(channels);
+    offset.resize(channels);
+    for (int c = 0; c < channels; ++c)
+    {
+        // Missing components default to a zero mean and a unit standard deviation
+        const T m = c < static_cast<int>(mean.size()) ? mean[c] : T(0);
+        const T s = c < static_cast<int>(std_dev.size()) ? std_dev[c] : T(1);
+        if (s == T(0))
+        {
+            throw std::runtime_error("Invalid standard deviation for channel " + std::to_string(c) + ": the value must be non-zero");
+        }
+
+        scale[c] = scale_factor / s;
+        offset[c] = -m / s;
+    }
+}
+
+/*!
+ * \brief Shape of the blob of one image: {channels, height, width} for NCHW blobs and {height, width, channels} for NHWC ones.
+ */
+inline std::vector<std::size_t> blob_shape(int width, int height, int channels, blob_layout layout)
+{
+    const std::size_t w = static_cast<std::size_t>(std::max(width, 0));
+    const std::size_t h = static_cast<std::size_t>(std::max(height, 0));
+    const std::size_t c = static_cast<std::size_t>(std::max(channels, 0));
+    return layout == blob_layout::nchw ? std::vector<std::size_t>{c, h, w} : std::vector<std::size_t>{h, w, c};
+}
+
+/*!
+ * \brief Resize a blob vector to hold the given shape, keeping its capacity, and get its storage.
+ */
+template <typename T>
+T* allocate_blob(std::vector<T>& blob, const std::vector<std::size_t>& shape)
+{
+    blob.resize(std::accumulate(shape.begin(), shape.end(), std::size_t{1}, std::multiplies<>{}));
+    return blob.data();
+}
+
+/*!
+ * \brief Replace a blob tensor with a new uninitialized one of the given shape, and get its storage.
+ */
+template <typename T, std::size_t Alignment>
+T* allocate_blob(tensor<T, Alignment>& blob, const std::vector<std::size_t>& shape)
+{
+    blob = tensor<T, Alignment>::uninitialized(shape);
+    return blob.data();
+}
+
+/*!
+ * \brief Implementation of create_blob writing to a std::vector or a tensor.
+ * \tparam Blob Output container, its value_type being the blob element type
+ * \tparam P Type of the normalization parameters, float for 16-bit floating point blobs
+ */
+template <typename Blob, typename P>
+void create_blob_into(
+    image_view image,
+    Blob& blob,
+    P scale_factor,
+    const std::vector<P>& mean,
+    bool swapRB_channels,
+    const std::vector<P>& std_dev,
+    blob_layout layout)
+{
+    using T = typename Blob::value_type;
+    const int width = image.width();
+    const int channels = image.channels();
+    std::vector<P> scale;
+    std::vector<P> offset;
+    blob_coefficients(channels, scale_factor, mean, std_dev, swapRB_channels, scale, offset);
+    T* data = allocate_blob(blob, blob_shape(width, image.height(), channels, layout));
+
+    if constexpr (std::is_same_v<T, float> || is_half_float_v<T>)
+    {
+        create_blob_kernel(image, data, scale.data(), offset.data(), swapRB_channels, layout);
+    }
+    else
+    {
+        const std::size_t plane_size = static_cast<std::size_t>(width) * image.height();
+        const std::size_t channel_stride = layout == blob_layout::nchw ? plane_size : 1;
+        const std::size_t pixel_stride = layout == blob_layout::nchw ? 1 : channels;
+        std::vector<int> src_channel(channels);
+        for (int c = 0; c < channels; ++c)
+            src_channel[c] = (swapRB_channels && c < 3) ? (2 - c) : c;
+
+        for (int y = 0; y < image.height(); ++y)
+        {
+            const std::uint8_t* pixel = image.row(y);
+            for (int x = 0; x < width; ++x, pixel += channels)
+            {
+                const std::size_t i = static_cast<std::size_t>(y) * width + x;
+                for (int c = 0; c < channels; ++c)
+                    data[c * channel_stride + i * pixel_stride] = static_cast<T>(pixel[src_channel[c]]) * scale[c] + offset[c];
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Implementation of create_quantized_blob writing to a std::vector or a tensor.
+ */
+template <typename Blob>
+void create_quantized_blob_into(
+    image_view image,
+    Blob& blob,
+    const std::vector<float>& quant_scale,
+    const std::vector<int>& zero_point,
+    float scale_factor,
+    const std::vector<float>& mean,
+    bool swapRB_channels,
+    const std::vector<float>& std_dev,
+    blob_layout layout)
+{
+    std::vector<float> scale;
+    std::vector<float> offset;
+    blob_coefficients(image.channels(), scale_factor, mean, std_dev, swapRB_channels, scale, offset);
+    auto* data = allocate_blob(blob, blob_shape(image.width(), image.height(), image.channels(), layout));
+    create_quantized_blob_kernel(image, data, scale.data(), offset.data(), quant_scale, zero_point, swapRB_channels, layout);
+}
+}
+
 /*!
  * \brief Create a blob from image data with optional preprocessing (in-place version).
  * \tparam T Numeric type for the output blob (typically float or double)
@@ -26,12 +337,20 @@ namespace tc::img
  * \param width Width of the input image in pixels
  * \param height Height of the input image in pixels
  * \param channels Number of color channels in the input image
- * \param blob Output vector to store the processed blob data
+ * \param blob Output vector to store the processed blob data, resized to channels * height * width if needed
  * \param scale_factor Scaling factor applied to pixel values, defaults to 1.0/255.0
  * \param mean Vector of mean values to subtract from each channel, defaults to {0.0, 0.0, 0.0}
  * \param swapRB_channels Whether to swap red and blue channels (RGB to BGR conversion), defaults to false
+ * \param std_dev Vector of standard deviations dividing each channel after mean subtraction, defaults to {} (no division)
+ * \param layout Memory layout of the blob, defaults to blob_layout::nchw
+ * \throws std::runtime_error if a standard deviation is zero or swapRB_channels is set for images with less than 3 channels
+ *
+ * Each output value is (pixel * scale_factor - mean[c]) / std_dev[c], missing mean and std_dev components default to 0 and 1.
+ * Float blobs are produced by a single pass SIMD kernel that deinterleaves the image and normalizes it with one multiply-add per value.
+ * NHWC blobs keep the pixels interleaved, for TFLite and other channels-last models.
  */
 template <typename T>
+    requires std::is_arithmetic_v<T>
 void create_blob(
     const std::vector<std::uint8_t>& image,
     int width,
@@ -40,23 +359,11 @@ void create_blob(
     std::vector<T>& blob,
     T scale_factor = 1.0 / 255.0,
     const std::vector<T>& mean = {0.0, 0.0, 0.0},
-    bool swapRB_channels = false)
+    bool swapRB_channels = false,
+    const std::vector<T>& std_dev = {},
+    blob_layout layout = blob_layout::nchw)
 {
-    for (int c = 0; c < channels; ++c)
-    {
-        const int channel_offset = (swapRB_channels ? (2 - c) : c);
-
-        for (int y = 0; y < height; ++y)
-        {
-            for (int x = 0; x < width; ++x)
-            {
-                const int idx_offset = y * width + x;
-                const int blob_idx = c * height * width + idx_offset;
-                const int image_idx = idx_offset * channels + channel_offset;
-                blob[blob_idx] = static_cast<T>(image[image_idx]) * scale_factor - mean[c];
-            }
-        }
-    }
+    detail::create_blob_into(image_view{image.data(), width, height, channels}, blob, scale_factor, mean, swapRB_channels, std_dev, layout);
 }
 
 /*!
@@ -69,21 +376,650 @@ void create_blob(
  * \param scale_factor Scaling factor applied to pixel values, defaults to 1.0/255.0
  * \param mean Vector of mean values to subtract from each channel, defaults to {0.0, 0.0, 0.0}
  * \param swapRB_channels Whether to swap red and blue channels (RGB to BGR conversion), defaults to false
- * \return Vector containing the processed blob data
+ * \param std_dev Vector of standard deviations dividing each channel after mean subtraction, defaults to {} (no division)
+ * \param layout Memory layout of the blob, defaults to blob_layout::nchw
+ * \return Tensor containing the processed blob data, with shape {channels, height, width} or {height, width, channels} for NHWC blobs
+ * \throws std::runtime_error if a standard deviation is zero or swapRB_channels is set for images with less than 3 channels
  */
 template <typename T>
-std::vector<T> create_blob(
+    requires std::is_arithmetic_v<T>
+tensor<T> create_blob(
     const std::vector<std::uint8_t>& image,
     int width,
     int height,
     int channels,
     T scale_factor = 1.0 / 255.0,
     const std::vector<T>& mean = {0.0, 0.0, 0.0},
-    bool swapRB_channels = false)
+    bool swapRB_channels = false,
+    const std::vector<T>& std_dev = {},
+    blob_layout layout = blob_layout::nchw)
 {
-    std::vector<float> blob(channels * width * height);
-    create_blob(image, width, height, channels, blob, scale_factor, mean, swapRB_channels);
+    tensor<T> blob;
+    detail::create_blob_into(image_view{image.data(), width, height, channels}, blob, scale_factor, mean, swapRB_channels, std_dev, layout);
     return blob;
 }
 
+/*!
+ * \brief Create a blob from an image view with optional preprocessing (in-place version).
+ * \param image Input image view, possibly a crop of a larger image or a buffer with padded rows
+ * \see create_blob
+ *
+ * Padded rows are read through the view stride, so crops and external buffers are converted without an intermediate copy.
+ */
+template <typename T>
+    requires std::is_arithmetic_v<T>
+void create_blob(
+    image_view image,
+    std::vector<T>& blob,
+    T scale_factor = 1.0 / 255.0,
+    const std::vector<T>& mean = {0.0, 0.0, 0.0},
+    bool swapRB_channels = false,
+    const std::vector<T>& std_dev = {},
+    blob_layout layout = blob_layout::nchw)
+{
+    detail::create_blob_into(image, blob, scale_factor, mean, swapRB_channels, std_dev, layout);
+}
+
+/*!
+ * \brief Create a blob from an image view with optional preprocessing (return version).
+ * \param image Input image view, possibly a crop of a larger image or a buffer with padded rows
+ * \return Tensor containing the processed blob data, with shape {channels, height, width} or {height, width, channels} for NHWC blobs
+ * \see create_blob
+ */
+template <typename T>
+    requires std::is_arithmetic_v<T>
+tensor<T> create_blob(
+    image_view image,
+    T scale_factor = 1.0 / 255.0,
+    const std::vector<T>& mean = {0.0, 0.0, 0.0},
+    bool swapRB_channels = false,
+    const std::vector<T>& std_dev = {},
+    blob_layout layout = blob_layout::nchw)
+{
+    tensor<T> blob;
+    detail::create_blob_into(image, blob, scale_factor, mean, swapRB_channels, std_dev, layout);
+    return blob;
+}
+
+/*!
+ * \brief Create a 16-bit floating point blob from image data with optional preprocessing (in-place version).
+ * \tparam T Output element type, either float16 or bfloat16
+ * \param image Input image data vector
+ * \param width Width of the input image in pixels
+ * \param height Height of the input image in pixels
+ * \param channels Number of color channels in the input image
+ * \param blob Output vector to store the processed blob data, resized to channels * height * width if needed
+ * \param scale_factor Scaling factor applied to pixel values, defaults to 1.0/255.0
+ * \param mean Vector of mean values to subtract from each channel, defaults to {0.0, 0.0, 0.0}
+ * \param swapRB_channels Whether to swap red and blue channels (RGB to BGR conversion), defaults to false
+ * \param std_dev Vector of standard deviations dividing each channel after mean subtraction, defaults to {} (no division)
+ * \param layout Memory layout of the blob, defaults to blob_layout::nchw
+ * \throws std::runtime_error if a standard deviation is zero or swapRB_channels is set for images with less than 3 channels
+ *
+ * Values are computed in float as for create_blob<float>, then rounded to nearest even while being stored,
+ * so the blob is written once at half the bandwidth of a float blob.
+ * F16C (and AVX-512 BF16) conversion instructions are used when the build targets them, with a bit-exact software fallback otherwise.
+ */
+template <typename T>
+    requires is_half_float_v<T>
+void create_blob(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    std::vector<T>& blob,
+    float scale_factor = 1.0f / 255.0f,
+    const std::vector<float>& mean = {0.0f, 0.0f, 0.0f},
+    bool swapRB_channels = false,
+    const std::vector<float>& std_dev = {},
+    blob_layout layout = blob_layout::nchw)
+{
+    detail::create_blob_into(image_view{image.data(), width, height, channels}, blob, scale_factor, mean, swapRB_channels, std_dev, layout);
+}
+
+/*!
+ * \brief Create a 16-bit floating point blob from image data with optional preprocessing (return version).
+ * \tparam T Output element type, either float16 or bfloat16
+ * \param image Input image data vector
+ * \param width Width of the input image in pixels
+ * \param height Height of the input image in pixels
+ * \param channels Number of color channels in the input image
+ * \param scale_factor Scaling factor applied to pixel values, defaults to 1.0/255.0
+ * \param mean Vector of mean values to subtract from each channel, defaults to {0.0, 0.0, 0.0}
+ * \param swapRB_channels Whether to swap red and blue channels (RGB to BGR conversion), defaults to false
+ * \param std_dev Vector of standard deviations dividing each channel after mean subtraction, defaults to {} (no division)
+ * \param layout Memory layout of the blob, defaults to blob_layout::nchw
+ * \return Tensor containing the processed blob data, with shape {channels, height, width} or {height, width, channels} for NHWC blobs
+ * \throws std::runtime_error if a standard deviation is zero or swapRB_channels is set for images with less than 3 channels
+ */
+template <typename T>
+    requires is_half_float_v<T>
+tensor<T> create_blob(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    float scale_factor = 1.0f / 255.0f,
+    const std::vector<float>& mean = {0.0f, 0.0f, 0.0f},
+    bool swapRB_channels = false,
+    const std::vector<float>& std_dev = {},
+    blob_layout layout = blob_layout::nchw)
+{
+    tensor<T> blob;
+    detail::create_blob_into(image_view{image.data(), width, height, channels}, blob, scale_factor, mean, swapRB_channels, std_dev, layout);
+    return blob;
+}
+
+/*!
+ * \brief Create a 16-bit floating point blob from an image view with optional preprocessing (in-place version).
+ * \param image Input image view, possibly a crop of a larger image or a buffer with padded rows
+ * \see create_blob
+ *
+ * Padded rows are read through the view stride, so crops and external buffers are converted without an intermediate copy.
+ */
+template <typename T>
+    requires is_half_float_v<T>
+void create_blob(
+    image_view image,
+    std::vector<T>& blob,
+    float scale_factor = 1.0f / 255.0f,
+    const std::vector<float>& mean = {0.0f, 0.0f, 0.0f},
+    bool swapRB_channels = false,
+    const std::vector<float>& std_dev = {},
+    blob_layout layout = blob_layout::nchw)
+{
+    detail::create_blob_into(image, blob, scale_factor, mean, swapRB_channels, std_dev, layout);
+}
+
+/*!
+ * \brief Create a 16-bit floating point blob from an image view with optional preprocessing (return version).
+ * \param image Input image view, possibly a crop of a larger image or a buffer with padded rows
+ * \return Tensor containing the processed blob data, with shape {channels, height, width} or {height, width, channels} for NHWC blobs
+ * \see create_blob
+ */
+template <typename T>
+    requires is_half_float_v<T>
+tensor<T> create_blob(
+    image_view image,
+    float scale_factor = 1.0f / 255.0f,
+    const std::vector<float>& mean = {0.0f, 0.0f, 0.0f},
+    bool swapRB_channels = false,
+    const std::vector<float>& std_dev = {},
+    blob_layout layout = blob_layout::nchw)
+{
+    tensor<T> blob;
+    detail::create_blob_into(image, blob, scale_factor, mean, swapRB_channels, std_dev, layout);
+    return blob;
+}
+
+/*!
+ * \brief Create a quantized 8-bit blob from image data with optional preprocessing (in-place version).
+ * \tparam T Output element type, either std::int8_t or std::uint8_t
+ * \param image Input image data vector
+ * \param width Width of the input image in pixels
+ * \param height Height of the input image in pixels
+ * \param channels Number of color channels in the input image
+ * \param blob Output vector to store the quantized blob data, resized to channels * height * width if needed
+ * \param quant_scale Quantization scale, either a single value (per-tensor) or one value per channel (per-channel)
+ * \param zero_point Quantization zero point, either a single value (per-tensor) or one value per channel (per-channel)
+ * \param scale_factor Scaling factor applied to pixel values, defaults to 1.0/255.0
+ * \param mean Vector of mean values to subtract from each channel, defaults to {0.0, 0.0, 0.0}
+ * \param swapRB_channels Whether to swap red and blue channels (RGB to BGR conversion), defaults to false
+ * \param std_dev Vector of standard deviations dividing each channel after mean subtraction, defaults to {} (no division)
+ * \param layout Memory layout of the blob, defaults to blob_layout::nchw
+ * \throws std::runtime_error if quant_scale or zero_point have neither 1 nor channels components, a quantization scale is not positive and finite,
+ * a zero point is out of the range of T, a standard deviation is zero or swapRB_channels is set for images with less than 3 channels
+ *
+ * Each output value is saturate(round(((pixel * scale_factor - mean[c]) / std_dev[c]) / quant_scale[c]) + zero_point[c]),
+ * rounding half to even as ONNX QuantizeLinear does on the float blob produced by create_blob.
+ * Every uint8 value of each channel is quantized once into a 256-entry lookup table, so the pixel loop is a plain table lookup.
+ */
+template <typename T>
+    requires std::is_same_v<T, std::int8_t> || std::is_same_v<T, std::uint8_t>
+void create_quantized_blob(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    std::vector<T>& blob,
+    const std::vector<float>& quant_scale,
+    const std::vector<int>& zero_point,
+    float scale_factor = 1.0f / 255.0f,
+    const std::vector<float>& mean = {0.0f, 0.0f, 0.0f},
+    bool swapRB_channels = false,
+    const std::vector<float>& std_dev = {},
+    blob_layout layout = blob_layout::nchw)
+{
+    detail::create_quantized_blob_into(image_view{image.data(), width, height, channels}, blob, quant_scale, zero_point, scale_factor, mean, swapRB_channels, std_dev, layout);
+}
+
+/*!
+ * \brief Create a quantized 8-bit blob from image data with optional preprocessing (return version).
+ * \tparam T Output element type, either std::int8_t or std::uint8_t
+ * \param image Input image data vector
+ * \param width Width of the input image in pixels
+ * \param height Height of the input image in pixels
+ * \param channels Number of color channels in the input image
+ * \param quant_scale Quantization scale, either a single value (per-tensor) or one value per channel (per-channel)
+ * \param zero_point Quantization zero point, either a single value (per-tensor) or one value per channel (per-channel)
+ * \param scale_factor Scaling factor applied to pixel values, defaults to 1.0/255.0
+ * \param mean Vector of mean values to subtract from each channel, defaults to {0.0, 0.0, 0.0}
+ * \param swapRB_channels Whether to swap red and blue channels (RGB to BGR conversion), defaults to false
+ * \param std_dev Vector of standard deviations dividing each channel after mean subtraction, defaults to {} (no division)
+ * \param layout Memory layout of the blob, defaults to blob_layout::nchw
+ * \return Tensor containing the quantized blob data, with shape {channels, height, width} or {height, width, channels} for NHWC blobs
+ * \throws std::runtime_error if quant_scale or zero_point have neither 1 nor channels components, a quantization scale is not positive and finite,
+ * a zero point is out of the range of T, a standard deviation is zero or swapRB_channels is set for images with less than 3 channels
+ */
+template <typename T>
+    requires std::is_same_v<T, std::int8_t> || std::is_same_v<T, std::uint8_t>
+tensor<T> create_quantized_blob(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    const std::vector<float>& quant_scale,
+    const std::vector<int>& zero_point,
+    float scale_factor = 1.0f / 255.0f,
+    const std::vector<float>& mean = {0.0f, 0.0f, 0.0f},
+    bool swapRB_channels = false,
+    const std::vector<float>& std_dev = {},
+    blob_layout layout = blob_layout::nchw)
+{
+    tensor<T> blob;
+    detail::create_quantized_blob_into(image_view{image.data(), width, height, channels}, blob, quant_scale, zero_point, scale_factor, mean, swapRB_channels, std_dev, layout);
+    return blob;
+}
+
+/*!
+ * \brief Letterbox-resize an image and convert it to a normalized planar blob in one pass (in-place version).
+ * \param image Input image data vector
+ * \param image_width Width of the input image in pixels
+ * \param image_height Height of the input image in pixels
+ * \param image_channels Number of color channels in the input image
+ * \param target_width Width of the blob planes
+ * \param target_height Height of the blob planes
+ * \param blob Output vector to store the CHW blob data, resized to image_channels * target_height * target_width if needed
+ * \param scale_factor Scaling factor applied to pixel values, defaults to 1.0/255.0
+ * \param mean Vector of mean values to subtract from each channel, defaults to {0.0, 0.0, 0.0}
+ * \param swapRB_channels Whether to swap red and blue channels (RGB to BGR conversion), defaults to false
+ * \param std_dev Vector of standard deviations dividing each channel after mean subtraction, defaults to {} (no division)
+ * \param pad_value Padding color of the input image, either a single value for all channels or one value per channel, defaults to {0}
+ * \throws std::runtime_error if pad_value has neither 1 nor image_channels components, a standard deviation is zero
+ * or swapRB_channels is set for images with less than 3 channels
+ *
+ * The result is the same as image_resize_aspect_ratio followed by create_blob, but source pixels are sampled straight into the blob
+ * and padding is written already normalized, without an intermediate uint8 image.
+ */
+void letterbox_blob(
+    const std::vector<std::uint8_t>& image,
+    int image_width,
+    int image_height,
+    int image_channels,
+    int target_width,
+    int target_height,
+    std::vector<float>& blob,
+    float scale_factor = 1.0f / 255.0f,
+    const std::vector<float>& mean = {0.0f, 0.0f, 0.0f},
+    bool swapRB_channels = false,
+    const std::vector<float>& std_dev = {},
+    const letterbox_pad& pad_value = {0});
+
+/*!
+ * \brief Letterbox-resize an image and convert it to a normalized planar blob in one pass (return version).
+ * \param image Input image data vector
+ * \param image_width Width of the input image in pixels
+ * \param image_height Height of the input image in pixels
+ * \param image_channels Number of color channels in the input image
+ * \param target_width Width of the blob planes
+ * \param target_height Height of the blob planes
+ * \param scale_factor Scaling factor applied to pixel values, defaults to 1.0/255.0
+ * \param mean Vector of mean values to subtract from each channel, defaults to {0.0, 0.0, 0.0}
+ * \param swapRB_channels Whether to swap red and blue channels (RGB to BGR conversion), defaults to false
+ * \param std_dev Vector of standard deviations dividing each channel after mean subtraction, defaults to {} (no division)
+ * \param pad_value Padding color of the input image, either a single value for all channels or one value per channel, defaults to {0}
+ * \return Tensor containing the CHW blob data, with shape {image_channels, target_height, target_width}
+ * \throws std::runtime_error if pad_value has neither 1 nor image_channels components, a standard deviation is zero
+ * or swapRB_channels is set for images with less than 3 channels
+ */
+tensor<float> letterbox_blob(
+    const std::vector<std::uint8_t>& image,
+    int image_width,
+    int image_height,
+    int image_channels,
+    int target_width,
+    int target_height,
+    float scale_factor = 1.0f / 255.0f,
+    const std::vector<float>& mean = {0.0f, 0.0f, 0.0f},
+    bool swapRB_channels = false,
+    const std::vector<float>& std_dev = {},
+    const letterbox_pad& pad_value = {0});
+
+/*!
+ * \brief Letterbox-resize an NV12 image and convert it to a normalized 3-channel planar blob in one pass (in-place version).
+ * \param nv12 Input NV12 data: the image_width x image_height luma plane followed by the interleaved UV plane, subsampled 2x2
+ * \param image_width Width of the input image in pixels
+ * \param image_height Height of the input image in pixels
+ * \param target_width Width of the blob planes
+ * \param target_height Height of the blob planes
+ * \param blob Output vector to store the CHW blob data, resized to 3 * target_height * target_width if needed
+ * \param scale_factor Scaling factor applied to pixel values, defaults to 1.0/255.0
+ * \param mean Vector of mean values to subtract from each channel, defaults to {0.0, 0.0, 0.0}
+ * \param swapRB_channels Whether to produce BGR planes instead of RGB, defaults to false
+ * \param std_dev Vector of standard deviations dividing each channel after mean subtraction, defaults to {} (no division)
+ * \param pad_value Padding color in RGB, either a single value for all channels or one value per channel, defaults to {0}
+ * \param matrix Color matrix of the input, defaults to yuv_matrix::bt601
+ * \param range Value range of the input, defaults to yuv_range::limited
+ * \throws std::runtime_error if nv12 does not match the image size, pad_value has neither 1 nor 3 components
+ * or a standard deviation is zero
+ *
+ * The result is the same as nv12_to_rgb followed by letterbox_blob, but only the sampled luma and chroma values are converted,
+ * without an intermediate RGB image.
+ */
+void nv12_letterbox_blob(
+    const std::vector<std::uint8_t>& nv12,
+    int image_width,
+    int image_height,
+    int target_width,
+    int target_height,
+    std::vector<float>& blob,
+    float scale_factor = 1.0f / 255.0f,
+    const std::vector<float>& mean = {0.0f, 0.0f, 0.0f},
+    bool swapRB_channels = false,
+    const std::vector<float>& std_dev = {},
+    const letterbox_pad& pad_value = {0},
+    yuv_matrix matrix = yuv_matrix::bt601,
+    yuv_range range = yuv_range::limited);
+
+/*!
+ * \brief Letterbox-resize an NV12 image and convert it to a normalized 3-channel planar blob in one pass (return version).
+ * \param nv12 Input NV12 data: the image_width x image_height luma plane followed by the interleaved UV plane, subsampled 2x2
+ * \param image_width Width of the input image in pixels
+ * \param image_height Height of the input image in pixels
+ * \param target_width Width of the blob planes
+ * \param target_height Height of the blob planes
+ * \param scale_factor Scaling factor applied to pixel values, defaults to 1.0/255.0
+ * \param mean Vector of mean values to subtract from each channel, defaults to {0.0, 0.0, 0.0}
+ * \param swapRB_channels Whether to produce BGR planes instead of RGB, defaults to false
+ * \param std_dev Vector of standard deviations dividing each channel after mean subtraction, defaults to {} (no division)
+ * \param pad_value Padding color in RGB, either a single value for all channels or one value per channel, defaults to {0}
+ * \param matrix Color matrix of the input, defaults to yuv_matrix::bt601
+ * \param range Value range of the input, defaults to yuv_range::limited
+ * \return Tensor containing the CHW blob data, with shape {3, target_height, target_width}
+ * \throws std::runtime_error if nv12 does not match the image size, pad_value has neither 1 nor 3 components
+ * or a standard deviation is zero
+ */
+tensor<float> nv12_letterbox_blob(
+    const std::vector<std::uint8_t>& nv12,
+    int image_width,
+    int image_height,
+    int target_width,
+    int target_height,
+    float scale_factor = 1.0f / 255.0f,
+    const std::vector<float>& mean = {0.0f, 0.0f, 0.0f},
+    bool swapRB_channels = false,
+    const std::vector<float>& std_dev = {},
+    const letterbox_pad& pad_value = {0},
+    yuv_matrix matrix = yuv_matrix::bt601,
+    yuv_range range = yuv_range::limited);
+
+/*!
+ * \brief Convert a batch of images into one contiguous NCHW blob (in-place version).
+ * \param images Input images as (data, width, height, channels) tuples, as returned by image_load; all of them must have the same size
+ * \param batch Output vector storing the images one after the other ([N, C, H, W] layout), resized to images.size() * channels * height * width if needed
+ * \param scale_factor Scaling factor applied to pixel values, defaults to 1.0/255.0
+ * \param mean Vector of mean values to subtract from each channel, defaults to {0.0, 0.0, 0.0}
+ * \param swapRB_channels Whether to swap red and blue channels (RGB to BGR conversion), defaults to false
+ * \param std_dev Vector of standard deviations dividing each channel after mean subtraction, defaults to {} (no division)
+ * \param exec Executor running the conversion, defaults to default_executor()
+ * \throws std::runtime_error if the images differ in size, an image has not width * height * channels bytes, a standard deviation is zero
+ * or swapRB_channels is set for images with less than 3 channels
+ *
+ * Each slot of the batch holds the same values as create_blob for that image. Sizes are validated once up front,
+ * then the rows of all the images are split across the executor threads, writing straight into the batch buffer.
+ */
+void create_blob_batch(
+    std::span<const std::tuple<std::vector<std::uint8_t>, int, int, int>> images,
+    std::vector<float>& batch,
+    float scale_factor = 1.0f / 255.0f,
+    const std::vector<float>& mean = {0.0f, 0.0f, 0.0f},
+    bool swapRB_channels = false,
+    const std::vector<float>& std_dev = {},
+    executor& exec = default_executor());
+
+/*!
+ * \brief Convert a batch of images into one contiguous NCHW blob (return version).
+ * \param images Input images as (data, width, height, channels) tuples, as returned by image_load; all of them must have the same size
+ * \param scale_factor Scaling factor applied to pixel values, defaults to 1.0/255.0
+ * \param mean Vector of mean values to subtract from each channel, defaults to {0.0, 0.0, 0.0}
+ * \param swapRB_channels Whether to swap red and blue channels (RGB to BGR conversion), defaults to false
+ * \param std_dev Vector of standard deviations dividing each channel after mean subtraction, defaults to {} (no division)
+ * \param exec Executor running the conversion, defaults to default_executor()
+ * \return Tensor containing the images one after the other, with shape {images.size(), channels, height, width}
+ * \throws std::runtime_error if the images differ in size, an image has not width * height * channels bytes, a standard deviation is zero
+ * or swapRB_channels is set for images with less than 3 channels
+ */
+tensor<float> create_blob_batch(
+    std::span<const std::tuple<std::vector<std::uint8_t>, int, int, int>> images,
+    float scale_factor = 1.0f / 255.0f,
+    const std::vector<float>& mean = {0.0f, 0.0f, 0.0f},
+    bool swapRB_channels = false,
+    const std::vector<float>& std_dev = {},
+    executor& exec = default_executor());
+
+/*!
+ * \brief Crop multiple regions of an image and resize them into one batched blob (in-place version).
+ * \param image Input image data vector
+ * \param width Width of the input image in pixels
+ * \param height Height of the input image in pixels
+ * \param channels Number of color channels in the input image
+ * \param boxes Regions to extract, each one as {x, y, width, height} in input image pixels
+ * \param target_width Width of each resized crop in the blob
+ * \param target_height Height of each resized crop in the blob
+ * \param batch Output vector storing the crops as a contiguous NCHW blob, resized to boxes.size() * channels * target_height * target_width if needed
+ * \param scale_factor Scaling factor applied to pixel values, defaults to 1.0/255.0
+ * \param mean Vector of mean values to subtract from each channel, defaults to {0.0, 0.0, 0.0}
+ * \param swapRB_channels Whether to swap red and blue channels (RGB to BGR conversion), defaults to false
+ * \param std_dev Vector of standard deviations dividing each channel after mean subtraction, defaults to {} (no division)
+ * \param exec Executor running the regions, defaults to default_executor()
+ * \throws std::runtime_error if the target size is negative, a box has an empty size, a standard deviation is zero
+ * or swapRB_channels is set for images with less than 3 channels
+ *
+ * Each region is stretched to the target size with bilinear interpolation, sampling the input image directly without intermediate crop buffers.
+ * Regions may extend past the image borders, in which case border pixels are replicated.
+ * Pixels are normalized as in create_blob and regions are processed in parallel.
+ */
+void crop_resize_batch(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    const std::vector<std::array<int, 4>>& boxes,
+    int target_width,
+    int target_height,
+    std::vector<float>& batch,
+    float scale_factor = 1.0f / 255.0f,
+    const std::vector<float>& mean = {0.0f, 0.0f, 0.0f},
+    bool swapRB_channels = false,
+    const std::vector<float>& std_dev = {},
+    executor& exec = default_executor());
+
+/*!
+ * \brief Crop multiple regions of an image and resize them into one batched blob (return version).
+ * \param image Input image data vector
+ * \param width Width of the input image in pixels
+ * \param height Height of the input image in pixels
+ * \param channels Number of color channels in the input image
+ * \param boxes Regions to extract, each one as {x, y, width, height} in input image pixels
+ * \param target_width Width of each resized crop in the blob
+ * \param target_height Height of each resized crop in the blob
+ * \param scale_factor Scaling factor applied to pixel values, defaults to 1.0/255.0
+ * \param mean Vector of mean values to subtract from each channel, defaults to {0.0, 0.0, 0.0}
+ * \param swapRB_channels Whether to swap red and blue channels (RGB to BGR conversion), defaults to false
+ * \param std_dev Vector of standard deviations dividing each channel after mean subtraction, defaults to {} (no division)
+ * \param exec Executor running the regions, defaults to default_executor()
+ * \return Tensor containing the crops as a contiguous NCHW blob, with shape {boxes.size(), channels, target_height, target_width}
+ * \throws std::runtime_error if the target size is negative, a box has an empty size, a standard deviation is zero
+ * or swapRB_channels is set for images with less than 3 channels
+ */
+tensor<float> crop_resize_batch(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    const std::vector<std::array<int, 4>>& boxes,
+    int target_width,
+    int target_height,
+    float scale_factor = 1.0f / 255.0f,
+    const std::vector<float>& mean = {0.0f, 0.0f, 0.0f},
+    bool swapRB_channels = false,
+    const std::vector<float>& std_dev = {},
+    executor& exec = default_executor());
+
+/*!
+ * \brief Convert a blob back to an interleaved uint8 image, inverting create_blob (in-place version).
+ * \tparam Blob Contiguous range of float, float16 or bfloat16 values, such as std::vector or tensor
+ * \param blob Input blob, with channels * height * width values
+ * \param width Width of the image in pixels
+ * \param height Height of the image in pixels
+ * \param channels Number of color channels of the image
+ * \param image Output image data, resized to channels * height * width bytes
+ * \param scale_factor Scaling factor the blob was created with, defaults to 1.0/255.0
+ * \param mean Vector of mean values the blob was created with, defaults to {0.0, 0.0, 0.0}
+ * \param swapRB_channels Whether to swap red and blue channels (BGR to RGB conversion), defaults to false
+ * \param std_dev Vector of standard deviations the blob was created with, defaults to {} (no division)
+ * \param layout Memory layout of the blob, defaults to blob_layout::nchw
+ * \throws std::runtime_error if the blob has not channels * height * width values, the scale factor or a standard deviation is zero,
+ * or swapRB_channels is set for images with less than 3 channels
+ *
+ * Each pixel is round((blob[c] * std_dev[c] + mean[c]) / scale_factor) saturated to [0, 255], so that model outputs
+ * such as super-resolution or segmentation tensors can be passed to image_save. NaNs become 0.
+ * The conversion rounds and saturates with SIMD pack instructions and re-interleaves the planes of NCHW blobs.
+ */
+template <typename Blob>
+    requires detail::is_image_blob_v<Blob>
+void blob_to_image(
+    const Blob& blob,
+    int width,
+    int height,
+    int channels,
+    std::vector<std::uint8_t>& image,
+    float scale_factor = 1.0f / 255.0f,
+    const std::vector<float>& mean = {0.0f, 0.0f, 0.0f},
+    bool swapRB_channels = false,
+    const std::vector<float>& std_dev = {},
+    blob_layout layout = blob_layout::nchw)
+{
+    detail::blob_to_image_kernel(std::ranges::data(blob), std::ranges::size(blob), width, height, channels, std::span(&image, 1), scale_factor, mean, swapRB_channels, std_dev, layout, default_executor());
+}
+
+/*!
+ * \brief Convert a blob back to an interleaved uint8 image, inverting create_blob (return version).
+ * \tparam Blob Contiguous range of float, float16 or bfloat16 values, such as std::vector or tensor
+ * \param blob Input blob, with channels * height * width values
+ * \param width Width of the image in pixels
+ * \param height Height of the image in pixels
+ * \param channels Number of color channels of the image
+ * \param scale_factor Scaling factor the blob was created with, defaults to 1.0/255.0
+ * \param mean Vector of mean values the blob was created with, defaults to {0.0, 0.0, 0.0}
+ * \param swapRB_channels Whether to swap red and blue channels (BGR to RGB conversion), defaults to false
+ * \param std_dev Vector of standard deviations the blob was created with, defaults to {} (no division)
+ * \param layout Memory layout of the blob, defaults to blob_layout::nchw
+ * \return Interleaved image data, with channels * height * width bytes
+ * \throws std::runtime_error if the blob has not channels * height * width values, the scale factor or a standard deviation is zero,
+ * or swapRB_channels is set for images with less than 3 channels
+ */
+template <typename Blob>
+    requires detail::is_image_blob_v<Blob>
+std::vector<std::uint8_t> blob_to_image(
+    const Blob& blob,
+    int width,
+    int height,
+    int channels,
+    float scale_factor = 1.0f / 255.0f,
+    const std::vector<float>& mean = {0.0f, 0.0f, 0.0f},
+    bool swapRB_channels = false,
+    const std::vector<float>& std_dev = {},
+    blob_layout layout = blob_layout::nchw)
+{
+    std::vector<std::uint8_t> image;
+    blob_to_image(blob, width, height, channels, image, scale_factor, mean, swapRB_channels, std_dev, layout);
+    return image;
+}
+
+/*!
+ * \brief Convert a batched blob back to interleaved uint8 images, inverting create_blob_batch (in-place version).
+ * \tparam Blob Contiguous range of float, float16 or bfloat16 values, such as std::vector or tensor
+ * \param batch Input blob storing the images one after the other, with N * channels * height * width values
+ * \param width Width of each image in pixels
+ * \param height Height of each image in pixels
+ * \param channels Number of color channels of each image
+ * \param images Output images, resized to N images of channels * height * width bytes
+ * \param scale_factor Scaling factor the blob was created with, defaults to 1.0/255.0
+ * \param mean Vector of mean values the blob was created with, defaults to {0.0, 0.0, 0.0}
+ * \param swapRB_channels Whether to swap red and blue channels (BGR to RGB conversion), defaults to false
+ * \param std_dev Vector of standard deviations the blob was created with, defaults to {} (no division)
+ * \param layout Memory layout of each image in the blob, defaults to blob_layout::nchw
+ * \param exec Executor running the conversion, defaults to default_executor()
+ * \throws std::runtime_error if the batch size is not a multiple of channels * height * width, the scale factor or a standard deviation is zero,
+ * or swapRB_channels is set for images with less than 3 channels
+ *
+ * Each image holds the same values as blob_to_image on its slot of the batch. The rows of all the images are split across the executor threads.
+ */
+template <typename Blob>
+    requires detail::is_image_blob_v<Blob>
+void blob_to_image_batch(
+    const Blob& batch,
+    int width,
+    int height,
+    int channels,
+    std::vector<std::vector<std::uint8_t>>& images,
+    float scale_factor = 1.0f / 255.0f,
+    const std::vector<float>& mean = {0.0f, 0.0f, 0.0f},
+    bool swapRB_channels = false,
+    const std::vector<float>& std_dev = {},
+    blob_layout layout = blob_layout::nchw,
+    executor& exec = default_executor())
+{
+    const std::size_t image_size = static_cast<std::size_t>(std::max(width, 0)) * std::max(height, 0) * std::max(channels, 0);
+    images.resize(image_size == 0 ? 0 : std::ranges::size(batch) / image_size);
+    detail::blob_to_image_kernel(std::ranges::data(batch), std::ranges::size(batch), width, height, channels, images, scale_factor, mean, swapRB_channels, std_dev, layout, exec);
+}
+
+/*!
+ * \brief Convert a batched blob back to interleaved uint8 images, inverting create_blob_batch (return version).
+ * \tparam Blob Contiguous range of float, float16 or bfloat16 values, such as std::vector or tensor
+ * \param batch Input blob storing the images one after the other, with N * channels * height * width values
+ * \param width Width of each image in pixels
+ * \param height Height of each image in pixels
+ * \param channels Number of color channels of each image
+ * \param scale_factor Scaling factor the blob was created with, defaults to 1.0/255.0
+ * \param mean Vector of mean values the blob was created with, defaults to {0.0, 0.0, 0.0}
+ * \param swapRB_channels Whether to swap red and blue channels (BGR to RGB conversion), defaults to false
+ * \param std_dev Vector of standard deviations the blob was created with, defaults to {} (no division)
+ * \param layout Memory layout of each image in the blob, defaults to blob_layout::nchw
+ * \param exec Executor running the conversion, defaults to default_executor()
+ * \return The N images of the batch, each one with channels * height * width bytes
+ * \throws std::runtime_error if the batch size is not a multiple of channels * height * width, the scale factor or a standard deviation is zero,
+ * or swapRB_channels is set for images with less than 3 channels
+ */
+template <typename Blob>
+    requires detail::is_image_blob_v<Blob>
+std::vector<std::vector<std::uint8_t>> blob_to_image_batch(
+    const Blob& batch,
+    int width,
+    int height,
+    int channels,
+    float scale_factor = 1.0f / 255.0f,
+    const std::vector<float>& mean = {0.0f, 0.0f, 0.0f},
+    bool swapRB_channels = false,
+    const std::vector<float>& std_dev = {},
+    blob_layout layout = blob_layout::nchw,
+    executor& exec = default_executor())
+{
+    std::vector<std::vector<std::uint8_t>> images;
+    blob_to_image_batch(batch, width, height, channels, images, scale_factor, mean, swapRB_channels, std_dev, layout, exec);
+    return images;
+}
+
 }
@@ -0,0 +1,112 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace tc::img
+{
+/*!
+ * \struct image_pyramid_level
+ * \brief Location and size of a single level inside an image_pyramid buffer.
+ */
+struct image_pyramid_level
+{
+    std::size_t offset; //!< Offset in bytes of the first pixel of the level inside image_pyramid::data
+    int width;          //!< Width of the level in pixels
+    int height;         //!< Height of the level in pixels
+};
+
+/*!
+ * \struct image_pyramid
+ * \brief Multi-scale representation of an image, with all the levels stored in one contiguous allocation.
+ *
+ * Level 0 is a copy of the source image, each following level is downscaled from the previous one.
+ * Every level is stored as interleaved pixels with the same number of channels as the source image.
+ */
+struct image_pyramid
+{
+    /*!
+     * \brief Get a pointer to the first pixel of a level.
+     * \param level Index of the level, 0 being the full resolution image
+     * \return Pointer to the level pixel data inside the pyramid buffer
+     */
+    const std::uint8_t* level_data(std::size_t level) const;
+
+    /*!
+     * \brief Get a mutable pointer to the first pixel of a level.
+     * \param level Index of the level, 0 being the full resolution image
+     * \return Pointer to the level pixel data inside the pyramid buffer
+     */
+    std::uint8_t* level_data(std::size_t level);
+
+    /*!
+     * \brief Get the size in bytes of a level.
+     * \param level Index of the level, 0 being the full resolution image
+     * \return Number of bytes occupied by the level (width * height * channels)
+     */
+    std::size_t level_size(std::size_t level) const;
+
+    std::vector<std::uint8_t> data;           //!< Pixel data of all the levels, stored one after the other
+    std::vector<image_pyramid_level> levels;  //!< Per level offsets and dimensions
+    int channels = 0;                         //!< Number of color channels of every level
+};
+
+/*!
+ * \brief Build a multi-scale image pyramid, storing result in provided pyramid (buffers are reused when possible).
+ * \param image Input image data vector
+ * \param image_width Width of the input image in pixels
+ * \param image_height Height of the input image in pixels
+ * \param image_channels Number of color channels in the input image
+ * \param levels Number of levels to generate, including the full resolution one
+ * \param scale_factor Ratio between the size of a level and the size of the previous one, in the range (0, 1)
+ * \param pyramid Output pyramid
+ * \throws std::runtime_error if the image size is not positive, image does not hold image_width * image_height * image_channels bytes, levels is lower than 1 or scale_factor is outside (0, 1)
+ *
+ * Each level is derived from the previous one instead of the full resolution image.
+ * Levels that are exactly half the size of the previous one use a 2x2 box average, the others use bilinear interpolation.
+ * Generation stops early if a level would be smaller than 1x1, so the pyramid can hold fewer than the requested levels.
+ */
+void build_image_pyramid(
+    const std::vector<std::uint8_t>& image,
+    int image_width,
+    int image_height,
+    int image_channels,
+    int levels,
+    double scale_factor,
+    image_pyramid& pyramid);
+
+/*!
+ * \brief Build a multi-scale image pyramid, returning result as new pyramid.
+ * \param image Input image data vector
+ * \param image_width Width of the input image in pixels
+ * \param image_height Height of the input image in pixels
+ * \param image_channels Number of color channels in the input image
+ * \param levels Number of levels to generate, including the full resolution one
+ * \param scale_factor Ratio between the size of a level and the size of the previous one, in the range (0, 1), defaults to 0.5
+ * \return Pyramid containing all the generated levels
+ * \throws std::runtime_error if the image size is not positive, image does not hold image_width * image_height * image_channels bytes, levels is lower than 1 or scale_factor is outside (0, 1)
+ */
+image_pyramid build_image_pyramid(
+    const std::vector<std::uint8_t>& image,
+    int image_width,
+    int image_height,
+    int image_channels,
+    int levels,
+    double scale_factor = 0.5);
+
+}
@@ -14,11 +14,84 @@
 
 #pragma once
 
+#include <teiacare/image/basic_image.hpp>
+
 #include <cstdint>
+#include <initializer_list>
+#include <span>
+#include <tuple>
 #include <vector>
 
 namespace tc::img
 {
+/*!
+ * \class letterbox_pad
+ * \brief Value of the letterbox padding, either a single value for all channels or one value per channel (e.g. {114, 114, 114}).
+ *
+ * The pad value has its own type rather than being a std::vector, so a named pad value can never bind to the output vector of an in-place overload.
+ */
+class letterbox_pad
+{
+public:
+    /*!
+     * \brief Construct the pad value from a braced list of components.
+     * \param values Pad components
+     */
+    letterbox_pad(std::initializer_list<std::uint8_t> values)
+        : _values{values}
+    {
+    }
+
+    /*!
+     * \brief Construct the pad value from a contiguous range of components.
+     * \param values Pad components
+     */
+    explicit letterbox_pad(std::span<const std::uint8_t> values)
+        : _values(values.begin(), values.end())
+    {
+    }
+
+    /*!
+     * \brief Get the number of pad components.
+     * \return Number of components
+     */
+    std::size_t size() const noexcept
+    {
+        return _values.size();
+    }
+
+    /*!
+     * \brief Access a pad component.
+     * \param index Component index
+     * \return Component value
+     */
+    std::uint8_t operator[](std::size_t index) const noexcept
+    {
+        return _values[index];
+    }
+
+    /*!
+     * \brief Get an iterator to the first pad component.
+     * \return Iterator to the first component
+     */
+    std::vector<std::uint8_t>::const_iterator begin() const noexcept
+    {
+        return _values.begin();
+    }
+
+    /*!
+     * \brief Get an iterator past the last pad component.
+     * \return Iterator past the last component
+     */
+    std::vector<std::uint8_t>::const_iterator end() const noexcept
+    {
+        return _values.end();
+    }
+
+private:
+    std::vector<std::uint8_t> _values; //!< Pad components
+};
+
 /*!
  * \brief Resize an image while maintaining aspect ratio, storing result in provided vector.
  * \param image Input image data vector
@@ -27,7 +100,12 @@ namespace tc::img
  * \param image_channels Number of color channels in the input image
  * \param target_width Target width for the resized image
  * \param target_height Target height for the resized image
- * \param resized_image Output vector to store the resized image data
+ * \param resized_image Output vector to store the resized image data, resized to target_width * target_height * image_channels if needed
+ * \param pad_value Value of the letterbox padding, either a single value for all channels or one value per channel (e.g. {114, 114, 114}), defaults to {0}
+ * \throws std::runtime_error if pad_value has neither 1 nor image_channels components
+ *
+ * Every output byte is written exactly once: the padding bands are filled explicitly, so a reused output buffer never keeps stale content.
+ * Sampling tables are cached per thread, so repeated resizes with the same geometry skip their computation.
  */
 void image_resize_aspect_ratio(
     const std::vector<std::uint8_t>& image,
@@ -36,7 +114,8 @@ void image_resize_aspect_ratio(
     int image_channels,
     int target_width,
     int target_height,
-    std::vector<std::uint8_t>& resized_image);
+    std::vector<std::uint8_t>& resized_image,
+    const letterbox_pad& pad_value = {0});
 
 /*!
  * \brief Resize an image while maintaining aspect ratio, returning result as new vector.
@@ -46,9 +125,80 @@ void image_resize_aspect_ratio(
  * \param image_channels Number of color channels in the input image
  * \param target_width Target width for the resized image
  * \param target_height Target height for the resized image
+ * \param pad_value Value of the letterbox padding, either a single value for all channels or one value per channel (e.g. {114, 114, 114}), defaults to {0}
  * \return Vector containing the resized image data
+ * \throws std::runtime_error if pad_value has neither 1 nor image_channels components
  */
 std::vector<std::uint8_t> image_resize_aspect_ratio(
+    const std::vector<std::uint8_t>& image,
+    int image_width,
+    int image_height,
+    int image_channels,
+    int target_width,
+    int target_height,
+    const letterbox_pad& pad_value = {0});
+
+/*!
+ * \brief Resize an image view while maintaining aspect ratio, writing the result to a writable view.
+ * \param image Input image view, possibly a crop of a larger image or a buffer with padded rows
+ * \param resized_image Output view, whose size is the target size and whose channel count must match the input
+ * \param pad_value Value of the letterbox padding, either a single value for all channels or one value per channel (e.g. {114, 114, 114}), defaults to {0}
+ * \throws std::runtime_error if the channel counts differ or pad_value has neither 1 nor image channels components
+ *
+ * Rows are read and written through the strides of both views, so crops and external buffers are resized without intermediate copies.
+ */
+void image_resize_aspect_ratio(
+    image_view image,
+    image_span resized_image,
+    const letterbox_pad& pad_value = {0});
+
+/*!
+ * \brief Resize an image view while maintaining aspect ratio, returning result as new image.
+ * \param image Input image view, possibly a crop of a larger image or a buffer with padded rows
+ * \param target_width Target width for the resized image
+ * \param target_height Target height for the resized image
+ * \param pad_value Value of the letterbox padding, either a single value for all channels or one value per channel (e.g. {114, 114, 114}), defaults to {0}
+ * \return Image containing the resized image data
+ * \throws std::runtime_error if the target size is negative or pad_value has neither 1 nor image channels components
+ */
+image image_resize_aspect_ratio(
+    image_view image,
+    int target_width,
+    int target_height,
+    const letterbox_pad& pad_value = {0});
+
+/*!
+ * \brief Resize an image to the target size ignoring its aspect ratio, storing result in provided vector.
+ * \param image Input image data vector
+ * \param image_width Width of the input image in pixels
+ * \param image_height Height of the input image in pixels
+ * \param image_channels Number of color channels in the input image
+ * \param target_width Target width for the resized image
+ * \param target_height Target height for the resized image
+ * \param resized_image Output vector to store the resized image data, resized to target_width * target_height * image_channels if needed
+ * \throws std::runtime_error if image_width or image_height is not positive
+ */
+void image_resize_stretch(
+    const std::vector<std::uint8_t>& image,
+    int image_width,
+    int image_height,
+    int image_channels,
+    int target_width,
+    int target_height,
+    std::vector<std::uint8_t>& resized_image);
+
+/*!
+ * \brief Resize an image to the target size ignoring its aspect ratio, returning result as new vector.
+ * \param image Input image data vector
+ * \param image_width Width of the input image in pixels
+ * \param image_height Height of the input image in pixels
+ * \param image_channels Number of color channels in the input image
+ * \param target_width Target width for the resized image
+ * \param target_height Target height for the resized image
+ * \return Vector containing the resized image data
+ * \throws std::runtime_error if image_width or image_height is not positive
+ */
+std::vector<std::uint8_t> image_resize_stretch(
     const std::vector<std::uint8_t>& image,
     int image_width,
     int image_height,
@@ -56,4 +206,87 @@ std::vector<std::uint8_t> image_resize_aspect_ratio(
     int target_width,
     int target_height);
 
+/*!
+ * \brief Resize an image so that its shorter side matches resize_size, then take a centered crop, storing result in provided vector.
+ * \param image Input image data vector
+ * \param image_width Width of the input image in pixels
+ * \param image_height Height of the input image in pixels
+ * \param image_channels Number of color channels in the input image
+ * \param resize_size Size of the shorter side of the image after resizing (e.g. 256)
+ * \param crop_width Width of the centered crop (e.g. 224)
+ * \param crop_height Height of the centered crop (e.g. 224)
+ * \param resized_image Output vector to store the cropped image data, resized to crop_width * crop_height * image_channels if needed
+ * \param pad_value Value used where the crop is larger than the resized image, either a single value for all channels or one value per channel, defaults to {0}
+ * \throws std::runtime_error if image_width, image_height or resize_size is not positive or pad_value has neither 1 nor image_channels components
+ *
+ * The resized image is never materialized: only the source pixels that land inside the crop are sampled.
+ */
+void image_resize_center_crop(
+    const std::vector<std::uint8_t>& image,
+    int image_width,
+    int image_height,
+    int image_channels,
+    int resize_size,
+    int crop_width,
+    int crop_height,
+    std::vector<std::uint8_t>& resized_image,
+    const letterbox_pad& pad_value = {0});
+
+/*!
+ * \brief Resize an image so that its shorter side matches resize_size, then take a centered crop, returning result as new vector.
+ * \param image Input image data vector
+ * \param image_width Width of the input image in pixels
+ * \param image_height Height of the input image in pixels
+ * \param image_channels Number of color channels in the input image
+ * \param resize_size Size of the shorter side of the image after resizing (e.g. 256)
+ * \param crop_width Width of the centered crop (e.g. 224)
+ * \param crop_height Height of the centered crop (e.g. 224)
+ * \param pad_value Value used where the crop is larger than the resized image, either a single value for all channels or one value per channel, defaults to {0}
+ * \return Vector containing the cropped image data
+ * \throws std::runtime_error if image_width, image_height or resize_size is not positive or pad_value has neither 1 nor image_channels components
+ */
+std::vector<std::uint8_t> image_resize_center_crop(
+    const std::vector<std::uint8_t>& image,
+    int image_width,
+    int image_height,
+    int image_channels,
+    int resize_size,
+    int crop_width,
+    int crop_height,
+    const letterbox_pad& pad_value = {0});
+
+/*!
+ * \brief Resize a batch of images while maintaining aspect ratio into one contiguous buffer, storing result in provided vector.
+ * \param images Input images as (data, width, height, channels) tuples, as returned by image_load; sizes may differ but channels must match
+ * \param target_width Target width for each resized image
+ * \param target_height Target height for each resized image
+ * \param resized_batch Output vector storing the resized images one after the other ([N, H, W, C] layout), resized to images.size() * target_width * target_height * channels if needed
+ * \param pad_value Value of the letterbox padding, either a single value for all channels or one value per channel, defaults to {0}
+ * \throws std::runtime_error if the images have different channel counts or pad_value has neither 1 nor channels components
+ *
+ * Each image produces the same output as image_resize_aspect_ratio. Images are processed in parallel,
+ * and images with the same size share one cached sampling plan.
+ */
+void image_resize_aspect_ratio_batch(
+    std::span<const std::tuple<std::vector<std::uint8_t>, int, int, int>> images,
+    int target_width,
+    int target_height,
+    std::vector<std::uint8_t>& resized_batch,
+    const letterbox_pad& pad_value = {0});
+
+/*!
+ * \brief Resize a batch of images while maintaining aspect ratio into one contiguous buffer, returning result as new vector.
+ * \param images Input images as (data, width, height, channels) tuples, as returned by image_load; sizes may differ but channels must match
+ * \param target_width Target width for each resized image
+ * \param target_height Target height for each resized image
+ * \param pad_value Value of the letterbox padding, either a single value for all channels or one value per channel, defaults to {0}
+ * \return Vector containing the resized images one after the other ([N, H, W, C] layout)
+ * \throws std::runtime_error if the images have different channel counts or pad_value has neither 1 nor channels components
+ */
+std::vector<std::uint8_t> image_resize_aspect_ratio_batch(
+    std::span<const std::tuple<std::vector<std::uint8_t>, int, int, int>> images,
+    int target_width,
+    int target_height,
+    const letterbox_pad& pad_value = {0});
+
 }
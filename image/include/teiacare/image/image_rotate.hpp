@@ -0,0 +1,217 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace tc::img
+{
+/*!
+ * \brief Mirror an image around its vertical axis, storing result in provided vector.
+ * \param image Input image data vector
+ * \param width Width of the input image in pixels
+ * \param height Height of the input image in pixels
+ * \param channels Number of color channels in the input image
+ * \param flipped_image Output vector to store the flipped image data, resized to width * height * channels if needed
+ *
+ * flipped_image may be the same vector as image, in which case the image is processed in place.
+ */
+void flip_horizontal(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    std::vector<std::uint8_t>& flipped_image);
+
+/*!
+ * \brief Mirror an image around its vertical axis, returning result as new vector.
+ * \param image Input image data vector
+ * \param width Width of the input image in pixels
+ * \param height Height of the input image in pixels
+ * \param channels Number of color channels in the input image
+ * \return Vector containing the flipped image data
+ */
+std::vector<std::uint8_t> flip_horizontal(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels);
+
+/*!
+ * \brief Mirror an image around its horizontal axis, storing result in provided vector.
+ * \param image Input image data vector
+ * \param width Width of the input image in pixels
+ * \param height Height of the input image in pixels
+ * \param channels Number of color channels in the input image
+ * \param flipped_image Output vector to store the flipped image data, resized to width * height * channels if needed
+ *
+ * flipped_image may be the same vector as image, in which case the image is processed in place.
+ */
+void flip_vertical(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    std::vector<std::uint8_t>& flipped_image);
+
+/*!
+ * \brief Mirror an image around its horizontal axis, returning result as new vector.
+ * \param image Input image data vector
+ * \param width Width of the input image in pixels
+ * \param height Height of the input image in pixels
+ * \param channels Number of color channels in the input image
+ * \return Vector containing the flipped image data
+ */
+std::vector<std::uint8_t> flip_vertical(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels);
+
+/*!
+ * \brief Rotate an image by 90 degrees clockwise, storing result in provided vector.
+ * \param image Input image data vector
+ * \param width Width of the input image in pixels
+ * \param height Height of the input image in pixels
+ * \param channels Number of color channels in the input image
+ * \param rotated_image Output vector to store the rotated image data, resized to height * width * channels if needed
+ *
+ * The rotated image is height pixels wide and width pixels high.
+ * rotated_image may be the same vector as image: square images are then processed in place, other sizes go through a temporary copy.
+ */
+void rotate90(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    std::vector<std::uint8_t>& rotated_image);
+
+/*!
+ * \brief Rotate an image by 90 degrees clockwise, returning result as new vector.
+ * \param image Input image data vector
+ * \param width Width of the input image in pixels
+ * \param height Height of the input image in pixels
+ * \param channels Number of color channels in the input image
+ * \return Vector containing the rotated image data
+ *
+ * The rotated image is height pixels wide and width pixels high.
+ */
+std::vector<std::uint8_t> rotate90(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels);
+
+/*!
+ * \brief Rotate an image by 180 degrees, storing result in provided vector.
+ * \param image Input image data vector
+ * \param width Width of the input image in pixels
+ * \param height Height of the input image in pixels
+ * \param channels Number of color channels in the input image
+ * \param rotated_image Output vector to store the rotated image data, resized to width * height * channels if needed
+ *
+ * rotated_image may be the same vector as image, in which case the image is processed in place.
+ */
+void rotate180(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    std::vector<std::uint8_t>& rotated_image);
+
+/*!
+ * \brief Rotate an image by 180 degrees, returning result as new vector.
+ * \param image Input image data vector
+ * \param width Width of the input image in pixels
+ * \param height Height of the input image in pixels
+ * \param channels Number of color channels in the input image
+ * \return Vector containing the rotated image data
+ */
+std::vector<std::uint8_t> rotate180(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels);
+
+/*!
+ * \brief Rotate an image by 270 degrees clockwise (90 degrees counter-clockwise), storing result in provided vector.
+ * \param image Input image data vector
+ * \param width Width of the input image in pixels
+ * \param height Height of the input image in pixels
+ * \param channels Number of color channels in the input image
+ * \param rotated_image Output vector to store the rotated image data, resized to height * width * channels if needed
+ *
+ * The rotated image is height pixels wide and width pixels high.
+ * rotated_image may be the same vector as image: square images are then processed in place, other sizes go through a temporary copy.
+ */
+void rotate270(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    std::vector<std::uint8_t>& rotated_image);
+
+/*!
+ * \brief Rotate an image by 270 degrees clockwise (90 degrees counter-clockwise), returning result as new vector.
+ * \param image Input image data vector
+ * \param width Width of the input image in pixels
+ * \param height Height of the input image in pixels
+ * \param channels Number of color channels in the input image
+ * \return Vector containing the rotated image data
+ *
+ * The rotated image is height pixels wide and width pixels high.
+ */
+std::vector<std::uint8_t> rotate270(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels);
+
+/*!
+ * \brief Transpose an image, swapping its rows and columns, storing result in provided vector.
+ * \param image Input image data vector
+ * \param width Width of the input image in pixels
+ * \param height Height of the input image in pixels
+ * \param channels Number of color channels in the input image
+ * \param transposed_image Output vector to store the transposed image data, resized to height * width * channels if needed
+ *
+ * The transposed image is height pixels wide and width pixels high.
+ * transposed_image may be the same vector as image: square images are then processed in place, other sizes go through a temporary copy.
+ */
+void transpose(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    std::vector<std::uint8_t>& transposed_image);
+
+/*!
+ * \brief Transpose an image, swapping its rows and columns, returning result as new vector.
+ * \param image Input image data vector
+ * \param width Width of the input image in pixels
+ * \param height Height of the input image in pixels
+ * \param channels Number of color channels in the input image
+ * \return Vector containing the transposed image data
+ *
+ * The transposed image is height pixels wide and width pixels high.
+ */
+std::vector<std::uint8_t> transpose(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels);
+
+}
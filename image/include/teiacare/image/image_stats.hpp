@@ -0,0 +1,83 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace tc::img
+{
+/*!
+ * \struct channel_stats
+ * \brief Statistics of the values of one image channel.
+ */
+struct channel_stats
+{
+    std::uint64_t count = 0;                    //!< Number of values
+    std::uint64_t sum = 0;                      //!< Sum of the values
+    std::uint64_t sum_squares = 0;              //!< Sum of the squared values
+    std::uint8_t min = 0;                       //!< Smallest value, 0 if count is 0
+    std::uint8_t max = 0;                       //!< Largest value, 0 if count is 0
+    std::array<std::uint64_t, 256> histogram{}; //!< Number of occurrences of each value
+
+    /*!
+     * \brief Mean of the values.
+     * \return sum / count, or 0 if count is 0
+     */
+    double mean() const;
+
+    /*!
+     * \brief Population variance of the values.
+     * \return sum_squares / count - mean^2, or 0 if count is 0
+     */
+    double variance() const;
+
+    /*!
+     * \brief Population standard deviation of the values.
+     * \return Square root of variance()
+     */
+    double std_dev() const;
+
+    /*!
+     * \brief Accumulate the statistics of other values, e.g. of another frame of a dataset.
+     * \param other Statistics to add
+     * \return Reference to this object
+     */
+    channel_stats& operator+=(const channel_stats& other);
+};
+
+/*!
+ * \brief Compute the per-channel statistics of an image in a single pass (in-place version).
+ * \param image Input interleaved image data
+ * \param channels Number of channels in the image
+ * \param stats Output statistics, resized to channels elements
+ * \throws std::runtime_error if channels is not positive or the size of image is not a multiple of channels
+ *
+ * The image is split in stripes processed concurrently, each thread filling its own partial histograms which are merged at the end.
+ * Sums, minimum and maximum are exact and derived from the merged histograms.
+ */
+void image_stats(const std::vector<std::uint8_t>& image, int channels, std::vector<channel_stats>& stats);
+
+/*!
+ * \brief Compute the per-channel statistics of an image in a single pass (return version).
+ * \param image Input interleaved image data
+ * \param channels Number of channels in the image
+ * \return Statistics of each channel
+ * \throws std::runtime_error if channels is not positive or the size of image is not a multiple of channels
+ */
+std::vector<channel_stats> image_stats(const std::vector<std::uint8_t>& image, int channels);
+
+}
@@ -0,0 +1,98 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <teiacare/image/image_warp.hpp>
+
+namespace tc::img
+{
+/*!
+ * \struct camera_intrinsics
+ * \brief Pinhole camera intrinsic parameters, in pixels.
+ */
+struct camera_intrinsics
+{
+    double fx = 1.0; //!< Focal length along the x axis
+    double fy = 1.0; //!< Focal length along the y axis
+    double cx = 0.0; //!< X coordinate of the principal point
+    double cy = 0.0; //!< Y coordinate of the principal point
+};
+
+/*!
+ * \struct brown_conrady_distortion
+ * \brief Radial and tangential lens distortion coefficients of the Brown-Conrady model (OpenCV ordering).
+ */
+struct brown_conrady_distortion
+{
+    double k1 = 0.0; //!< Second order radial coefficient
+    double k2 = 0.0; //!< Fourth order radial coefficient
+    double p1 = 0.0; //!< First tangential coefficient
+    double p2 = 0.0; //!< Second tangential coefficient
+    double k3 = 0.0; //!< Sixth order radial coefficient
+};
+
+/*!
+ * \struct fisheye_distortion
+ * \brief Distortion coefficients of the equidistant fisheye model, applied to the incidence angle theta.
+ */
+struct fisheye_distortion
+{
+    double k1 = 0.0; //!< Coefficient of theta^3
+    double k2 = 0.0; //!< Coefficient of theta^5
+    double k3 = 0.0; //!< Coefficient of theta^7
+    double k4 = 0.0; //!< Coefficient of theta^9
+};
+
+/*!
+ * \brief Build the remap plan undistorting images of a camera with Brown-Conrady lens distortion.
+ * \param camera Intrinsic parameters of the distorted camera
+ * \param distortion Distortion coefficients of the camera
+ * \param new_camera Intrinsic parameters of the undistorted output image, pass camera to keep the same projection
+ * \param target_width Width of the undistorted image
+ * \param target_height Height of the undistorted image
+ * \param interp Interpolation method, defaults to interpolation::bilinear
+ * \return Plan to be used with remap
+ * \throws std::runtime_error if a focal length of camera or new_camera is zero or not finite
+ *
+ * The lens model is evaluated once per output pixel when the plan is built, so undistorting each frame is a single remap pass.
+ */
+remap_plan make_undistort_remap_plan(
+    const camera_intrinsics& camera,
+    const brown_conrady_distortion& distortion,
+    const camera_intrinsics& new_camera,
+    int target_width,
+    int target_height,
+    interpolation interp = interpolation::bilinear);
+
+/*!
+ * \brief Build the remap plan undistorting images of a camera with equidistant fisheye lens distortion.
+ * \param camera Intrinsic parameters of the distorted camera
+ * \param distortion Distortion coefficients of the camera
+ * \param new_camera Intrinsic parameters of the undistorted output image, usually with a shorter focal length to keep the field of view
+ * \param target_width Width of the undistorted image
+ * \param target_height Height of the undistorted image
+ * \param interp Interpolation method, defaults to interpolation::bilinear
+ * \return Plan to be used with remap
+ * \throws std::runtime_error if a focal length of camera or new_camera is zero or not finite
+ */
+remap_plan make_undistort_remap_plan(
+    const camera_intrinsics& camera,
+    const fisheye_distortion& distortion,
+    const camera_intrinsics& new_camera,
+    int target_width,
+    int target_height,
+    interpolation interp = interpolation::bilinear);
+
+}
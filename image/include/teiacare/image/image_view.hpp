@@ -0,0 +1,212 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace tc::img
+{
+/*!
+ * \class basic_image_view
+ * \brief Non-owning view of an interleaved 8-bit image, whose rows may be separated by padding bytes.
+ * \tparam Byte Pixel byte type, const std::uint8_t for read-only views and std::uint8_t for writable ones
+ *
+ * A view is a pointer, a size, a channel count and a row stride in bytes, cheap to copy and to pass by value.
+ * Crops of larger images, rows padded for alignment and buffers owned by other libraries (decoders, camera drivers,
+ * inference runtimes) can be processed in place without first being copied to a tightly packed std::vector.
+ */
+template <typename Byte>
+class basic_image_view
+{
+    static_assert(std::is_same_v<std::remove_const_t<Byte>, std::uint8_t>, "image views hold 8-bit pixels");
+
+public:
+    /*!
+     * \brief Create an empty view.
+     */
+    basic_image_view() noexcept = default;
+
+    /*!
+     * \brief Create a view of an image buffer.
+     * \param data Pointer to the first byte of the top-left pixel
+     * \param width Width of the image in pixels
+     * \param height Height of the image in pixels
+     * \param channels Number of interleaved channels of each pixel
+     * \param stride Distance in bytes between the first bytes of consecutive rows, 0 (default) for tightly packed rows
+     * \throws std::runtime_error if the size is negative, channels is not positive, stride is lower than width * channels
+     * or data is null for a non-empty image
+     */
+    basic_image_view(Byte* data, int width, int height, int channels, std::size_t stride = 0)
+        : _data{data}
+        , _width{width}
+        , _height{height}
+        , _channels{channels}
+        , _stride{stride == 0 ? static_cast<std::size_t>(std::max(width, 0)) * std::max(channels, 0) : stride}
+    {
+        if (width < 0 || height < 0 || channels <= 0)
+        {
+            throw std::runtime_error("Invalid image view size: " + std::to_string(width) + "x" + std::to_string(height) + "x" + std::to_string(channels));
+        }
+        if (_stride < row_size())
+        {
+            throw std::runtime_error("Invalid image view stride: " + std::to_string(_stride) + " bytes, expected at least " + std::to_string(row_size()));
+        }
+        if (!data && width > 0 && height > 0)
+        {
+            throw std::runtime_error("Invalid image view: null data for a " + std::to_string(width) + "x" + std::to_string(height) + " image");
+        }
+    }
+
+    /*!
+     * \brief Create a view of a tightly packed image stored in a vector.
+     * \param data Vector holding width * height * channels bytes
+     * \param width Width of the image in pixels
+     * \param height Height of the image in pixels
+     * \param channels Number of interleaved channels of each pixel
+     * \throws std::runtime_error if the vector size does not match the image size
+     */
+    template <typename Vector>
+        requires std::is_same_v<std::remove_const_t<Vector>, std::vector<std::uint8_t>> && (std::is_const_v<Byte> || !std::is_const_v<Vector>)
+    basic_image_view(Vector& data, int width, int height, int channels)
+        : basic_image_view{data.data(), width, height, channels}
+    {
+        if (data.size() != static_cast<std::size_t>(_height) * row_size())
+        {
+            throw std::runtime_error("Invalid image data: expected " + std::to_string(width) + "x" + std::to_string(height) + "x" + std::to_string(channels) + " bytes, got " + std::to_string(data.size()));
+        }
+    }
+
+    /*!
+     * \brief Writable views convert to read-only ones.
+     */
+    template <typename Other>
+        requires(std::is_const_v<Byte> && !std::is_const_v<Other>)
+    basic_image_view(const basic_image_view<Other>& other) noexcept
+        : _data{other.data()}
+        , _width{other.width()}
+        , _height{other.height()}
+        , _channels{other.channels()}
+        , _stride{other.stride()}
+    {
+    }
+
+    Byte* data() const noexcept
+    {
+        return _data;
+    }
+
+    int width() const noexcept
+    {
+        return _width;
+    }
+
+    int height() const noexcept
+    {
+        return _height;
+    }
+
+    int channels() const noexcept
+    {
+        return _channels;
+    }
+
+    /*!
+     * \brief Distance in bytes between the first bytes of consecutive rows.
+     */
+    std::size_t stride() const noexcept
+    {
+        return _stride;
+    }
+
+    /*!
+     * \brief Number of pixel bytes of each row, width * channels.
+     */
+    std::size_t row_size() const noexcept
+    {
+        return static_cast<std::size_t>(_width) * _channels;
+    }
+
+    bool empty() const noexcept
+    {
+        return _width == 0 || _height == 0;
+    }
+
+    /*!
+     * \brief Whether rows follow each other without padding, so that the pixels are a single width * height * channels buffer.
+     */
+    bool is_contiguous() const noexcept
+    {
+        return _stride == row_size() || _height <= 1;
+    }
+
+    /*!
+     * \brief Pointer to the first byte of row y, with y in [0, height).
+     */
+    Byte* row(int y) const noexcept
+    {
+        return _data + static_cast<std::size_t>(y) * _stride;
+    }
+
+    /*!
+     * \brief Pointer to the first channel of pixel (x, y), with x in [0, width) and y in [0, height).
+     */
+    Byte* pixel(int x, int y) const noexcept
+    {
+        return row(y) + static_cast<std::size_t>(x) * _channels;
+    }
+
+    /*!
+     * \brief View of a rectangular region of the image, sharing its pixels and stride.
+     * \param x Left column of the region
+     * \param y Top row of the region
+     * \param width Width of the region in pixels
+     * \param height Height of the region in pixels
+     * \return View of the region, without copying any pixel
+     * \throws std::runtime_error if the region is not fully inside the image
+     */
+    basic_image_view subview(int x, int y, int width, int height) const
+    {
+        if (x < 0 || y < 0 || width < 0 || height < 0 || x > _width - width || y > _height - height)
+        {
+            throw std::runtime_error("Invalid image view region: " + std::to_string(width) + "x" + std::to_string(height) + " at (" + std::to_string(x) + ", " + std::to_string(y) + ") outside of a " + std::to_string(_width) + "x" + std::to_string(_height) + " image");
+        }
+        return basic_image_view{width > 0 && height > 0 ? pixel(x, y) : _data, width, height, _channels, _stride};
+    }
+
+private:
+    Byte* _data = nullptr;
+    int _width = 0;
+    int _height = 0;
+    int _channels = 1;
+    std::size_t _stride = 0;
+};
+
+/*!
+ * \brief Read-only view of an interleaved 8-bit image.
+ */
+using image_view = basic_image_view<const std::uint8_t>;
+
+/*!
+ * \brief Writable view of an interleaved 8-bit image.
+ */
+using image_span = basic_image_view<std::uint8_t>;
+
+}
@@ -0,0 +1,262 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <teiacare/image/executor.hpp>
+#include <teiacare/image/image_border.hpp>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace tc::img
+{
+/*!
+ * \enum interpolation
+ * \brief Method used to sample an image at non integer coordinates.
+ */
+enum class interpolation
+{
+    nearest, //!< Nearest neighbour sampling
+    bilinear //!< Bilinear interpolation of the 4 closest pixels
+};
+
+/*!
+ * \brief Compute the affine matrix of a rotation around a center point, with optional isotropic scaling.
+ * \param center_x X coordinate of the rotation center in the source image
+ * \param center_y Y coordinate of the rotation center in the source image
+ * \param angle Rotation angle in degrees, positive values mean counter-clockwise rotation (y axis pointing down)
+ * \param scale Isotropic scale factor, defaults to 1.0
+ * \return Row-major 2x3 affine matrix mapping source coordinates to destination coordinates
+ */
+std::array<double, 6> rotation_matrix(
+    double center_x,
+    double center_y,
+    double angle,
+    double scale = 1.0);
+
+/*!
+ * \brief Apply an affine transformation to an image, storing result in provided vector.
+ * \param image Input image data vector
+ * \param width Width of the input image in pixels
+ * \param height Height of the input image in pixels
+ * \param channels Number of color channels in the input image
+ * \param matrix Row-major 2x3 affine matrix mapping source coordinates to destination coordinates
+ * \param target_width Width of the warped image
+ * \param target_height Height of the warped image
+ * \param warped_image Output vector to store the warped image data, resized to target_width * target_height * channels if needed
+ * \param interp Interpolation method, defaults to interpolation::bilinear
+ * \param border Extrapolation method for source pixels outside the input image, defaults to border_mode::constant
+ * \param border_value Value used with border_mode::constant, either a single value for all channels or one value per channel, defaults to {0}
+ * \param exec Executor running the rows, defaults to default_executor()
+ * \throws std::runtime_error if matrix is not invertible or border_value has neither 1 nor channels components
+ *
+ * Source coordinates are stepped incrementally along each output row in 16.16 fixed point, without a per-pixel matrix product.
+ * Rows are processed in parallel.
+ * An empty input image has no pixel to sample: every output pixel takes the border value.
+ */
+void warp_affine(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    const std::array<double, 6>& matrix,
+    int target_width,
+    int target_height,
+    std::vector<std::uint8_t>& warped_image,
+    interpolation interp = interpolation::bilinear,
+    border_mode border = border_mode::constant,
+    const std::vector<std::uint8_t>& border_value = {0},
+    executor& exec = default_executor());
+
+/*!
+ * \brief Apply an affine transformation to an image, returning result as new vector.
+ * \param image Input image data vector
+ * \param width Width of the input image in pixels
+ * \param height Height of the input image in pixels
+ * \param channels Number of color channels in the input image
+ * \param matrix Row-major 2x3 affine matrix mapping source coordinates to destination coordinates
+ * \param target_width Width of the warped image
+ * \param target_height Height of the warped image
+ * \param interp Interpolation method, defaults to interpolation::bilinear
+ * \param border Extrapolation method for source pixels outside the input image, defaults to border_mode::constant
+ * \param border_value Value used with border_mode::constant, either a single value for all channels or one value per channel, defaults to {0}
+ * \param exec Executor running the rows, defaults to default_executor()
+ * \return Vector containing the warped image data
+ * \throws std::runtime_error if matrix is not invertible or border_value has neither 1 nor channels components
+ */
+std::vector<std::uint8_t> warp_affine(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    const std::array<double, 6>& matrix,
+    int target_width,
+    int target_height,
+    interpolation interp = interpolation::bilinear,
+    border_mode border = border_mode::constant,
+    const std::vector<std::uint8_t>& border_value = {0},
+    executor& exec = default_executor());
+
+/*!
+ * \struct remap_plan
+ * \brief Precomputed source coordinates of every pixel of a warped image, stored as compact fixed-point maps.
+ *
+ * A plan depends only on the transformation and on the image sizes, so it can be built once and applied to every frame with remap.
+ * Coordinates outside the int16 range are clamped, which only affects pixels mapped far outside the source image.
+ */
+struct remap_plan
+{
+    int width = 0;                                  //!< Width of the remapped image
+    int height = 0;                                 //!< Height of the remapped image
+    interpolation interp = interpolation::bilinear; //!< Interpolation method the coordinates were computed for
+    std::vector<std::int16_t> coords;               //!< Integer part of the source coordinates, interleaved as x, y for each output pixel
+    std::vector<std::uint16_t> weights;             //!< Fractional part of the source coordinates in 8-bit fixed point, packed as (wy << 8) | wx
+};
+
+/*!
+ * \brief Build the remap plan of a perspective transformation.
+ * \param matrix Row-major 3x3 homography mapping source coordinates to destination coordinates
+ * \param target_width Width of the warped image
+ * \param target_height Height of the warped image
+ * \param interp Interpolation method, defaults to interpolation::bilinear
+ * \param exec Executor running the rows, defaults to default_executor()
+ * \return Plan to be used with remap
+ * \throws std::runtime_error if matrix is not invertible
+ *
+ * Homogeneous coordinates are stepped incrementally along each row, so building the plan needs one division per pixel and no matrix product.
+ */
+remap_plan make_perspective_remap_plan(
+    const std::array<double, 9>& matrix,
+    int target_width,
+    int target_height,
+    interpolation interp = interpolation::bilinear,
+    executor& exec = default_executor());
+
+/*!
+ * \brief Apply a precomputed remap plan to an image, storing result in provided vector.
+ * \param image Input image data vector
+ * \param width Width of the input image in pixels
+ * \param height Height of the input image in pixels
+ * \param channels Number of color channels in the input image
+ * \param plan Plan storing the source coordinates of each output pixel
+ * \param remapped_image Output vector to store the remapped image data, resized to plan.width * plan.height * channels if needed
+ * \param border Extrapolation method for source pixels outside the input image, defaults to border_mode::constant
+ * \param border_value Value used with border_mode::constant, either a single value for all channels or one value per channel, defaults to {0}
+ * \param exec Executor running the rows, defaults to default_executor()
+ * \throws std::runtime_error if plan.coords and plan.weights do not hold plan.width * plan.height entries
+ * or border_value has neither 1 nor channels components
+ *
+ * Per-frame work is a table-driven gather over the output image, processed in parallel by row bands.
+ * An empty input image has no pixel to sample: every output pixel takes the border value.
+ */
+void remap(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    const remap_plan& plan,
+    std::vector<std::uint8_t>& remapped_image,
+    border_mode border = border_mode::constant,
+    const std::vector<std::uint8_t>& border_value = {0},
+    executor& exec = default_executor());
+
+/*!
+ * \brief Apply a precomputed remap plan to an image, returning result as new vector.
+ * \param image Input image data vector
+ * \param width Width of the input image in pixels
+ * \param height Height of the input image in pixels
+ * \param channels Number of color channels in the input image
+ * \param plan Plan storing the source coordinates of each output pixel
+ * \param border Extrapolation method for source pixels outside the input image, defaults to border_mode::constant
+ * \param border_value Value used with border_mode::constant, either a single value for all channels or one value per channel, defaults to {0}
+ * \param exec Executor running the rows, defaults to default_executor()
+ * \return Vector containing the remapped image data
+ * \throws std::runtime_error if plan.coords and plan.weights do not hold plan.width * plan.height entries
+ * or border_value has neither 1 nor channels components
+ */
+std::vector<std::uint8_t> remap(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    const remap_plan& plan,
+    border_mode border = border_mode::constant,
+    const std::vector<std::uint8_t>& border_value = {0},
+    executor& exec = default_executor());
+
+/*!
+ * \brief Apply a perspective transformation to an image, storing result in provided vector.
+ * \param image Input image data vector
+ * \param width Width of the input image in pixels
+ * \param height Height of the input image in pixels
+ * \param channels Number of color channels in the input image
+ * \param matrix Row-major 3x3 homography mapping source coordinates to destination coordinates
+ * \param target_width Width of the warped image
+ * \param target_height Height of the warped image
+ * \param warped_image Output vector to store the warped image data, resized to target_width * target_height * channels if needed
+ * \param interp Interpolation method, defaults to interpolation::bilinear
+ * \param border Extrapolation method for source pixels outside the input image, defaults to border_mode::constant
+ * \param border_value Value used with border_mode::constant, either a single value for all channels or one value per channel, defaults to {0}
+ * \param exec Executor running the rows, defaults to default_executor()
+ * \throws std::runtime_error if matrix is not invertible or border_value has neither 1 nor channels components
+ *
+ * Convenience wrapper building a remap plan on every call: when the same homography is applied to many frames,
+ * build the plan once with make_perspective_remap_plan and call remap instead.
+ */
+void warp_perspective(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    const std::array<double, 9>& matrix,
+    int target_width,
+    int target_height,
+    std::vector<std::uint8_t>& warped_image,
+    interpolation interp = interpolation::bilinear,
+    border_mode border = border_mode::constant,
+    const std::vector<std::uint8_t>& border_value = {0},
+    executor& exec = default_executor());
+
+/*!
+ * \brief Apply a perspective transformation to an image, returning result as new vector.
+ * \param image Input image data vector
+ * \param width Width of the input image in pixels
+ * \param height Height of the input image in pixels
+ * \param channels Number of color channels in the input image
+ * \param matrix Row-major 3x3 homography mapping source coordinates to destination coordinates
+ * \param target_width Width of the warped image
+ * \param target_height Height of the warped image
+ * \param interp Interpolation method, defaults to interpolation::bilinear
+ * \param border Extrapolation method for source pixels outside the input image, defaults to border_mode::constant
+ * \param border_value Value used with border_mode::constant, either a single value for all channels or one value per channel, defaults to {0}
+ * \param exec Executor running the rows, defaults to default_executor()
+ * \return Vector containing the warped image data
+ * \throws std::runtime_error if matrix is not invertible or border_value has neither 1 nor channels components
+ */
+std::vector<std::uint8_t> warp_perspective(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    const std::array<double, 9>& matrix,
+    int target_width,
+    int target_height,
+    interpolation interp = interpolation::bilinear,
+    border_mode border = border_mode::constant,
+    const std::vector<std::uint8_t>& border_value = {0},
+    executor& exec = default_executor());
+
+}
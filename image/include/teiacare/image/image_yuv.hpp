@@ -0,0 +1,124 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace tc::img
+{
+/*!
+ * \enum yuv_matrix
+ * \brief Color matrix relating YUV (Y'CbCr) values to RGB.
+ */
+enum class yuv_matrix
+{
+    bt601, //!< ITU-R BT.601, used by SD video and JPEG
+    bt709  //!< ITU-R BT.709, used by HD video
+};
+
+/*!
+ * \enum yuv_range
+ * \brief Range of the YUV values.
+ */
+enum class yuv_range
+{
+    limited, //!< Luma in [16, 235] and chroma in [16, 240], the default of most video decoders
+    full     //!< Luma and chroma in [0, 255], as used by JPEG and many camera pipelines
+};
+
+/*!
+ * \brief Convert an NV12 image to interleaved RGB (in-place version).
+ * \param nv12 Input NV12 data: the width x height luma plane followed by the interleaved UV plane, subsampled 2x2
+ * \param width Width of the image in pixels
+ * \param height Height of the image in pixels
+ * \param rgb Output interleaved image data, resized to width * height * 3 bytes
+ * \param matrix Color matrix of the input, defaults to yuv_matrix::bt601
+ * \param range Value range of the input, defaults to yuv_range::limited
+ * \param swapRB_channels Whether to produce BGR instead of RGB, defaults to false
+ * \throws std::runtime_error if nv12 has not width * height + 2 * ((width + 1) / 2) * ((height + 1) / 2) bytes
+ *
+ * Odd sizes are supported, the last chroma sample covering a single column or row.
+ * Pixels are converted with 13-bit fixed point coefficients and SIMD multiply-adds, rounded to nearest and saturated to [0, 255].
+ */
+void nv12_to_rgb(
+    const std::vector<std::uint8_t>& nv12,
+    int width,
+    int height,
+    std::vector<std::uint8_t>& rgb,
+    yuv_matrix matrix = yuv_matrix::bt601,
+    yuv_range range = yuv_range::limited,
+    bool swapRB_channels = false);
+
+/*!
+ * \brief Convert an NV12 image to interleaved RGB (return version).
+ * \param nv12 Input NV12 data: the width x height luma plane followed by the interleaved UV plane, subsampled 2x2
+ * \param width Width of the image in pixels
+ * \param height Height of the image in pixels
+ * \param matrix Color matrix of the input, defaults to yuv_matrix::bt601
+ * \param range Value range of the input, defaults to yuv_range::limited
+ * \param swapRB_channels Whether to produce BGR instead of RGB, defaults to false
+ * \return Interleaved image data, with width * height * 3 bytes
+ * \throws std::runtime_error if nv12 has not width * height + 2 * ((width + 1) / 2) * ((height + 1) / 2) bytes
+ */
+std::vector<std::uint8_t> nv12_to_rgb(
+    const std::vector<std::uint8_t>& nv12,
+    int width,
+    int height,
+    yuv_matrix matrix = yuv_matrix::bt601,
+    yuv_range range = yuv_range::limited,
+    bool swapRB_channels = false);
+
+/*!
+ * \brief Convert an I420 image to interleaved RGB (in-place version).
+ * \param i420 Input I420 data: the width x height luma plane followed by the U and V planes, each subsampled 2x2
+ * \param width Width of the image in pixels
+ * \param height Height of the image in pixels
+ * \param rgb Output interleaved image data, resized to width * height * 3 bytes
+ * \param matrix Color matrix of the input, defaults to yuv_matrix::bt601
+ * \param range Value range of the input, defaults to yuv_range::limited
+ * \param swapRB_channels Whether to produce BGR instead of RGB, defaults to false
+ * \throws std::runtime_error if i420 has not width * height + 2 * ((width + 1) / 2) * ((height + 1) / 2) bytes
+ * \see nv12_to_rgb
+ */
+void i420_to_rgb(
+    const std::vector<std::uint8_t>& i420,
+    int width,
+    int height,
+    std::vector<std::uint8_t>& rgb,
+    yuv_matrix matrix = yuv_matrix::bt601,
+    yuv_range range = yuv_range::limited,
+    bool swapRB_channels = false);
+
+/*!
+ * \brief Convert an I420 image to interleaved RGB (return version).
+ * \param i420 Input I420 data: the width x height luma plane followed by the U and V planes, each subsampled 2x2
+ * \param width Width of the image in pixels
+ * \param height Height of the image in pixels
+ * \param matrix Color matrix of the input, defaults to yuv_matrix::bt601
+ * \param range Value range of the input, defaults to yuv_range::limited
+ * \param swapRB_channels Whether to produce BGR instead of RGB, defaults to false
+ * \return Interleaved image data, with width * height * 3 bytes
+ * \throws std::runtime_error if i420 has not width * height + 2 * ((width + 1) / 2) * ((height + 1) / 2) bytes
+ */
+std::vector<std::uint8_t> i420_to_rgb(
+    const std::vector<std::uint8_t>& i420,
+    int width,
+    int height,
+    yuv_matrix matrix = yuv_matrix::bt601,
+    yuv_range range = yuv_range::limited,
+    bool swapRB_channels = false);
+
+}
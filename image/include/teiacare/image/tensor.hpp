@@ -0,0 +1,248 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <numeric>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace tc::img
+{
+/*!
+ * \brief Default alignment in bytes of the tensor buffers, enough for AVX-512 loads and for runtimes binding 64-byte aligned inputs.
+ */
+inline constexpr std::size_t tensor_alignment = 64;
+
+/*!
+ * \class tensor
+ * \brief Move-only, aligned buffer of elements with a row-major shape, returned by the blob functions.
+ * \tparam T Element type, trivially copyable
+ * \tparam Alignment Alignment in bytes of the first element, a power of two of at least alignof(T)
+ *
+ * The buffer can be handed to inference runtimes without a copy through data(), shape() and strides().
+ * Like std::vector it is a contiguous range with size(), operator[], begin() and end().
+ */
+template <typename T, std::size_t Alignment = tensor_alignment>
+class tensor
+{
+    static_assert(std::is_trivially_copyable_v<T>, "tensor elements must be trivially copyable");
+    static_assert(Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0, "tensor alignment must be a power of two of at least alignof(T)");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    /*!
+     * \brief Create an empty tensor, without shape and storage.
+     */
+    tensor() noexcept = default;
+
+    /*!
+     * \brief Create a tensor with the given shape and value-initialized elements.
+     * \param shape Extent of each dimension, outermost first
+     */
+    explicit tensor(std::vector<std::size_t> shape)
+        : tensor{uninitialized(std::move(shape))}
+    {
+        std::fill_n(_data, _size, T{});
+    }
+
+    /*!
+     * \brief Create a tensor with the given shape, leaving the elements uninitialized.
+     * \param shape Extent of each dimension, outermost first
+     * \return Tensor whose elements must be written before being read
+     *
+     * Used by the blob functions, which write every element, to avoid an extra pass over the buffer.
+     */
+    static tensor uninitialized(std::vector<std::size_t> shape)
+    {
+        tensor result;
+        result._size = std::accumulate(shape.begin(), shape.end(), std::size_t{1}, std::multiplies<>{});
+        result._strides.resize(shape.size());
+        std::size_t stride = 1;
+        for (std::size_t d = shape.size(); d-- > 0;)
+        {
+            result._strides[d] = stride;
+            stride *= shape[d];
+        }
+        result._shape = std::move(shape);
+        if (result._size > 0)
+            result._data = static_cast<T*>(::operator new(result._size * sizeof(T), std::align_val_t{Alignment}));
+        return result;
+    }
+
+    tensor(const tensor&) = delete;
+    tensor& operator=(const tensor&) = delete;
+
+    tensor(tensor&& other) noexcept
+        : _shape{std::move(other._shape)}
+        , _strides{std::move(other._strides)}
+        , _data{std::exchange(other._data, nullptr)}
+        , _size{std::exchange(other._size, 0)}
+    {
+        other._shape.clear();
+        other._strides.clear();
+    }
+
+    tensor& operator=(tensor&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            _shape = std::move(other._shape);
+            _strides = std::move(other._strides);
+            _data = std::exchange(other._data, nullptr);
+            _size = std::exchange(other._size, 0);
+            other._shape.clear();
+            other._strides.clear();
+        }
+        return *this;
+    }
+
+    ~tensor()
+    {
+        release();
+    }
+
+    /*!
+     * \brief Extent of each dimension, outermost first.
+     */
+    const std::vector<std::size_t>& shape() const noexcept
+    {
+        return _shape;
+    }
+
+    /*!
+     * \brief Distance in elements between consecutive indices of each dimension.
+     */
+    const std::vector<std::size_t>& strides() const noexcept
+    {
+        return _strides;
+    }
+
+    /*!
+     * \brief Number of dimensions.
+     */
+    std::size_t rank() const noexcept
+    {
+        return _shape.size();
+    }
+
+    /*!
+     * \brief Number of elements, the product of the shape.
+     */
+    std::size_t size() const noexcept
+    {
+        return _size;
+    }
+
+    /*!
+     * \brief Size of the buffer in bytes.
+     */
+    std::size_t size_bytes() const noexcept
+    {
+        return _size * sizeof(T);
+    }
+
+    bool empty() const noexcept
+    {
+        return _size == 0;
+    }
+
+    /*!
+     * \brief Pointer to the first element, aligned to Alignment bytes, or nullptr for empty tensors.
+     */
+    T* data() noexcept
+    {
+        return _data;
+    }
+
+    const T* data() const noexcept
+    {
+        return _data;
+    }
+
+    T& operator[](std::size_t index) noexcept
+    {
+        return _data[index];
+    }
+
+    const T& operator[](std::size_t index) const noexcept
+    {
+        return _data[index];
+    }
+
+    iterator begin() noexcept
+    {
+        return _data;
+    }
+
+    iterator end() noexcept
+    {
+        return _data + _size;
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return _data;
+    }
+
+    const_iterator end() const noexcept
+    {
+        return _data + _size;
+    }
+
+    operator std::span<T>() noexcept
+    {
+        return {_data, _size};
+    }
+
+    operator std::span<const T>() const noexcept
+    {
+        return {_data, _size};
+    }
+
+    /*!
+     * \brief Tensors are equal when they have the same shape and elements.
+     */
+    friend bool operator==(const tensor& lhs, const tensor& rhs)
+    {
+        return lhs._shape == rhs._shape && lhs._size == rhs._size && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+private:
+    void release() noexcept
+    {
+        if (_data)
+            ::operator delete(_data, std::align_val_t{Alignment});
+        _data = nullptr;
+        _size = 0;
+    }
+
+    std::vector<std::size_t> _shape;
+    std::vector<std::size_t> _strides;
+    T* _data = nullptr;
+    std::size_t _size = 0;
+};
+
+}
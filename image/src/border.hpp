@@ -0,0 +1,87 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <teiacare/image/image_border.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace tc::img::detail
+{
+/*!
+ * \brief Map a coordinate that may fall outside [0, size) to the coordinate of the pixel to read.
+ * \param p Coordinate to map
+ * \param size Size of the image along the coordinate axis
+ * \param mode Border extrapolation strategy
+ * \return Coordinate inside [0, size), or -1 when the pixel must be read from the constant border value
+ */
+inline int border_interpolate(int p, int size, border_mode mode)
+{
+    if (static_cast<unsigned>(p) < static_cast<unsigned>(size))
+        return p;
+
+    switch (mode)
+    {
+    case border_mode::constant:
+        return -1;
+    case border_mode::replicate:
+        return p < 0 ? 0 : size - 1;
+    case border_mode::reflect:
+        if (size == 1)
+            return 0;
+        {
+            const int period = 2 * (size - 1);
+            p %= period;
+            if (p < 0)
+                p += period;
+            return p < size ? p : period - p;
+        }
+    case border_mode::wrap:
+        p %= size;
+        return p < 0 ? p + size : p;
+    }
+    return -1;
+}
+
+/*!
+ * \brief Copy an image row extended on both sides according to a border mode.
+ * \param row Source row of width interleaved pixels
+ * \param width Width of the row in pixels
+ * \param channels Number of channels of each pixel
+ * \param left Number of pixels added before the row
+ * \param right Number of pixels added after the row
+ * \param mode Border extrapolation strategy
+ * \param border_pixel One value per channel, used with border_mode::constant
+ * \param dst Output row of (left + width + right) * channels bytes
+ */
+inline void extend_row(const std::uint8_t* row, int width, int channels, int left, int right, border_mode mode, const std::uint8_t* border_pixel, std::uint8_t* dst)
+{
+    const std::size_t pixel_size = static_cast<std::size_t>(channels);
+    std::memcpy(dst + left * pixel_size, row, width * pixel_size);
+    for (int x = -left; x < 0; ++x)
+    {
+        const int src_x = border_interpolate(x, width, mode);
+        std::memcpy(dst + (x + left) * pixel_size, src_x < 0 ? border_pixel : row + src_x * pixel_size, pixel_size);
+    }
+    for (int x = width; x < width + right; ++x)
+    {
+        const int src_x = border_interpolate(x, width, mode);
+        std::memcpy(dst + (x + left) * pixel_size, src_x < 0 ? border_pixel : row + src_x * pixel_size, pixel_size);
+    }
+}
+
+}
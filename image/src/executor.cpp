@@ -0,0 +1,46 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <teiacare/image/executor.hpp>
+
+#include "parallel.hpp"
+
+namespace tc::img
+{
+namespace
+{
+class thread_executor : public executor
+{
+public:
+    void parallel_for(int count, const std::function<void(int begin, int end)>& task, int min_chunk_size) override
+    {
+        detail::parallel_for(count, task, min_chunk_size);
+    }
+};
+
+}
+
+void sequential_executor::parallel_for(int count, const std::function<void(int begin, int end)>& task, int /* min_chunk_size */)
+{
+    if (count > 0)
+        task(0, count);
+}
+
+executor& default_executor()
+{
+    static thread_executor instance;
+    return instance;
+}
+
+}
@@ -0,0 +1,189 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "float16_convert.hpp"
+
+#include "simd.hpp"
+#include <cstdint>
+
+namespace tc::img::detail
+{
+namespace
+{
+#if defined(TC_IMG_SSE2)
+/*!
+ * \brief Pack the low 16 bits of the 32-bit lanes of lo and hi into 8 values.
+ */
+inline __m128i pack_low_words(__m128i lo, __m128i hi)
+{
+    // Sign extend the 16-bit values so that the signed saturating pack keeps them unchanged
+    return _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(lo, 16), 16), _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16));
+}
+
+/*!
+ * \brief Select a where mask is set and b elsewhere.
+ */
+inline __m128i select(__m128i mask, __m128i a, __m128i b)
+{
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+#if !defined(TC_IMG_F16C)
+/*!
+ * \brief Vector version of float_to_float16_bits, returning the half bits in the low 16 bits of each lane.
+ */
+inline __m128i float16_lanes(__m128 value)
+{
+    const __m128i bits = _mm_castps_si128(value);
+    const __m128i sign = _mm_and_si128(_mm_srli_epi32(bits, 16), _mm_set1_epi32(0x8000));
+    const __m128i magnitude = _mm_and_si128(bits, _mm_set1_epi32(0x7FFFFFFF));
+
+    const __m128i is_nan = _mm_cmpgt_epi32(magnitude, _mm_set1_epi32(0x7F800000));
+    const __m128i overflow = select(is_nan, _mm_set1_epi32(0x7E00), _mm_set1_epi32(0x7C00));
+    const __m128i subnormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(magnitude), _mm_set1_ps(0.5f))), _mm_set1_epi32(0x3F000000));
+    const __m128i odd = _mm_and_si128(_mm_srli_epi32(magnitude, 13), _mm_set1_epi32(1));
+    const __m128i normal = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(magnitude, _mm_set1_epi32(static_cast<int>(0xC8000FFFu))), odd), 13);
+
+    const __m128i finite = select(_mm_cmplt_epi32(magnitude, _mm_set1_epi32(0x38800000)), subnormal, normal);
+    return _mm_or_si128(sign, select(_mm_cmplt_epi32(magnitude, _mm_set1_epi32(0x47800000)), finite, overflow));
+}
+#endif
+
+#if !defined(TC_IMG_AVX512BF16)
+/*!
+ * \brief Vector version of float_to_bfloat16_bits, returning the bfloat16 bits in the low 16 bits of each lane.
+ */
+inline __m128i bfloat16_lanes(__m128 value)
+{
+    const __m128i bits = _mm_castps_si128(value);
+    const __m128i odd = _mm_and_si128(_mm_srli_epi32(bits, 16), _mm_set1_epi32(1));
+    const __m128i rounded = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(bits, _mm_set1_epi32(0x7FFF)), odd), 16);
+    const __m128i quiet_nan = _mm_or_si128(_mm_srli_epi32(bits, 16), _mm_set1_epi32(0x0040));
+    return select(_mm_castps_si128(_mm_cmpunord_ps(value, value)), quiet_nan, rounded);
+}
+#endif
+
+#if !defined(TC_IMG_F16C)
+/*!
+ * \brief Vector version of float16_bits_to_float, reading the half bits from the low 16 bits of each lane.
+ */
+inline __m128 float16_lanes_to_float(__m128i value)
+{
+    const __m128i magnitude = _mm_slli_epi32(_mm_and_si128(value, _mm_set1_epi32(0x7FFF)), 13);
+    const __m128i exponent = _mm_and_si128(magnitude, _mm_set1_epi32(0x0F800000));
+
+    // Rebias the exponent, moving infinities and NaNs to the float maximum exponent
+    __m128i result = _mm_add_epi32(magnitude, _mm_set1_epi32(0x38000000));
+    result = _mm_add_epi32(result, _mm_and_si128(_mm_cmpeq_epi32(exponent, _mm_set1_epi32(0x0F800000)), _mm_set1_epi32(0x38000000)));
+
+    // Subnormals: build 2^-14 * (1 + mantissa / 1024) and subtract the implicit 2^-14
+    const __m128 subnormal = _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(result, _mm_set1_epi32(0x00800000))), _mm_castsi128_ps(_mm_set1_epi32(0x38800000)));
+    result = select(_mm_cmpeq_epi32(exponent, _mm_setzero_si128()), _mm_castps_si128(subnormal), result);
+
+    const __m128i sign = _mm_slli_epi32(_mm_and_si128(value, _mm_set1_epi32(0x8000)), 16);
+    return _mm_castsi128_ps(_mm_or_si128(result, sign));
+}
+#endif
+#endif
+}
+
+void convert_float_values(const float* src, float16* dst, std::size_t count)
+{
+    std::size_t i = 0;
+#if defined(TC_IMG_F16C)
+    for (; i + 8 <= count; i += 8)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT));
+#elif defined(TC_IMG_SSE2)
+    for (; i + 8 <= count; i += 8)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), pack_low_words(float16_lanes(_mm_loadu_ps(src + i)), float16_lanes(_mm_loadu_ps(src + i + 4))));
+#elif defined(TC_IMG_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+    for (; i + 4 <= count; i += 4)
+        vst1_u16(reinterpret_cast<std::uint16_t*>(dst + i), vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(src + i))));
+#endif
+
+    for (; i < count; ++i)
+        dst[i] = float16(src[i]);
+}
+
+void convert_float_values(const float* src, bfloat16* dst, std::size_t count)
+{
+    std::size_t i = 0;
+#if defined(TC_IMG_AVX512BF16)
+    // Note that the instruction treats subnormal inputs as zero
+    for (; i + 8 <= count; i += 8)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), reinterpret_cast<__m128i>(_mm256_cvtneps_pbh(_mm256_loadu_ps(src + i))));
+#elif defined(TC_IMG_SSE2)
+    for (; i + 8 <= count; i += 8)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), pack_low_words(bfloat16_lanes(_mm_loadu_ps(src + i)), bfloat16_lanes(_mm_loadu_ps(src + i + 4))));
+#elif defined(TC_IMG_NEON)
+    for (; i + 4 <= count; i += 4)
+    {
+        const float32x4_t value = vld1q_f32(src + i);
+        const uint32x4_t bits = vreinterpretq_u32_f32(value);
+        const uint32x4_t odd = vandq_u32(vshrq_n_u32(bits, 16), vdupq_n_u32(1));
+        const uint32x4_t rounded = vaddq_u32(vaddq_u32(bits, vdupq_n_u32(0x7FFF)), odd);
+        const uint32x4_t quiet_nan = vorrq_u32(bits, vdupq_n_u32(0x00400000));
+        vst1_u16(reinterpret_cast<std::uint16_t*>(dst + i), vshrn_n_u32(vbslq_u32(vceqq_f32(value, value), rounded, quiet_nan), 16));
+    }
+#endif
+
+    for (; i < count; ++i)
+        dst[i] = bfloat16(src[i]);
+}
+
+void convert_float_values(const float16* src, float* dst, std::size_t count)
+{
+    std::size_t i = 0;
+#if defined(TC_IMG_F16C)
+    for (; i + 8 <= count; i += 8)
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i))));
+#elif defined(TC_IMG_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_ps(dst + i, float16_lanes_to_float(_mm_unpacklo_epi16(values, zero)));
+        _mm_storeu_ps(dst + i + 4, float16_lanes_to_float(_mm_unpackhi_epi16(values, zero)));
+    }
+#elif defined(TC_IMG_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+    for (; i + 4 <= count; i += 4)
+        vst1q_f32(dst + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(reinterpret_cast<const std::uint16_t*>(src + i)))));
+#endif
+
+    for (; i < count; ++i)
+        dst[i] = static_cast<float>(src[i]);
+}
+
+void convert_float_values(const bfloat16* src, float* dst, std::size_t count)
+{
+    std::size_t i = 0;
+#if defined(TC_IMG_SSE2)
+    // Moving each value to the upper half of a 32-bit lane is the whole conversion
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_ps(dst + i, _mm_castsi128_ps(_mm_unpacklo_epi16(zero, values)));
+        _mm_storeu_ps(dst + i + 4, _mm_castsi128_ps(_mm_unpackhi_epi16(zero, values)));
+    }
+#elif defined(TC_IMG_NEON)
+    for (; i + 4 <= count; i += 4)
+        vst1q_f32(dst + i, vreinterpretq_f32_u32(vshll_n_u16(vld1_u16(reinterpret_cast<const std::uint16_t*>(src + i)), 16)));
+#endif
+
+    for (; i < count; ++i)
+        dst[i] = static_cast<float>(src[i]);
+}
+
+}
@@ -0,0 +1,43 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <teiacare/image/float16.hpp>
+
+#include <cstddef>
+
+namespace tc::img::detail
+{
+/*!
+ * \brief Convert count floats to IEEE half precision, rounding to nearest even.
+ */
+void convert_float_values(const float* src, float16* dst, std::size_t count);
+
+/*!
+ * \brief Convert count floats to bfloat16, rounding to nearest even.
+ */
+void convert_float_values(const float* src, bfloat16* dst, std::size_t count);
+
+/*!
+ * \brief Convert count IEEE half precision values to floats, exactly.
+ */
+void convert_float_values(const float16* src, float* dst, std::size_t count);
+
+/*!
+ * \brief Convert count bfloat16 values to floats, exactly.
+ */
+void convert_float_values(const bfloat16* src, float* dst, std::size_t count);
+
+}
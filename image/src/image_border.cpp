@@ -0,0 +1,243 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <teiacare/image/image_border.hpp>
+
+#include "border.hpp"
+#include "parallel.hpp"
+#include "sampling.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace tc::img
+{
+namespace
+{
+/*!
+ * \brief Fill count pixels with copies of one pixel, doubling the filled prefix with each memcpy.
+ */
+void fill_pixels(std::uint8_t* dst, const std::uint8_t* pixel, std::size_t count, std::size_t pixel_size)
+{
+    const std::size_t total = count * pixel_size;
+    if (total == 0)
+        return;
+
+    std::memcpy(dst, pixel, pixel_size);
+    for (std::size_t filled = pixel_size; filled < total;)
+    {
+        const std::size_t size = std::min(filled, total - filled);
+        std::memcpy(dst + filled, dst, size);
+        filled += size;
+    }
+}
+
+/*!
+ * \brief Columns of a side border read from consecutive source columns, copied with a single memcpy.
+ */
+struct column_run
+{
+    int dst_x;  // First column of the run in the padded row, relative to the first image column
+    int src_x;  // First source column
+    int length; // Number of pixels
+};
+
+/*!
+ * \brief Group the border columns [first, last) into runs of consecutive source columns.
+ */
+void make_column_runs(int first, int last, int width, border_mode border, std::vector<column_run>& runs)
+{
+    for (int x = first; x < last; ++x)
+    {
+        const int src_x = detail::border_interpolate(x, width, border);
+        if (!runs.empty() && runs.back().dst_x + runs.back().length == x && runs.back().src_x + runs.back().length == src_x)
+            ++runs.back().length;
+        else
+            runs.push_back({x, src_x, 1});
+    }
+}
+}
+
+border_accessor::border_accessor(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    border_mode border,
+    const std::vector<std::uint8_t>& border_value)
+    : _data{image.data()}
+    , _width{width}
+    , _height{height}
+    , _channels{channels}
+    , _border{border}
+    , _border_pixel{detail::expand_border_value(border_value, channels)}
+{
+    if (border != border_mode::constant && (width <= 0 || height <= 0))
+    {
+        throw std::runtime_error("Invalid image size for border extrapolation: " + std::to_string(width) + "x" + std::to_string(height));
+    }
+
+    if (border == border_mode::constant)
+    {
+        _constant_row.resize(static_cast<std::size_t>(std::max(width, 0)) * channels);
+        fill_pixels(_constant_row.data(), _border_pixel.data(), std::max(width, 0), channels);
+    }
+}
+
+const std::uint8_t* border_accessor::pixel(int x, int y) const
+{
+    const int src_x = detail::border_interpolate(x, _width, _border);
+    const int src_y = detail::border_interpolate(y, _height, _border);
+    if (src_x < 0 || src_y < 0)
+        return _border_pixel.data();
+    return _data + (static_cast<std::size_t>(src_y) * _width + src_x) * _channels;
+}
+
+const std::uint8_t* border_accessor::row(int y) const
+{
+    const int src_y = detail::border_interpolate(y, _height, _border);
+    return src_y < 0 ? _constant_row.data() : _data + static_cast<std::size_t>(src_y) * _width * _channels;
+}
+
+void border_accessor::copy_row(int y, int left, int right, std::uint8_t* dst) const
+{
+    detail::extend_row(row(y), _width, _channels, left, right, _border, _border_pixel.data(), dst);
+}
+
+void copy_make_border(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    int top,
+    int bottom,
+    int left,
+    int right,
+    std::vector<std::uint8_t>& padded_image,
+    border_mode border,
+    const std::vector<std::uint8_t>& border_value)
+{
+    if (top < 0 || bottom < 0 || left < 0 || right < 0)
+    {
+        throw std::runtime_error("Invalid border size: top " + std::to_string(top) + ", bottom " + std::to_string(bottom) + ", left " + std::to_string(left) + ", right " + std::to_string(right));
+    }
+
+    if (&image == &padded_image)
+    {
+        std::vector<std::uint8_t> result;
+        copy_make_border(image, width, height, channels, top, bottom, left, right, result, border, border_value);
+        padded_image = std::move(result);
+        return;
+    }
+
+    const border_accessor src(image, width, height, channels, border, border_value);
+    const std::size_t pixel_size = static_cast<std::size_t>(channels);
+    const int image_width = std::max(width, 0);
+    const int image_height = std::max(height, 0);
+    const int padded_width = left + image_width + right;
+    const int padded_height = top + image_height + bottom;
+    const std::size_t row_size = static_cast<std::size_t>(image_width) * pixel_size;
+    const std::size_t padded_row_size = static_cast<std::size_t>(padded_width) * pixel_size;
+    padded_image.resize(padded_row_size * padded_height);
+    if (padded_row_size == 0 || padded_height == 0)
+        return;
+
+    if (image_width == 0 || image_height == 0)
+    {
+        fill_pixels(padded_image.data(), src.border_pixel().data(), static_cast<std::size_t>(padded_width) * padded_height, pixel_size);
+        return;
+    }
+
+    // Side borders are either constant strips, copies of the edge pixel or runs of source columns
+    std::vector<std::uint8_t> constant_strip;
+    std::vector<column_run> left_runs;
+    std::vector<column_run> right_runs;
+    if (border == border_mode::constant)
+    {
+        constant_strip.resize(static_cast<std::size_t>(std::max(left, right)) * pixel_size);
+        fill_pixels(constant_strip.data(), src.border_pixel().data(), std::max(left, right), pixel_size);
+    }
+    else if (border != border_mode::replicate)
+    {
+        make_column_runs(-left, 0, image_width, border, left_runs);
+        make_column_runs(image_width, image_width + right, image_width, border, right_runs);
+    }
+
+    const auto copy_runs = [&](const std::vector<column_run>& runs, const std::uint8_t* src_row, std::uint8_t* image_start) {
+        for (const auto& run : runs)
+            std::memcpy(image_start + static_cast<std::ptrdiff_t>(run.dst_x) * channels, src_row + run.src_x * pixel_size, run.length * pixel_size);
+    };
+
+    detail::parallel_for(image_height, [&](int y_begin, int y_end) {
+        for (int y = y_begin; y < y_end; ++y)
+        {
+            const std::uint8_t* src_row = image.data() + y * row_size;
+            std::uint8_t* dst_row = padded_image.data() + (top + y) * padded_row_size;
+            std::uint8_t* image_start = dst_row + left * pixel_size;
+            std::memcpy(image_start, src_row, row_size);
+
+            switch (border)
+            {
+            case border_mode::constant:
+                std::memcpy(dst_row, constant_strip.data(), left * pixel_size);
+                std::memcpy(image_start + row_size, constant_strip.data(), right * pixel_size);
+                break;
+            case border_mode::replicate:
+                fill_pixels(dst_row, src_row, left, pixel_size);
+                fill_pixels(image_start + row_size, src_row + row_size - pixel_size, right, pixel_size);
+                break;
+            default:
+                copy_runs(left_runs, src_row, image_start);
+                copy_runs(right_runs, src_row, image_start);
+                break;
+            }
+        }
+    }, 64);
+
+    // Rows above and below the image copy the padded row they extrapolate, or the constant value
+    const auto fill_border_row = [&](int y) {
+        std::uint8_t* dst_row = padded_image.data() + y * padded_row_size;
+        const int src_y = detail::border_interpolate(y - top, image_height, border);
+        if (src_y < 0)
+            fill_pixels(dst_row, src.border_pixel().data(), padded_width, pixel_size);
+        else
+            std::memcpy(dst_row, padded_image.data() + (top + src_y) * padded_row_size, padded_row_size);
+    };
+    for (int y = 0; y < top; ++y)
+        fill_border_row(y);
+    for (int y = top + image_height; y < padded_height; ++y)
+        fill_border_row(y);
+}
+
+std::vector<std::uint8_t> copy_make_border(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    int top,
+    int bottom,
+    int left,
+    int right,
+    border_mode border,
+    const std::vector<std::uint8_t>& border_value)
+{
+    std::vector<std::uint8_t> padded_image;
+    copy_make_border(image, width, height, channels, top, bottom, left, right, padded_image, border, border_value);
+    return padded_image;
+}
+
+}
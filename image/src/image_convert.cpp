@@ -0,0 +1,451 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <teiacare/image/image_convert.hpp>
+
+#include "parallel.hpp"
+#include "simd.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace tc::img
+{
+namespace
+{
+// BT.601 luminance weights in fixed point, summing to 1 << gray_weight_bits
+constexpr int gray_weight_bits = 14;
+constexpr int gray_weight_r = 4899;
+constexpr int gray_weight_g = 9617;
+constexpr int gray_weight_b = 1868;
+
+constexpr std::size_t pixel_format_count = 5;
+
+/*!
+ * \brief Per-pixel parameters of a conversion.
+ *
+ * For color outputs, source[d] is the input byte copied to output byte d, or -1 for an opaque alpha.
+ * For gray outputs, weight[s] is the luminance weight of input byte s.
+ */
+struct conversion_order
+{
+    std::array<int, 4> source;
+    std::array<int, 4> weight;
+};
+
+using conversion_kernel = void (*)(const std::uint8_t* src, std::uint8_t* dst, std::size_t count, const conversion_order& order);
+
+struct conversion
+{
+    conversion_kernel kernel;
+    conversion_order order;
+};
+
+template <int Channels>
+void copy_pixels(const std::uint8_t* src, std::uint8_t* dst, std::size_t count, const conversion_order&)
+{
+    std::memcpy(dst, src, count * Channels);
+}
+
+/*!
+ * \brief Reorder, drop or add channels of count pixels.
+ */
+template <int SrcChannels, int DstChannels>
+void swizzle_pixels(const std::uint8_t* src, std::uint8_t* dst, std::size_t count, const conversion_order& order)
+{
+    std::size_t i = 0;
+#if defined(TC_IMG_SSSE3)
+    // Each 16-byte shuffle converts the pixels fitting in both a 16-byte input and a 16-byte output; the output bytes past them
+    // are written too, and overwritten by the next block or by the scalar tail
+    constexpr std::size_t block = 16 / std::max(SrcChannels, DstChannels);
+    alignas(16) std::uint8_t shuffle[16];
+    alignas(16) std::uint8_t alpha[16];
+    for (std::size_t k = 0; k < 16; ++k)
+    {
+        const std::size_t p = k / DstChannels;
+        const int s = order.source[k % DstChannels];
+        shuffle[k] = (p < block && s >= 0) ? static_cast<std::uint8_t>(p * SrcChannels + s) : 0x80;
+        alpha[k] = (p < block && s < 0) ? 0xFF : 0x00;
+    }
+
+    const __m128i shuffle_mask = _mm_load_si128(reinterpret_cast<const __m128i*>(shuffle));
+    const __m128i alpha_mask = _mm_load_si128(reinterpret_cast<const __m128i*>(alpha));
+    const std::size_t src_size = count * SrcChannels;
+    const std::size_t dst_size = count * DstChannels;
+    for (; i * SrcChannels + 16 <= src_size && i * DstChannels + 16 <= dst_size; i += block)
+    {
+        const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * SrcChannels));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * DstChannels), _mm_or_si128(_mm_shuffle_epi8(pixels, shuffle_mask), alpha_mask));
+    }
+#elif defined(TC_IMG_SSE2)
+    // Without byte shuffles only the red and blue swap of 4-channel pixels is vectorized, with 32-bit shifts
+    if constexpr (SrcChannels == 4 && DstChannels == 4)
+    {
+        if (order.source == std::array<int, 4>{2, 1, 0, 3})
+        {
+            const __m128i green_alpha = _mm_set1_epi32(static_cast<int>(0xFF00FF00u));
+            const __m128i low_byte = _mm_set1_epi32(0x000000FF);
+            for (; i + 4 <= count; i += 4)
+            {
+                const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4));
+                const __m128i red_blue = _mm_or_si128(_mm_slli_epi32(_mm_and_si128(pixels, low_byte), 16), _mm_and_si128(_mm_srli_epi32(pixels, 16), low_byte));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4), _mm_or_si128(_mm_and_si128(pixels, green_alpha), red_blue));
+            }
+        }
+    }
+#elif defined(TC_IMG_NEON)
+    const uint8x16_t opaque = vdupq_n_u8(255);
+    for (; i + 16 <= count; i += 16)
+    {
+        uint8x16_t in[4];
+        if constexpr (SrcChannels == 3)
+        {
+            const uint8x16x3_t pixels = vld3q_u8(src + i * 3);
+            in[0] = pixels.val[0];
+            in[1] = pixels.val[1];
+            in[2] = pixels.val[2];
+            in[3] = opaque;
+        }
+        else
+        {
+            const uint8x16x4_t pixels = vld4q_u8(src + i * 4);
+            in[0] = pixels.val[0];
+            in[1] = pixels.val[1];
+            in[2] = pixels.val[2];
+            in[3] = pixels.val[3];
+        }
+
+        uint8x16_t out[4];
+        for (int d = 0; d < DstChannels; ++d)
+            out[d] = order.source[d] < 0 ? opaque : in[order.source[d]];
+
+        if constexpr (DstChannels == 3)
+            vst3q_u8(dst + i * 3, uint8x16x3_t{{out[0], out[1], out[2]}});
+        else
+            vst4q_u8(dst + i * 4, uint8x16x4_t{{out[0], out[1], out[2], out[3]}});
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        const std::uint8_t* s = src + i * SrcChannels;
+        std::uint8_t* d = dst + i * DstChannels;
+        for (int c = 0; c < DstChannels; ++c)
+            d[c] = order.source[c] < 0 ? 255 : s[order.source[c]];
+    }
+}
+
+#if defined(TC_IMG_SSE2)
+/*!
+ * \brief Luminance of 4 pixels of 4 bytes, as 32-bit lanes: bytes 0 and 2 of each pixel are weighted by even_weights, bytes 1 and 3 by odd_weights.
+ */
+inline __m128i gray_lanes(__m128i pixels, __m128i even_weights, __m128i odd_weights)
+{
+    const __m128i even = _mm_and_si128(pixels, _mm_set1_epi16(0x00FF));
+    const __m128i odd = _mm_srli_epi16(pixels, 8);
+    const __m128i sum = _mm_add_epi32(_mm_madd_epi16(even, even_weights), _mm_madd_epi16(odd, odd_weights));
+    return _mm_srli_epi32(_mm_add_epi32(sum, _mm_set1_epi32(1 << (gray_weight_bits - 1))), gray_weight_bits);
+}
+#endif
+
+/*!
+ * \brief Convert count color pixels to gray.
+ */
+template <int SrcChannels>
+void gray_pixels(const std::uint8_t* src, std::uint8_t* dst, std::size_t count, const conversion_order& order)
+{
+    const auto& w = order.weight;
+    std::size_t i = 0;
+#if defined(TC_IMG_SSE2)
+    const __m128i even_weights = _mm_setr_epi16(w[0], w[2], w[0], w[2], w[0], w[2], w[0], w[2]);
+    const __m128i odd_weights = _mm_setr_epi16(w[1], SrcChannels == 4 ? w[3] : 0, w[1], SrcChannels == 4 ? w[3] : 0, w[1], SrcChannels == 4 ? w[3] : 0, w[1], SrcChannels == 4 ? w[3] : 0);
+    if constexpr (SrcChannels == 4)
+    {
+        for (; i + 16 <= count; i += 16)
+        {
+            __m128i gray[4];
+            for (int j = 0; j < 4; ++j)
+                gray[j] = gray_lanes(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + (i + 4 * j) * 4)), even_weights, odd_weights);
+            const __m128i packed = _mm_packus_epi16(_mm_packs_epi32(gray[0], gray[1]), _mm_packs_epi32(gray[2], gray[3]));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), packed);
+        }
+    }
+#if defined(TC_IMG_SSSE3)
+    else
+    {
+        // Spread 4 pixels of 3 bytes to 4 bytes each, the fourth being zero
+        const __m128i expand = _mm_setr_epi8(0, 1, 2, -128, 3, 4, 5, -128, 6, 7, 8, -128, 9, 10, 11, -128);
+        for (; i * 3 + 52 <= count * 3 && i + 16 <= count; i += 16)
+        {
+            __m128i gray[4];
+            for (int j = 0; j < 4; ++j)
+            {
+                const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + (i + 4 * j) * 3));
+                gray[j] = gray_lanes(_mm_shuffle_epi8(pixels, expand), even_weights, odd_weights);
+            }
+            const __m128i packed = _mm_packus_epi16(_mm_packs_epi32(gray[0], gray[1]), _mm_packs_epi32(gray[2], gray[3]));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), packed);
+        }
+    }
+#endif
+#elif defined(TC_IMG_NEON)
+    for (; i + 16 <= count; i += 16)
+    {
+        uint8x16_t in[3];
+        if constexpr (SrcChannels == 3)
+        {
+            const uint8x16x3_t pixels = vld3q_u8(src + i * 3);
+            in[0] = pixels.val[0];
+            in[1] = pixels.val[1];
+            in[2] = pixels.val[2];
+        }
+        else
+        {
+            const uint8x16x4_t pixels = vld4q_u8(src + i * 4);
+            in[0] = pixels.val[0];
+            in[1] = pixels.val[1];
+            in[2] = pixels.val[2];
+        }
+
+        uint16x8_t half[2];
+        for (int h = 0; h < 2; ++h)
+        {
+            uint16x8_t wide[3];
+            for (int c = 0; c < 3; ++c)
+                wide[c] = vmovl_u8(h == 0 ? vget_low_u8(in[c]) : vget_high_u8(in[c]));
+
+            uint32x4_t low = vmull_n_u16(vget_low_u16(wide[0]), static_cast<std::uint16_t>(w[0]));
+            uint32x4_t high = vmull_n_u16(vget_high_u16(wide[0]), static_cast<std::uint16_t>(w[0]));
+            for (int c = 1; c < 3; ++c)
+            {
+                low = vmlal_n_u16(low, vget_low_u16(wide[c]), static_cast<std::uint16_t>(w[c]));
+                high = vmlal_n_u16(high, vget_high_u16(wide[c]), static_cast<std::uint16_t>(w[c]));
+            }
+            half[h] = vcombine_u16(vrshrn_n_u32(low, gray_weight_bits), vrshrn_n_u32(high, gray_weight_bits));
+        }
+        vst1q_u8(dst + i, vcombine_u8(vmovn_u16(half[0]), vmovn_u16(half[1])));
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        const std::uint8_t* s = src + i * SrcChannels;
+        const int sum = s[0] * w[0] + s[1] * w[1] + s[2] * w[2];
+        dst[i] = static_cast<std::uint8_t>((sum + (1 << (gray_weight_bits - 1))) >> gray_weight_bits);
+    }
+}
+
+/*!
+ * \brief Replicate count gray pixels to every color channel, alpha being opaque.
+ */
+template <int DstChannels>
+void gray_to_color_pixels(const std::uint8_t* src, std::uint8_t* dst, std::size_t count, const conversion_order&)
+{
+    std::size_t i = 0;
+#if defined(TC_IMG_SSE2)
+    if constexpr (DstChannels == 4)
+    {
+        const __m128i opaque = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+        for (; i + 16 <= count; i += 16)
+        {
+            const __m128i gray = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            const __m128i pairs[2] = {_mm_unpacklo_epi8(gray, gray), _mm_unpackhi_epi8(gray, gray)};
+            for (int j = 0; j < 2; ++j)
+            {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + (i + 8 * j) * 4), _mm_or_si128(_mm_unpacklo_epi16(pairs[j], pairs[j]), opaque));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + (i + 8 * j + 4) * 4), _mm_or_si128(_mm_unpackhi_epi16(pairs[j], pairs[j]), opaque));
+            }
+        }
+    }
+#if defined(TC_IMG_SSSE3)
+    else
+    {
+        // 16 gray values fill 48 output bytes, output byte k reading value k / 3
+        const __m128i spread[3] = {
+            _mm_setr_epi8(0, 0, 0, 1, 1, 1, 2, 2, 2, 3, 3, 3, 4, 4, 4, 5),
+            _mm_setr_epi8(5, 5, 6, 6, 6, 7, 7, 7, 8, 8, 8, 9, 9, 9, 10, 10),
+            _mm_setr_epi8(10, 11, 11, 11, 12, 12, 12, 13, 13, 13, 14, 14, 14, 15, 15, 15)};
+        for (; i + 16 <= count; i += 16)
+        {
+            const __m128i gray = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            for (int j = 0; j < 3; ++j)
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 3 + 16 * j), _mm_shuffle_epi8(gray, spread[j]));
+        }
+    }
+#endif
+#elif defined(TC_IMG_NEON)
+    for (; i + 16 <= count; i += 16)
+    {
+        const uint8x16_t gray = vld1q_u8(src + i);
+        if constexpr (DstChannels == 3)
+            vst3q_u8(dst + i * 3, uint8x16x3_t{{gray, gray, gray}});
+        else
+            vst4q_u8(dst + i * 4, uint8x16x4_t{{gray, gray, gray, vdupq_n_u8(255)}});
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        std::memset(dst + i * DstChannels, src[i], 3);
+        if constexpr (DstChannels == 4)
+            dst[i * 4 + 3] = 255;
+    }
+}
+
+/*!
+ * \brief Byte position of the red, green, blue and alpha channels in a pixel of the given format, -1 if absent.
+ */
+constexpr std::array<int, 4> channel_positions(pixel_format format)
+{
+    switch (format)
+    {
+    case pixel_format::rgb:
+        return {0, 1, 2, -1};
+    case pixel_format::bgr:
+        return {2, 1, 0, -1};
+    case pixel_format::rgba:
+        return {0, 1, 2, 3};
+    case pixel_format::bgra:
+        return {2, 1, 0, 3};
+    default:
+        return {0, 0, 0, -1};
+    }
+}
+
+constexpr conversion make_conversion(pixel_format src, pixel_format dst)
+{
+    const int src_channels = src == pixel_format::gray ? 1 : channel_positions(src)[3] < 0 ? 3 : 4;
+    const int dst_channels = dst == pixel_format::gray ? 1 : channel_positions(dst)[3] < 0 ? 3 : 4;
+    conversion result{nullptr, {{-1, -1, -1, -1}, {0, 0, 0, 0}}};
+
+    if (src == dst)
+    {
+        result.kernel = src_channels == 1 ? &copy_pixels<1> : src_channels == 3 ? &copy_pixels<3> : &copy_pixels<4>;
+        return result;
+    }
+
+    if (src == pixel_format::gray)
+    {
+        result.kernel = dst_channels == 3 ? &gray_to_color_pixels<3> : &gray_to_color_pixels<4>;
+        return result;
+    }
+
+    const auto src_positions = channel_positions(src);
+    if (dst == pixel_format::gray)
+    {
+        result.order.weight[src_positions[0]] = gray_weight_r;
+        result.order.weight[src_positions[1]] = gray_weight_g;
+        result.order.weight[src_positions[2]] = gray_weight_b;
+        result.kernel = src_channels == 3 ? &gray_pixels<3> : &gray_pixels<4>;
+        return result;
+    }
+
+    // Output byte d takes the channel stored there in dst from its position in src
+    const auto dst_positions = channel_positions(dst);
+    for (int channel = 0; channel < 4; ++channel)
+    {
+        if (dst_positions[channel] >= 0)
+            result.order.source[dst_positions[channel]] = src_positions[channel];
+    }
+
+    if (src_channels == 3)
+        result.kernel = dst_channels == 3 ? &swizzle_pixels<3, 3> : &swizzle_pixels<3, 4>;
+    else
+        result.kernel = dst_channels == 3 ? &swizzle_pixels<4, 3> : &swizzle_pixels<4, 4>;
+    return result;
+}
+
+constexpr auto make_conversion_table()
+{
+    std::array<std::array<conversion, pixel_format_count>, pixel_format_count> table{};
+    for (std::size_t src = 0; src < pixel_format_count; ++src)
+    {
+        for (std::size_t dst = 0; dst < pixel_format_count; ++dst)
+            table[src][dst] = make_conversion(static_cast<pixel_format>(src), static_cast<pixel_format>(dst));
+    }
+    return table;
+}
+
+// Kernel and parameters of every (source, destination) pair of formats
+constexpr auto conversion_table = make_conversion_table();
+
+// Pixels converted by each task
+constexpr std::size_t convert_block_size = 1 << 15;
+
+void convert_into(const std::vector<std::uint8_t>& src, pixel_format src_format, std::vector<std::uint8_t>& dst, pixel_format dst_format)
+{
+    const std::size_t src_channels = static_cast<std::size_t>(pixel_format_channels(src_format));
+    const std::size_t dst_channels = static_cast<std::size_t>(pixel_format_channels(dst_format));
+    if (src.size() % src_channels != 0)
+    {
+        throw std::runtime_error("Invalid image size: " + std::to_string(src.size()) + " bytes are not a multiple of " + std::to_string(src_channels) + " channels");
+    }
+
+    const std::size_t count = src.size() / src_channels;
+    dst.resize(count * dst_channels);
+    if (count == 0)
+        return;
+
+    const conversion& conv = conversion_table[static_cast<std::size_t>(src_format)][static_cast<std::size_t>(dst_format)];
+    const int blocks = static_cast<int>((count + convert_block_size - 1) / convert_block_size);
+    detail::parallel_for(blocks, [&](int begin, int end) {
+        const std::size_t first = begin * convert_block_size;
+        const std::size_t last = std::min(count, end * convert_block_size);
+        conv.kernel(src.data() + first * src_channels, dst.data() + first * dst_channels, last - first, conv.order);
+    });
+}
+}
+
+int pixel_format_channels(pixel_format format)
+{
+    switch (format)
+    {
+    case pixel_format::gray:
+        return 1;
+    case pixel_format::rgb:
+    case pixel_format::bgr:
+        return 3;
+    case pixel_format::rgba:
+    case pixel_format::bgra:
+        return 4;
+    }
+    throw std::runtime_error("Invalid pixel format: " + std::to_string(static_cast<int>(format)));
+}
+
+void convert(const std::vector<std::uint8_t>& src, pixel_format src_format, std::vector<std::uint8_t>& dst, pixel_format dst_format)
+{
+    if (&src != &dst)
+    {
+        convert_into(src, src_format, dst, dst_format);
+        return;
+    }
+
+    // Converting a vector into itself goes through a temporary, as the pixel size may change
+    std::vector<std::uint8_t> result;
+    convert_into(src, src_format, result, dst_format);
+    dst = std::move(result);
+}
+
+std::vector<std::uint8_t> convert(const std::vector<std::uint8_t>& src, pixel_format src_format, pixel_format dst_format)
+{
+    std::vector<std::uint8_t> dst;
+    convert_into(src, src_format, dst, dst_format);
+    return dst;
+}
+
+}
@@ -13,50 +13,241 @@
 // limitations under the License.
 
 #include <teiacare/image/image_draw.hpp>
+#include <teiacare/image/basic_image.hpp>
 
+#include "parallel.hpp"
+#include "simd.hpp"
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <string>
 
 namespace tc::img
 {
-void set_pixel_rgb(std::vector<uint8_t>& img, int width, int height, int x, int y, const tc::img::color& color)
+namespace
+{
+/*!
+ * \brief Blend one channel value towards a color, computing (src * (255 - weight) + color * weight) / 255 rounded to nearest.
+ */
+inline std::uint8_t blend_channel(std::uint8_t src, std::uint8_t color, std::uint8_t weight)
+{
+    return static_cast<std::uint8_t>((src * (255 - weight) + color * weight + 127) / 255);
+}
+
+#if defined(TC_IMG_AVX2)
+/*!
+ * \brief Vector version of blend_channel on 16 values widened to 16-bit lanes.
+ */
+inline __m256i blend_lanes(__m256i src, __m256i color, __m256i weight)
+{
+    const __m256i t = _mm256_add_epi16(_mm256_add_epi16(_mm256_mullo_epi16(src, _mm256_sub_epi16(_mm256_set1_epi16(255), weight)), _mm256_mullo_epi16(color, weight)), _mm256_set1_epi16(127));
+
+    // t / 255 == (t + 1 + (t >> 8)) >> 8 for every t below 65535
+    return _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(t, _mm256_set1_epi16(1)), _mm256_srli_epi16(t, 8)), 8);
+}
+#elif defined(TC_IMG_SSE2)
+/*!
+ * \brief Vector version of blend_channel on 8 values widened to 16-bit lanes.
+ */
+inline __m128i blend_lanes(__m128i src, __m128i color, __m128i weight)
+{
+    const __m128i t = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(src, _mm_sub_epi16(_mm_set1_epi16(255), weight)), _mm_mullo_epi16(color, weight)), _mm_set1_epi16(127));
+
+    // t / 255 == (t + 1 + (t >> 8)) >> 8 for every t below 65535
+    return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(t, _mm_set1_epi16(1)), _mm_srli_epi16(t, 8)), 8);
+}
+#elif defined(TC_IMG_NEON)
+/*!
+ * \brief Vector version of blend_channel on 8 values.
+ */
+inline uint8x8_t blend_lanes(uint8x8_t src, uint8x8_t color, uint8x8_t weight)
+{
+    const uint16x8_t t = vaddq_u16(vmlal_u8(vmull_u8(src, vsub_u8(vdup_n_u8(255), weight)), color, weight), vdupq_n_u16(127));
+
+    // t / 255 == (t + 1 + (t >> 8)) >> 8 for every t below 65535
+    return vshrn_n_u16(vaddq_u16(vaddq_u16(t, vdupq_n_u16(1)), vshrq_n_u16(t, 8)), 8);
+}
+#endif
+
+/*!
+ * \brief Blend count channel values of an image row towards per value colors and weights.
+ */
+void blend_row(std::uint8_t* row, const std::uint8_t* colors, const std::uint8_t* weights, std::size_t count)
+{
+    std::size_t i = 0;
+#if defined(TC_IMG_AVX2)
+    const __m256i zero = _mm256_setzero_si256();
+    for (; i + 32 <= count; i += 32)
+    {
+        // Unpacks and packs both work within 128-bit lanes, so the values come back in order
+        const __m256i src = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + i));
+        const __m256i color = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(colors + i));
+        const __m256i weight = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(weights + i));
+        const __m256i lo = blend_lanes(_mm256_unpacklo_epi8(src, zero), _mm256_unpacklo_epi8(color, zero), _mm256_unpacklo_epi8(weight, zero));
+        const __m256i hi = blend_lanes(_mm256_unpackhi_epi8(src, zero), _mm256_unpackhi_epi8(color, zero), _mm256_unpackhi_epi8(weight, zero));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(row + i), _mm256_packus_epi16(lo, hi));
+    }
+#elif defined(TC_IMG_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i src = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + i));
+        const __m128i color = _mm_loadu_si128(reinterpret_cast<const __m128i*>(colors + i));
+        const __m128i weight = _mm_loadu_si128(reinterpret_cast<const __m128i*>(weights + i));
+        const __m128i lo = blend_lanes(_mm_unpacklo_epi8(src, zero), _mm_unpacklo_epi8(color, zero), _mm_unpacklo_epi8(weight, zero));
+        const __m128i hi = blend_lanes(_mm_unpackhi_epi8(src, zero), _mm_unpackhi_epi8(color, zero), _mm_unpackhi_epi8(weight, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(row + i), _mm_packus_epi16(lo, hi));
+    }
+#elif defined(TC_IMG_NEON)
+    for (; i + 16 <= count; i += 16)
+    {
+        const uint8x16_t src = vld1q_u8(row + i);
+        const uint8x16_t color = vld1q_u8(colors + i);
+        const uint8x16_t weight = vld1q_u8(weights + i);
+        const uint8x8_t lo = blend_lanes(vget_low_u8(src), vget_low_u8(color), vget_low_u8(weight));
+        const uint8x8_t hi = blend_lanes(vget_high_u8(src), vget_high_u8(color), vget_high_u8(weight));
+        vst1q_u8(row + i, vcombine_u8(lo, hi));
+    }
+#endif
+
+    for (; i < count; ++i)
+        row[i] = blend_channel(row[i], colors[i], weights[i]);
+}
+
+/*!
+ * \brief Look up the class color and blend weight of each pixel of an image row in the 4-byte class tables.
+ * \param classes Mask row, pixel x reading class classes[mask_x[x]], or classes[x] when mask_x is null
+ */
+template <int Channels>
+void fill_mask_row(const std::uint8_t* classes, const int* mask_x, int width, const std::array<std::uint8_t, 4>* colors, const std::array<std::uint8_t, 4>* weights, std::uint8_t* row_colors, std::uint8_t* row_weights)
+{
+    // Every pointer is a local so that the byte stores, which may alias anything, do not force reloads
+    for (int x = 0; x < width; ++x)
+    {
+        const std::uint8_t k = classes[mask_x ? mask_x[x] : x];
+        std::memcpy(row_colors + x * Channels, colors[k].data(), 4);
+        std::memcpy(row_weights + x * Channels, weights[k].data(), 4);
+    }
+}
+
+/*!
+ * \brief Index of the nearest source sample of destination position i, matching pixel centers.
+ */
+inline int nearest_index(int i, int src_size, int dst_size)
 {
-    if (x < 0 || x >= width || y < 0 || y >= height)
+    return static_cast<int>(std::min<long long>(src_size - 1, ((2LL * i + 1) * src_size) / (2LL * dst_size)));
+}
+
+/*!
+ * \brief Check that the colors drawn on an image fit in its pixels, which need at least the 3 RGB channels.
+ */
+void check_color_channels(image_view img)
+{
+    if (img.channels() < 3)
+    {
+        throw std::runtime_error("Invalid channels for drawing: " + std::to_string(img.channels()) + ", expected at least 3");
+    }
+}
+
+/*!
+ * \brief View the buffer of the RGB vector overloads, which trust the given size as they always did.
+ *
+ * Nothing is validated nor thrown: non-positive sizes and empty buffers give an empty view, on which drawing does nothing.
+ */
+image_span rgb_span(std::vector<uint8_t>& img, int width, int height) noexcept
+{
+    if (width <= 0 || height <= 0 || img.empty())
+        return image_span{img.data(), 0, 0, 3};
+    return image_span{img.data(), width, height, 3};
+}
+
+/*!
+ * \brief Write the RGB components of a color to the pixel at address pixel, other channels being left untouched.
+ */
+inline void write_rgb(std::uint8_t* pixel, const tc::img::color& color)
+{
+    pixel[0] = color.r;
+    pixel[1] = color.g;
+    pixel[2] = color.b;
+}
+
+/*!
+ * \brief Distance in bytes between consecutive pixels, a compile time constant unless Channels is dynamic_channels.
+ */
+template <int Channels>
+inline std::size_t pixel_size(image_span img)
+{
+    if constexpr (Channels == dynamic_channels)
+        return static_cast<std::size_t>(img.channels());
+    else
+        return Channels;
+}
+
+/*!
+ * \brief Write the RGB components of a color to pixel (x, y) when it is inside the image.
+ */
+template <int Channels>
+inline void put_pixel(image_span img, int x, int y, const tc::img::color& color)
+{
+    if (x < 0 || x >= img.width() || y < 0 || y >= img.height())
         return;
 
-    const int idx = (y * width + x) * 3;
-    img[idx + 0] = color.r;
-    img[idx + 1] = color.g;
-    img[idx + 2] = color.b;
+    write_rgb(img.row(y) + x * pixel_size<Channels>(img), color);
 }
 
-void draw_rectangle(std::vector<uint8_t>& img, int width, int height, int x0, int y0, int w, int h, const tc::img::color& color, int thickness)
+/*!
+ * \brief Color the pixels [x_begin, x_end) of row y, clipped to the image.
+ */
+template <int Channels>
+void fill_row(image_span img, int y, int x_begin, int x_end, const tc::img::color& color)
+{
+    if (y < 0 || y >= img.height())
+        return;
+
+    x_begin = std::max(x_begin, 0);
+    x_end = std::min(x_end, img.width());
+    std::uint8_t* pixel = img.row(y) + x_begin * pixel_size<Channels>(img);
+    for (int x = x_begin; x < x_end; ++x, pixel += pixel_size<Channels>(img))
+        write_rgb(pixel, color);
+}
+
+/*!
+ * \brief Color the pixels [y_begin, y_end) of column x, clipped to the image.
+ */
+template <int Channels>
+void fill_column(image_span img, int x, int y_begin, int y_end, const tc::img::color& color)
+{
+    if (x < 0 || x >= img.width())
+        return;
+
+    y_begin = std::max(y_begin, 0);
+    y_end = std::min(y_end, img.height());
+    for (int y = y_begin; y < y_end; ++y)
+        write_rgb(img.row(y) + x * pixel_size<Channels>(img), color);
+}
+
+template <int Channels>
+void rectangle_pixels(image_span img, int x0, int y0, int w, int h, const tc::img::color& color, int thickness)
 {
     // Top and bottom horizontal lines
     for (int t = 0; t < thickness; ++t)
     {
-        int y_top = y0 + t;
-        int y_bottom = y0 + h - 1 - t;
-        for (int x = x0; x < x0 + w; ++x)
-        {
-            set_pixel_rgb(img, width, height, x, y_top, color);
-            set_pixel_rgb(img, width, height, x, y_bottom, color);
-        }
+        fill_row<Channels>(img, y0 + t, x0, x0 + w, color);
+        fill_row<Channels>(img, y0 + h - 1 - t, x0, x0 + w, color);
     }
 
     // Left and right vertical lines
     for (int t = 0; t < thickness; ++t)
     {
-        int x_left = x0 + t;
-        int x_right = x0 + w - 1 - t;
-        for (int y = y0; y < y0 + h; ++y)
-        {
-            set_pixel_rgb(img, width, height, x_left, y, color);
-            set_pixel_rgb(img, width, height, x_right, y, color);
-        }
+        fill_column<Channels>(img, x0 + t, y0, y0 + h, color);
+        fill_column<Channels>(img, x0 + w - 1 - t, y0, y0 + h, color);
     }
 }
 
-void draw_line(std::vector<uint8_t>& img, int width, int height, int x0, int y0, int x1, int y1, const tc::img::color& color, int thickness)
+template <int Channels>
+void line_pixels(image_span img, int x0, int y0, int x1, int y1, const tc::img::color& color, int thickness)
 {
     int dx = std::abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
     int dy = -std::abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
@@ -67,12 +258,7 @@ void draw_line(std::vector<uint8_t>& img, int width, int height, int x0, int y0,
         // Draw thick line by drawing pixels in a square around the main pixel
         int half_thickness = thickness / 2;
         for (int ty = -half_thickness; ty <= half_thickness; ++ty)
-        {
-            for (int tx = -half_thickness; tx <= half_thickness; ++tx)
-            {
-                set_pixel_rgb(img, width, height, x0 + tx, y0 + ty, color);
-            }
-        }
+            fill_row<Channels>(img, y0 + ty, x0 - half_thickness, x0 + half_thickness + 1, color);
 
         if (x0 == x1 && y0 == y1)
             break;
@@ -90,18 +276,151 @@ void draw_line(std::vector<uint8_t>& img, int width, int height, int x0, int y0,
         }
     }
 }
+}
+
+void set_pixel_rgb(std::vector<uint8_t>& img, int width, int height, int x, int y, const tc::img::color& color)
+{
+    put_pixel<3>(rgb_span(img, width, height), x, y, color);
+}
+
+void set_pixel_rgb(image_span img, int x, int y, const tc::img::color& color)
+{
+    check_color_channels(img);
+    visit_channels(img.channels(), [&](auto channels) {
+        put_pixel<decltype(channels)::value>(img, x, y, color);
+    });
+}
+
+void draw_rectangle(std::vector<uint8_t>& img, int width, int height, int x0, int y0, int w, int h, const tc::img::color& color, int thickness)
+{
+    rectangle_pixels<3>(rgb_span(img, width, height), x0, y0, w, h, color, thickness);
+}
+
+void draw_rectangle(image_span img, int x0, int y0, int w, int h, const tc::img::color& color, int thickness)
+{
+    check_color_channels(img);
+    visit_channels(img.channels(), [&](auto channels) {
+        rectangle_pixels<decltype(channels)::value>(img, x0, y0, w, h, color, thickness);
+    });
+}
+
+void draw_line(std::vector<uint8_t>& img, int width, int height, int x0, int y0, int x1, int y1, const tc::img::color& color, int thickness)
+{
+    line_pixels<3>(rgb_span(img, width, height), x0, y0, x1, y1, color, thickness);
+}
+
+void draw_line(image_span img, int x0, int y0, int x1, int y1, const tc::img::color& color, int thickness)
+{
+    check_color_channels(img);
+    visit_channels(img.channels(), [&](auto channels) {
+        line_pixels<decltype(channels)::value>(img, x0, y0, x1, y1, color, thickness);
+    });
+}
 
 void draw_polygon(std::vector<uint8_t>& img, int width, int height, const std::vector<std::pair<int, int>>& points, const tc::img::color& color, int thickness)
 {
+    draw_polygon(rgb_span(img, width, height), points, color, thickness);
+}
+
+void draw_polygon(image_span img, const std::vector<std::pair<int, int>>& points, const tc::img::color& color, int thickness)
+{
+    check_color_channels(img);
     if (points.size() < 2)
         return;
 
-    for (size_t i = 0; i < points.size(); ++i)
+    visit_channels(img.channels(), [&](auto channels) {
+        for (size_t i = 0; i < points.size(); ++i)
+        {
+            const auto& p0 = points[i];
+            const auto& p1 = points[(i + 1) % points.size()];
+            line_pixels<decltype(channels)::value>(img, p0.first, p0.second, p1.first, p1.second, color, thickness);
+        }
+    });
+}
+
+void overlay_mask(
+    std::vector<uint8_t>& img,
+    int width,
+    int height,
+    int channels,
+    const std::vector<uint8_t>& mask,
+    int mask_width,
+    int mask_height,
+    const std::vector<tc::img::color>& palette,
+    float alpha)
+{
+    if (channels != 3 && channels != 4)
+    {
+        throw std::runtime_error("Invalid channels for overlay_mask: " + std::to_string(channels) + ", expected 3 or 4");
+    }
+    if (width < 0 || height < 0 || img.size() != static_cast<std::size_t>(width) * height * channels)
     {
-        const auto& p0 = points[i];
-        const auto& p1 = points[(i + 1) % points.size()];
-        draw_line(img, width, height, p0.first, p0.second, p1.first, p1.second, color, thickness);
+        throw std::runtime_error("Invalid image data: expected " + std::to_string(width) + "x" + std::to_string(height) + "x" + std::to_string(channels) + " bytes, got " + std::to_string(img.size()));
     }
+    overlay_mask(image_span{img.data(), width, height, channels}, mask, mask_width, mask_height, palette, alpha);
+}
+
+void overlay_mask(
+    image_span img,
+    const std::vector<uint8_t>& mask,
+    int mask_width,
+    int mask_height,
+    const std::vector<tc::img::color>& palette,
+    float alpha)
+{
+    const int width = img.width();
+    const int height = img.height();
+    const int channels = img.channels();
+    if (channels != 3 && channels != 4)
+    {
+        throw std::runtime_error("Invalid channels for overlay_mask: " + std::to_string(channels) + ", expected 3 or 4");
+    }
+    if (mask_width <= 0 || mask_height <= 0 || mask.size() != static_cast<std::size_t>(mask_width) * mask_height)
+    {
+        throw std::runtime_error("Invalid mask data: expected " + std::to_string(mask_width) + "x" + std::to_string(mask_height) + " bytes, got " + std::to_string(mask.size()));
+    }
+    if (!(alpha >= 0.0f && alpha <= 1.0f))
+    {
+        throw std::runtime_error("Invalid alpha: " + std::to_string(alpha) + ", expected a value in [0, 1]");
+    }
+
+    // 4 bytes per class so that row buffers are filled with one copy per pixel; classes without a palette entry get a zero weight
+    std::array<std::array<std::uint8_t, 4>, 256> colors{};
+    std::array<std::array<std::uint8_t, 4>, 256> weights{};
+    for (std::size_t k = 0; k < std::min<std::size_t>(palette.size(), 256); ++k)
+    {
+        const auto w = static_cast<std::uint8_t>(std::lround(alpha * palette[k].a));
+        colors[k] = {palette[k].r, palette[k].g, palette[k].b, 0};
+        weights[k] = {w, w, w, 0};
+    }
+
+    std::vector<int> mask_x(mask_width == width ? 0 : width);
+    for (int x = 0; x < static_cast<int>(mask_x.size()); ++x)
+        mask_x[x] = nearest_index(x, mask_width, width);
+    const int* columns = mask_x.empty() ? nullptr : mask_x.data();
+
+    const std::size_t row_size = static_cast<std::size_t>(width) * channels;
+    detail::parallel_for(height, [&](int y_begin, int y_end) {
+        // One spare byte for the 4-byte copies of the last pixel of 3-channel rows
+        std::vector<std::uint8_t> row_colors(row_size + 1);
+        std::vector<std::uint8_t> row_weights(row_size + 1);
+        int filled_row = -1;
+        for (int y = y_begin; y < y_end; ++y)
+        {
+            // Image rows sampling the same mask row share their colors and weights
+            const int mask_y = nearest_index(y, mask_height, height);
+            if (mask_y != filled_row)
+            {
+                const std::uint8_t* classes = mask.data() + static_cast<std::size_t>(mask_y) * mask_width;
+                if (channels == 3)
+                    fill_mask_row<3>(classes, columns, width, colors.data(), weights.data(), row_colors.data(), row_weights.data());
+                else
+                    fill_mask_row<4>(classes, columns, width, colors.data(), weights.data(), row_colors.data(), row_weights.data());
+                filled_row = mask_y;
+            }
+            blend_row(img.row(y), row_colors.data(), row_weights.data(), row_size);
+        }
+    }, std::max(1, (1 << 14) / std::max(width, 1)));
 }
 
 }
@@ -0,0 +1,446 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <teiacare/image/image_filter.hpp>
+
+#include "border.hpp"
+#include "parallel.hpp"
+#include "simd.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace tc::img
+{
+namespace
+{
+constexpr int box_blur_max_radius = 1024;
+
+// Gaussian weights are 14-bit fixed point, the horizontal pass keeps 7 fractional bits for the vertical one
+constexpr int gaussian_weight_bits = 14;
+constexpr int gaussian_intermediate_bits = 7;
+constexpr int gaussian_row_shift = gaussian_weight_bits - gaussian_intermediate_bits;
+constexpr int gaussian_column_shift = gaussian_weight_bits + gaussian_intermediate_bits;
+
+/*!
+ * \brief Horizontal window sums of one row: sums[x * channels + c] is the sum of channel c over the 2 * radius + 1 values centered on x.
+ * \tparam Channels Number of channels, or 0 to use the channels argument
+ * \param extended Row extended by radius pixels on both sides
+ */
+template <int Channels>
+void box_row_sums(const std::int32_t* extended, int width, int channels, int radius, std::int32_t* sums)
+{
+    constexpr int max_channels = Channels > 0 ? Channels : 4;
+    const std::size_t c = Channels > 0 ? Channels : static_cast<std::size_t>(channels);
+    const std::size_t window = static_cast<std::size_t>(2 * radius) * c;
+
+    // Channels are processed max_channels at a time, the running sums staying in registers
+    for (std::size_t first = 0; first < c; first += max_channels)
+    {
+        const std::size_t block = std::min<std::size_t>(max_channels, c - first);
+        std::int32_t sum[max_channels] = {};
+        for (std::size_t ch = 0; ch < block; ++ch)
+        {
+            for (std::size_t k = first + ch; k <= first + ch + window; k += c)
+                sum[ch] += extended[k];
+            sums[first + ch] = sum[ch];
+        }
+
+        // Moving the window one pixel right adds its new last value and removes the previous first one
+        for (int x = 1; x < width; ++x)
+        {
+            const std::size_t i = x * c + first;
+            for (std::size_t ch = 0; ch < block; ++ch)
+            {
+                sum[ch] += extended[i + ch + window] - extended[i + ch - c];
+                sums[i + ch] = sum[ch];
+            }
+        }
+    }
+}
+
+using box_row_kernel = void (*)(const std::int32_t*, int, int, int, std::int32_t*);
+
+box_row_kernel select_box_row_kernel(int channels)
+{
+    switch (channels)
+    {
+    case 1:
+        return &box_row_sums<1>;
+    case 3:
+        return &box_row_sums<3>;
+    case 4:
+        return &box_row_sums<4>;
+    default:
+        return &box_row_sums<0>;
+    }
+}
+
+/*!
+ * \brief Gaussian weights of 2 * radius + 1 taps, quantized so that they sum to exactly 1 << gaussian_weight_bits.
+ */
+std::vector<std::int16_t> gaussian_weights(float sigma, int radius)
+{
+    const int taps = 2 * radius + 1;
+    std::vector<double> weights(taps);
+    double sum = 0.0;
+    for (int k = 0; k < taps; ++k)
+    {
+        const double d = k - radius;
+        weights[k] = std::exp(-d * d / (2.0 * sigma * sigma));
+        sum += weights[k];
+    }
+
+    std::vector<std::int16_t> fixed(taps);
+    int total = 0;
+    for (int k = 0; k < taps; ++k)
+    {
+        fixed[k] = static_cast<std::int16_t>(std::lround(weights[k] / sum * (1 << gaussian_weight_bits)));
+        total += fixed[k];
+    }
+
+    // The rounding error goes to the center tap so that flat regions keep their value
+    fixed[radius] = static_cast<std::int16_t>(fixed[radius] + (1 << gaussian_weight_bits) - total);
+    return fixed;
+}
+
+#if defined(TC_IMG_AVX2) || defined(TC_IMG_SSE2)
+/*!
+ * \brief Two 16-bit weights packed in a 32-bit lane, as multiplied by madd with a pair of interleaved 16-bit values.
+ */
+inline int weight_pair(std::int16_t first, std::int16_t second)
+{
+    return static_cast<int>(static_cast<std::uint32_t>(static_cast<std::uint16_t>(first)) | (static_cast<std::uint32_t>(static_cast<std::uint16_t>(second)) << 16));
+}
+#endif
+
+/*!
+ * \brief Horizontal Gaussian pass: dst[i] = sum_k weights[k] * extended[i + k * stride], rounded to gaussian_intermediate_bits fractional bits.
+ */
+void gaussian_row(const std::uint8_t* extended, std::size_t count, std::size_t stride, const std::int16_t* weights, int taps, std::int16_t* dst)
+{
+    std::size_t i = 0;
+#if defined(TC_IMG_AVX2)
+    const __m256i row_round = _mm256_set1_epi32(1 << (gaussian_row_shift - 1));
+    for (; i + 16 <= count; i += 16)
+    {
+        __m256i low = _mm256_setzero_si256();
+        __m256i high = _mm256_setzero_si256();
+        // Pairs of taps are interleaved so that one multiply-add applies both weights; the lane order is restored by the final pack
+        for (int k = 0; k < taps; k += 2)
+        {
+            const __m256i a = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(extended + i + k * stride)));
+            const bool pair = k + 1 < taps;
+            const __m256i b = pair ? _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(extended + i + (k + 1) * stride))) : _mm256_setzero_si256();
+            const __m256i w = _mm256_set1_epi32(weight_pair(weights[k], pair ? weights[k + 1] : 0));
+            low = _mm256_add_epi32(low, _mm256_madd_epi16(_mm256_unpacklo_epi16(a, b), w));
+            high = _mm256_add_epi32(high, _mm256_madd_epi16(_mm256_unpackhi_epi16(a, b), w));
+        }
+        low = _mm256_srai_epi32(_mm256_add_epi32(low, row_round), gaussian_row_shift);
+        high = _mm256_srai_epi32(_mm256_add_epi32(high, row_round), gaussian_row_shift);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_packs_epi32(low, high));
+    }
+#elif defined(TC_IMG_SSE2)
+    const __m128i row_round = _mm_set1_epi32(1 << (gaussian_row_shift - 1));
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i low = _mm_setzero_si128();
+        __m128i high = _mm_setzero_si128();
+        for (int k = 0; k < taps; k += 2)
+        {
+            const __m128i a = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(extended + i + k * stride)), zero);
+            const bool pair = k + 1 < taps;
+            const __m128i b = pair ? _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(extended + i + (k + 1) * stride)), zero) : zero;
+            const __m128i w = _mm_set1_epi32(weight_pair(weights[k], pair ? weights[k + 1] : 0));
+            low = _mm_add_epi32(low, _mm_madd_epi16(_mm_unpacklo_epi16(a, b), w));
+            high = _mm_add_epi32(high, _mm_madd_epi16(_mm_unpackhi_epi16(a, b), w));
+        }
+        low = _mm_srai_epi32(_mm_add_epi32(low, row_round), gaussian_row_shift);
+        high = _mm_srai_epi32(_mm_add_epi32(high, row_round), gaussian_row_shift);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packs_epi32(low, high));
+    }
+#elif defined(TC_IMG_NEON)
+    for (; i + 8 <= count; i += 8)
+    {
+        int32x4_t low = vdupq_n_s32(0);
+        int32x4_t high = vdupq_n_s32(0);
+        for (int k = 0; k < taps; ++k)
+        {
+            const int16x8_t values = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(extended + i + k * stride)));
+            low = vmlal_n_s16(low, vget_low_s16(values), weights[k]);
+            high = vmlal_n_s16(high, vget_high_s16(values), weights[k]);
+        }
+        vst1q_s16(dst + i, vcombine_s16(vrshrn_n_s32(low, gaussian_row_shift), vrshrn_n_s32(high, gaussian_row_shift)));
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        std::int32_t sum = 0;
+        for (int k = 0; k < taps; ++k)
+            sum += weights[k] * extended[i + k * stride];
+        dst[i] = static_cast<std::int16_t>((sum + (1 << (gaussian_row_shift - 1))) >> gaussian_row_shift);
+    }
+}
+
+/*!
+ * \brief Vertical Gaussian pass: dst[i] = sum_k weights[k] * rows[k][i], rounded and saturated to uint8.
+ */
+void gaussian_column(const std::int16_t* const* rows, const std::int16_t* weights, int taps, std::size_t count, std::uint8_t* dst)
+{
+    std::size_t i = 0;
+#if defined(TC_IMG_AVX2)
+    const __m256i column_round = _mm256_set1_epi32(1 << (gaussian_column_shift - 1));
+    for (; i + 16 <= count; i += 16)
+    {
+        __m256i low = _mm256_setzero_si256();
+        __m256i high = _mm256_setzero_si256();
+        for (int k = 0; k < taps; k += 2)
+        {
+            const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rows[k] + i));
+            const bool pair = k + 1 < taps;
+            const __m256i b = pair ? _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rows[k + 1] + i)) : _mm256_setzero_si256();
+            const __m256i w = _mm256_set1_epi32(weight_pair(weights[k], pair ? weights[k + 1] : 0));
+            low = _mm256_add_epi32(low, _mm256_madd_epi16(_mm256_unpacklo_epi16(a, b), w));
+            high = _mm256_add_epi32(high, _mm256_madd_epi16(_mm256_unpackhi_epi16(a, b), w));
+        }
+        low = _mm256_srai_epi32(_mm256_add_epi32(low, column_round), gaussian_column_shift);
+        high = _mm256_srai_epi32(_mm256_add_epi32(high, column_round), gaussian_column_shift);
+        const __m256i values = _mm256_packs_epi32(low, high);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(_mm256_castsi256_si128(values), _mm256_extracti128_si256(values, 1)));
+    }
+#elif defined(TC_IMG_SSE2)
+    const __m128i column_round = _mm_set1_epi32(1 << (gaussian_column_shift - 1));
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i low = _mm_setzero_si128();
+        __m128i high = _mm_setzero_si128();
+        for (int k = 0; k < taps; k += 2)
+        {
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows[k] + i));
+            const bool pair = k + 1 < taps;
+            const __m128i b = pair ? _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows[k + 1] + i)) : _mm_setzero_si128();
+            const __m128i w = _mm_set1_epi32(weight_pair(weights[k], pair ? weights[k + 1] : 0));
+            low = _mm_add_epi32(low, _mm_madd_epi16(_mm_unpacklo_epi16(a, b), w));
+            high = _mm_add_epi32(high, _mm_madd_epi16(_mm_unpackhi_epi16(a, b), w));
+        }
+        low = _mm_srai_epi32(_mm_add_epi32(low, column_round), gaussian_column_shift);
+        high = _mm_srai_epi32(_mm_add_epi32(high, column_round), gaussian_column_shift);
+        const __m128i values = _mm_packs_epi32(low, high);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(values, values));
+    }
+#elif defined(TC_IMG_NEON)
+    for (; i + 8 <= count; i += 8)
+    {
+        int32x4_t low = vdupq_n_s32(0);
+        int32x4_t high = vdupq_n_s32(0);
+        for (int k = 0; k < taps; ++k)
+        {
+            const int16x8_t values = vld1q_s16(rows[k] + i);
+            low = vmlal_n_s16(low, vget_low_s16(values), weights[k]);
+            high = vmlal_n_s16(high, vget_high_s16(values), weights[k]);
+        }
+        const uint16x8_t values = vcombine_u16(vqmovun_s32(vrshrq_n_s32(low, gaussian_column_shift)), vqmovun_s32(vrshrq_n_s32(high, gaussian_column_shift)));
+        vst1_u8(dst + i, vqmovn_u16(values));
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        std::int32_t sum = 0;
+        for (int k = 0; k < taps; ++k)
+            sum += weights[k] * rows[k][i];
+        dst[i] = static_cast<std::uint8_t>(std::clamp((sum + (1 << (gaussian_column_shift - 1))) >> gaussian_column_shift, 0, 255));
+    }
+}
+}
+
+void box_blur(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    int radius,
+    std::vector<std::uint8_t>& blurred_image,
+    border_mode border,
+    const std::vector<std::uint8_t>& border_value)
+{
+    if (radius < 0 || radius > box_blur_max_radius)
+    {
+        throw std::runtime_error("Invalid box blur radius: " + std::to_string(radius) + ", expected a value in range [0, " + std::to_string(box_blur_max_radius) + "]");
+    }
+
+    if (&image == &blurred_image)
+    {
+        std::vector<std::uint8_t> result;
+        box_blur(image, width, height, channels, radius, result, border, border_value);
+        blurred_image = std::move(result);
+        return;
+    }
+
+    const std::size_t count = static_cast<std::size_t>(std::max(width, 0)) * channels;
+    blurred_image.resize(count * std::max(height, 0));
+    if (count == 0 || height <= 0)
+        return;
+
+    const border_accessor src(image, width, height, channels, border, border_value);
+    const auto& border_pixel = src.border_pixel();
+    const int diameter = 2 * radius + 1;
+    const double inverse_area = 1.0 / (static_cast<double>(diameter) * diameter);
+    const box_row_kernel row_sums = select_box_row_kernel(channels);
+
+    detail::parallel_for(height, [&](int y_begin, int y_end) {
+        std::vector<std::int32_t> column(count, 0);
+        std::vector<std::int32_t> extended(static_cast<std::size_t>(width + 2 * radius) * channels);
+        std::vector<std::int32_t> sums(count);
+
+        // Column sums of the window of the first row of the band, then slid down by one row at a time
+        for (int y = y_begin - radius; y <= y_begin + radius; ++y)
+        {
+            const std::uint8_t* row = src.row(y);
+            for (std::size_t i = 0; i < count; ++i)
+                column[i] += row[i];
+        }
+
+        for (int y = y_begin; y < y_end; ++y)
+        {
+            if (y > y_begin)
+            {
+                const std::uint8_t* entering = src.row(y + radius);
+                const std::uint8_t* leaving = src.row(y - radius - 1);
+                for (std::size_t i = 0; i < count; ++i)
+                    column[i] += entering[i] - leaving[i];
+            }
+
+            // Columns outside the image extend the column sums, a constant border column summing diameter border values
+            std::copy(column.begin(), column.end(), extended.begin() + static_cast<std::size_t>(radius) * channels);
+            const auto extend_column = [&](int x) {
+                const int src_x = detail::border_interpolate(x, width, border);
+                for (int c = 0; c < channels; ++c)
+                    extended[static_cast<std::size_t>(x + radius) * channels + c] = src_x < 0 ? border_pixel[c] * diameter : column[static_cast<std::size_t>(src_x) * channels + c];
+            };
+            for (int x = -radius; x < 0; ++x)
+                extend_column(x);
+            for (int x = width; x < width + radius; ++x)
+                extend_column(x);
+            row_sums(extended.data(), width, channels, radius, sums.data());
+
+            // The window area is odd, so the exact mean is never halfway between two integers and rounding in double is exact
+            std::uint8_t* out = blurred_image.data() + static_cast<std::size_t>(y) * count;
+            for (std::size_t i = 0; i < count; ++i)
+                out[i] = static_cast<std::uint8_t>(sums[i] * inverse_area + 0.5);
+        }
+    }, std::max(32, diameter));
+}
+
+std::vector<std::uint8_t> box_blur(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    int radius,
+    border_mode border,
+    const std::vector<std::uint8_t>& border_value)
+{
+    std::vector<std::uint8_t> blurred_image;
+    box_blur(image, width, height, channels, radius, blurred_image, border, border_value);
+    return blurred_image;
+}
+
+void gaussian_blur(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    float sigma,
+    std::vector<std::uint8_t>& blurred_image,
+    int radius,
+    border_mode border,
+    const std::vector<std::uint8_t>& border_value)
+{
+    if (!(sigma > 0.0f))
+    {
+        throw std::runtime_error("Invalid Gaussian sigma: " + std::to_string(sigma) + ", expected a positive value");
+    }
+
+    if (radius < 0)
+    {
+        throw std::runtime_error("Invalid Gaussian radius: " + std::to_string(radius));
+    }
+
+    if (&image == &blurred_image)
+    {
+        std::vector<std::uint8_t> result;
+        gaussian_blur(image, width, height, channels, sigma, result, radius, border, border_value);
+        blurred_image = std::move(result);
+        return;
+    }
+
+    if (radius == 0)
+        radius = std::max(1, static_cast<int>(std::ceil(3.0f * sigma)));
+
+    const std::size_t count = static_cast<std::size_t>(std::max(width, 0)) * channels;
+    blurred_image.resize(count * std::max(height, 0));
+    if (count == 0 || height <= 0)
+        return;
+
+    const border_accessor src(image, width, height, channels, border, border_value);
+    const auto weights = gaussian_weights(sigma, radius);
+    const int taps = 2 * radius + 1;
+
+    detail::parallel_for(height, [&](int y_begin, int y_end) {
+        std::vector<std::uint8_t> extended(static_cast<std::size_t>(width + 2 * radius) * channels);
+        std::vector<std::int16_t> ring(static_cast<std::size_t>(taps) * count);
+        std::vector<const std::int16_t*> rows(taps);
+
+        // Horizontally filtered rows are kept in a ring of taps rows, row y in slot y mod taps
+        const auto slot = [&](int y) { return ring.data() + static_cast<std::size_t>(((y % taps) + taps) % taps) * count; };
+        const auto filter_row = [&](int y) {
+            src.copy_row(y, radius, radius, extended.data());
+            gaussian_row(extended.data(), count, static_cast<std::size_t>(channels), weights.data(), taps, slot(y));
+        };
+
+        for (int y = y_begin - radius; y < y_begin + radius; ++y)
+            filter_row(y);
+
+        for (int y = y_begin; y < y_end; ++y)
+        {
+            filter_row(y + radius);
+            for (int k = 0; k < taps; ++k)
+                rows[k] = slot(y - radius + k);
+            gaussian_column(rows.data(), weights.data(), taps, count, blurred_image.data() + static_cast<std::size_t>(y) * count);
+        }
+    }, std::max(32, taps));
+}
+
+std::vector<std::uint8_t> gaussian_blur(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    float sigma,
+    int radius,
+    border_mode border,
+    const std::vector<std::uint8_t>& border_value)
+{
+    std::vector<std::uint8_t> blurred_image;
+    gaussian_blur(image, width, height, channels, sigma, blurred_image, radius, border, border_value);
+    return blurred_image;
+}
+
+}
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <teiacare/image/image_io.hpp>
+#include <teiacare/image/basic_image.hpp>
 
 //clang-format off
 #define STB_IMAGE_IMPLEMENTATION
@@ -78,13 +79,30 @@ auto image_load_from_memory(uint8_t* memory_data, std::size_t memory_data_size)
 }
 
 void image_save(const std::filesystem::path& image_path, const uint8_t* image_data_ptr, int width, int height, int channels)
+{
+    image_save(image_path, image_view{image_data_ptr, width, height, channels});
+}
+
+void image_save(const std::filesystem::path& image_path, const std::vector<uint8_t>& image_data, int width, int height, int channels)
+{
+    return image_save(image_path, image_data.data(), width, height, channels);
+}
+
+void image_save(const std::filesystem::path& image_path, image_view image)
 {
     bool ok = false;
     const std::string image_ext = (image_path.has_extension() ? image_path.extension().string() : "png");
 
+    // Only the PNG writer takes a row stride, the other ones need packed rows
+    const tc::img::image packed = (image_ext == ".png" || image.is_contiguous()) ? tc::img::image{} : tc::img::image{image};
+    const std::uint8_t* image_data_ptr = packed.empty() ? image.data() : packed.data();
+    const int width = image.width();
+    const int height = image.height();
+    const int channels = image.channels();
+
     if (image_ext == ".png")
     {
-        ok = stbi_write_png(image_path.string().c_str(), width, height, channels, image_data_ptr, width * channels) != 0;
+        ok = stbi_write_png(image_path.string().c_str(), width, height, channels, image_data_ptr, static_cast<int>(image.stride())) != 0;
     }
     else if (image_ext == ".jpg" || image_ext == ".jpeg")
     {
@@ -108,9 +126,4 @@ void image_save(const std::filesystem::path& image_path, const uint8_t* image_da
     }
 }
 
-void image_save(const std::filesystem::path& image_path, const std::vector<uint8_t>& image_data, int width, int height, int channels)
-{
-    return image_save(image_path, image_data.data(), width, height, channels);
-}
-
 }
@@ -0,0 +1,1532 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <teiacare/image/image_processing.hpp>
+
+#include "float16_convert.hpp"
+#include "interleave.hpp"
+#include "parallel.hpp"
+#include "resize_plan.hpp"
+#include "simd.hpp"
+#include "yuv_convert.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace tc::img
+{
+namespace
+{
+/*!
+ * \brief Source indices and interpolation weight of the second one, for one output coordinate of a crop.
+ */
+struct crop_sample
+{
+    int index0;
+    int index1;
+    float weight1;
+};
+
+/*!
+ * \brief Map output coordinates [0, dst_size) onto the source range [start, start + length), aligning pixel centers.
+ */
+void make_crop_samples(int start, int length, int src_size, int dst_size, std::vector<crop_sample>& samples)
+{
+    samples.resize(dst_size);
+    const float scale = static_cast<float>(length) / dst_size;
+    const int last = start + length - 1;
+    for (int i = 0; i < dst_size; ++i)
+    {
+        // Samples never leave the crop region, and coordinates falling outside the image replicate its border pixels
+        const float s = std::clamp(std::clamp(start + (i + 0.5f) * scale - 0.5f, static_cast<float>(start), static_cast<float>(last)), 0.0f, static_cast<float>(src_size - 1));
+        const int index0 = static_cast<int>(s);
+        samples[i] = crop_sample{index0, std::min(index0 + 1, std::clamp(last, 0, src_size - 1)), s - index0};
+    }
+}
+
+/*!
+ * \brief Compute a * b + c, fused when the FMA kernels are enabled so that scalar tails match the vector lanes.
+ */
+inline float multiply_add(float a, float b, float c)
+{
+#if defined(TC_IMG_AVX2)
+    return std::fma(a, b, c);
+#else
+    return a * b + c;
+#endif
+}
+
+#if defined(TC_IMG_AVX2)
+/*!
+ * \brief Normalize the channel stored at bit offset 8 * k of each 32-bit pixel lane and store it to its plane.
+ */
+inline void store_lane_channel(__m256i pixels, int k, __m256 scale, __m256 offset, float* dst)
+{
+    const __m256i values = _mm256_and_si256(_mm256_srlv_epi32(pixels, _mm256_set1_epi32(8 * k)), _mm256_set1_epi32(0xFF));
+    _mm256_storeu_ps(dst, _mm256_fmadd_ps(_mm256_cvtepi32_ps(values), scale, offset));
+}
+#elif defined(TC_IMG_SSE2)
+/*!
+ * \brief Normalize the channel stored at bit offset 8 * k of each 32-bit pixel lane and store it to its plane.
+ */
+inline void store_lane_channel(__m128i pixels, int k, __m128 scale, __m128 offset, float* dst)
+{
+    const __m128i values = _mm_and_si128(_mm_srl_epi32(pixels, _mm_cvtsi32_si128(8 * k)), _mm_set1_epi32(0xFF));
+    _mm_storeu_ps(dst, _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(values), scale), offset));
+}
+#elif defined(TC_IMG_NEON)
+/*!
+ * \brief Normalize 8 values of one channel and store them to its plane.
+ */
+inline void store_channel(uint8x8_t values, float32x4_t scale, float32x4_t offset, float* dst)
+{
+    const uint16x8_t wide = vmovl_u8(values);
+    vst1q_f32(dst, vmlaq_f32(offset, vcvtq_f32_u32(vmovl_u16(vget_low_u16(wide))), scale));
+    vst1q_f32(dst + 4, vmlaq_f32(offset, vcvtq_f32_u32(vmovl_u16(vget_high_u16(wide))), scale));
+}
+#endif
+
+/*!
+ * \brief Convert pixels [begin, end) of an interleaved image to planar floats, input channel k going to planes[k].
+ * \param pixel_count Total number of pixels of the image, bounding the vector loads
+ */
+template <int Channels>
+void create_blob_range(const std::uint8_t* image, int channels, float* const* planes, const float* scale, const float* offset, std::size_t begin, std::size_t end, std::size_t pixel_count)
+{
+    if constexpr (Channels > 0)
+        channels = Channels;
+
+    std::size_t i = begin;
+
+#if defined(TC_IMG_AVX2)
+    if constexpr (Channels == 1 || Channels == 3 || Channels == 4)
+    {
+        __m256 vscale[Channels];
+        __m256 voffset[Channels];
+        for (int k = 0; k < Channels; ++k)
+        {
+            vscale[k] = _mm256_set1_ps(scale[k]);
+            voffset[k] = _mm256_set1_ps(offset[k]);
+        }
+
+        // 3 channel pixels are read with 16-byte loads, the last one extending 4 bytes past the 8 pixels
+        const std::size_t limit = (Channels == 3) ? std::min(end, pixel_count > 2 ? pixel_count - 2 : 0) : end;
+        const __m128i expand = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+        for (; i + 8 <= limit; i += 8)
+        {
+            const std::uint8_t* src = image + i * Channels;
+            if constexpr (Channels == 1)
+            {
+                const __m256i values = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)));
+                _mm256_storeu_ps(planes[0] + i, _mm256_fmadd_ps(_mm256_cvtepi32_ps(values), vscale[0], voffset[0]));
+            }
+            else
+            {
+                __m256i pixels;
+                if constexpr (Channels == 4)
+                {
+                    pixels = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+                }
+                else
+                {
+                    // Spread the 3 bytes of each pixel to its own 32-bit lane
+                    const __m128i lo = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)), expand);
+                    const __m128i hi = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 12)), expand);
+                    pixels = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+                }
+                for (int k = 0; k < Channels; ++k)
+                    store_lane_channel(pixels, k, vscale[k], voffset[k], planes[k] + i);
+            }
+        }
+    }
+#elif defined(TC_IMG_SSE2)
+    if constexpr (Channels == 1 || Channels == 3 || Channels == 4)
+    {
+        __m128 vscale[Channels];
+        __m128 voffset[Channels];
+        for (int k = 0; k < Channels; ++k)
+        {
+            vscale[k] = _mm_set1_ps(scale[k]);
+            voffset[k] = _mm_set1_ps(offset[k]);
+        }
+
+        if constexpr (Channels == 1)
+        {
+            const __m128i zero = _mm_setzero_si128();
+            for (; i + 16 <= end; i += 16)
+            {
+                const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(image + i));
+                const __m128i words[2] = {_mm_unpacklo_epi8(bytes, zero), _mm_unpackhi_epi8(bytes, zero)};
+                for (int h = 0; h < 2; ++h)
+                {
+                    const __m128 lo = _mm_cvtepi32_ps(_mm_unpacklo_epi16(words[h], zero));
+                    const __m128 hi = _mm_cvtepi32_ps(_mm_unpackhi_epi16(words[h], zero));
+                    _mm_storeu_ps(planes[0] + i + 8 * h, _mm_add_ps(_mm_mul_ps(lo, vscale[0]), voffset[0]));
+                    _mm_storeu_ps(planes[0] + i + 8 * h + 4, _mm_add_ps(_mm_mul_ps(hi, vscale[0]), voffset[0]));
+                }
+            }
+        }
+        else
+        {
+            // 3 channel pixels are read with a 16-byte load, extending 4 bytes past the 4 pixels
+            const std::size_t limit = (Channels == 3) ? std::min(end, pixel_count > 2 ? pixel_count - 2 : 0) : end;
+            for (; i + 4 <= limit; i += 4)
+            {
+                const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(image + i * Channels));
+                __m128i pixels = bytes;
+                if constexpr (Channels == 3)
+                {
+                    // Spread the 3 bytes of each pixel to its own 32-bit lane
+                    const __m128i p01 = _mm_unpacklo_epi32(bytes, _mm_srli_si128(bytes, 3));
+                    const __m128i p23 = _mm_unpacklo_epi32(_mm_srli_si128(bytes, 6), _mm_srli_si128(bytes, 9));
+                    pixels = _mm_unpacklo_epi64(p01, p23);
+                }
+                for (int k = 0; k < Channels; ++k)
+                    store_lane_channel(pixels, k, vscale[k], voffset[k], planes[k] + i);
+            }
+        }
+    }
+#elif defined(TC_IMG_NEON)
+    if constexpr (Channels == 1 || Channels == 3 || Channels == 4)
+    {
+        float32x4_t vscale[Channels];
+        float32x4_t voffset[Channels];
+        for (int k = 0; k < Channels; ++k)
+        {
+            vscale[k] = vdupq_n_f32(scale[k]);
+            voffset[k] = vdupq_n_f32(offset[k]);
+        }
+
+        for (; i + 8 <= end; i += 8)
+        {
+            const std::uint8_t* src = image + i * Channels;
+            if constexpr (Channels == 1)
+            {
+                store_channel(vld1_u8(src), vscale[0], voffset[0], planes[0] + i);
+            }
+            else if constexpr (Channels == 3)
+            {
+                const uint8x8x3_t pixels = vld3_u8(src);
+                for (int k = 0; k < 3; ++k)
+                    store_channel(pixels.val[k], vscale[k], voffset[k], planes[k] + i);
+            }
+            else
+            {
+                const uint8x8x4_t pixels = vld4_u8(src);
+                for (int k = 0; k < 4; ++k)
+                    store_channel(pixels.val[k], vscale[k], voffset[k], planes[k] + i);
+            }
+        }
+    }
+#endif
+
+    for (; i < end; ++i)
+    {
+        const std::uint8_t* pixel = image + i * channels;
+        for (int k = 0; k < channels; ++k)
+            planes[k][i] = multiply_add(static_cast<float>(pixel[k]), scale[k], offset[k]);
+    }
+}
+
+/*!
+ * \brief Number of interleaved values sharing the coefficient pattern of scale_interleaved, a multiple of the vector widths and of 1, 2, 3 and 4 channels.
+ */
+constexpr int interleaved_pattern_size = 24;
+
+/*!
+ * \brief Convert count interleaved values to floats, value e using the coefficients at e % interleaved_pattern_size of the patterns.
+ *
+ * This is the NHWC blob of images keeping their channel order: a plain convert-and-scale of the whole range.
+ */
+void scale_interleaved(const std::uint8_t* src, float* dst, std::size_t count, const float* scale_pattern, const float* offset_pattern)
+{
+    std::size_t e = 0;
+
+#if defined(TC_IMG_AVX2)
+    __m256 vscale[3];
+    __m256 voffset[3];
+    for (int v = 0; v < 3; ++v)
+    {
+        vscale[v] = _mm256_loadu_ps(scale_pattern + 8 * v);
+        voffset[v] = _mm256_loadu_ps(offset_pattern + 8 * v);
+    }
+
+    for (; e + interleaved_pattern_size <= count; e += interleaved_pattern_size)
+    {
+        for (int v = 0; v < 3; ++v)
+        {
+            const __m256i values = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + e + 8 * v)));
+            _mm256_storeu_ps(dst + e + 8 * v, _mm256_fmadd_ps(_mm256_cvtepi32_ps(values), vscale[v], voffset[v]));
+        }
+    }
+#elif defined(TC_IMG_SSE2)
+    __m128 vscale[6];
+    __m128 voffset[6];
+    for (int v = 0; v < 6; ++v)
+    {
+        vscale[v] = _mm_loadu_ps(scale_pattern + 4 * v);
+        voffset[v] = _mm_loadu_ps(offset_pattern + 4 * v);
+    }
+
+    const __m128i zero = _mm_setzero_si128();
+    for (; e + interleaved_pattern_size <= count; e += interleaved_pattern_size)
+    {
+        for (int v = 0; v < 3; ++v)
+        {
+            const __m128i words = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + e + 8 * v)), zero);
+            const __m128 lo = _mm_cvtepi32_ps(_mm_unpacklo_epi16(words, zero));
+            const __m128 hi = _mm_cvtepi32_ps(_mm_unpackhi_epi16(words, zero));
+            _mm_storeu_ps(dst + e + 8 * v, _mm_add_ps(_mm_mul_ps(lo, vscale[2 * v]), voffset[2 * v]));
+            _mm_storeu_ps(dst + e + 8 * v + 4, _mm_add_ps(_mm_mul_ps(hi, vscale[2 * v + 1]), voffset[2 * v + 1]));
+        }
+    }
+#elif defined(TC_IMG_NEON)
+    float32x4_t vscale[6];
+    float32x4_t voffset[6];
+    for (int v = 0; v < 6; ++v)
+    {
+        vscale[v] = vld1q_f32(scale_pattern + 4 * v);
+        voffset[v] = vld1q_f32(offset_pattern + 4 * v);
+    }
+
+    for (; e + interleaved_pattern_size <= count; e += interleaved_pattern_size)
+    {
+        for (int v = 0; v < 3; ++v)
+        {
+            const uint16x8_t wide = vmovl_u8(vld1_u8(src + e + 8 * v));
+            vst1q_f32(dst + e + 8 * v, vmlaq_f32(voffset[2 * v], vcvtq_f32_u32(vmovl_u16(vget_low_u16(wide))), vscale[2 * v]));
+            vst1q_f32(dst + e + 8 * v + 4, vmlaq_f32(voffset[2 * v + 1], vcvtq_f32_u32(vmovl_u16(vget_high_u16(wide))), vscale[2 * v + 1]));
+        }
+    }
+#endif
+
+    for (; e < count; ++e)
+        dst[e] = multiply_add(static_cast<float>(src[e]), scale_pattern[e % interleaved_pattern_size], offset_pattern[e % interleaved_pattern_size]);
+}
+
+/*!
+ * \brief Convert pixels [begin, end) of an interleaved image to an interleaved blob, input channel k going to output channel plane[k].
+ *
+ * Instances with Channels > 0 swap the R and B channels, so that the source of each output channel is a compile time constant once the channel loop is unrolled.
+ */
+template <int Channels>
+void reorder_interleaved_range(const std::uint8_t* image, int channels, float* blob, const int* plane, const float* scale, const float* offset, std::size_t begin, std::size_t end)
+{
+    if constexpr (Channels > 0)
+    {
+        static_assert(Channels >= 3, "Swapping R and B requires at least 3 channels");
+        float out_scale[Channels];
+        float out_offset[Channels];
+        for (int k = 0; k < Channels; ++k)
+        {
+            out_scale[plane[k]] = scale[k];
+            out_offset[plane[k]] = offset[k];
+        }
+
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            const std::uint8_t* pixel = image + i * Channels;
+            float* out = blob + i * Channels;
+            for (int c = 0; c < Channels; ++c)
+                out[c] = multiply_add(static_cast<float>(pixel[c < 3 ? 2 - c : c]), out_scale[c], out_offset[c]);
+        }
+    }
+    else
+    {
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            const std::uint8_t* pixel = image + i * channels;
+            float* out = blob + i * channels;
+            for (int k = 0; k < channels; ++k)
+                out[plane[k]] = multiply_add(static_cast<float>(pixel[k]), scale[k], offset[k]);
+        }
+    }
+}
+
+/*!
+ * \brief Destination plane and coefficients of each input channel of a blob, so that kernels read every pixel once.
+ */
+struct blob_channel_map
+{
+    std::vector<int> plane;
+    std::vector<float> scale;
+    std::vector<float> offset;
+    bool swapRB_channels;
+
+    // Coefficients of 24 consecutive interleaved values, used by NHWC blobs keeping the channel order when the channel count divides 24
+    std::array<float, interleaved_pattern_size> scale_pattern;
+    std::array<float, interleaved_pattern_size> offset_pattern;
+};
+
+blob_channel_map make_blob_channel_map(int channels, const float* scale, const float* offset, bool swapRB_channels)
+{
+    blob_channel_map map{std::vector<int>(channels), std::vector<float>(channels), std::vector<float>(channels), swapRB_channels, {}, {}};
+    for (int k = 0; k < channels; ++k)
+    {
+        const int c = (swapRB_channels && k < 3) ? (2 - k) : k;
+        map.plane[k] = c;
+        map.scale[k] = scale[c];
+        map.offset[k] = offset[c];
+    }
+    if (interleaved_pattern_size % channels == 0)
+    {
+        for (int e = 0; e < interleaved_pattern_size; ++e)
+        {
+            map.scale_pattern[e] = scale[e % channels];
+            map.offset_pattern[e] = offset[e % channels];
+        }
+    }
+    return map;
+}
+
+/*!
+ * \brief Convert pixels [begin, end) of one image to its planar blob.
+ * \param pixel_count Number of pixels readable from image, bounding the vector loads
+ * \param plane_size Distance in values between the planes of the blob
+ */
+void convert_blob_pixels(const std::uint8_t* image, int channels, std::size_t pixel_count, std::size_t plane_size, float* blob, const blob_channel_map& map, std::size_t begin, std::size_t end)
+{
+    std::vector<float*> planes(channels);
+    for (int k = 0; k < channels; ++k)
+        planes[k] = blob + map.plane[k] * plane_size;
+
+    switch (channels)
+    {
+    case 1:
+        return create_blob_range<1>(image, channels, planes.data(), map.scale.data(), map.offset.data(), begin, end, pixel_count);
+    case 3:
+        return create_blob_range<3>(image, channels, planes.data(), map.scale.data(), map.offset.data(), begin, end, pixel_count);
+    case 4:
+        return create_blob_range<4>(image, channels, planes.data(), map.scale.data(), map.offset.data(), begin, end, pixel_count);
+    default:
+        return create_blob_range<0>(image, channels, planes.data(), map.scale.data(), map.offset.data(), begin, end, pixel_count);
+    }
+}
+
+/*!
+ * \brief Convert pixels [begin, end) of one image to its planar 16-bit floating point blob.
+ *
+ * Pixels are normalized in float into a small per-thread buffer that stays in L1, then rounded while being stored,
+ * so the blob itself is written once with 2-byte values.
+ */
+template <typename T>
+void convert_blob_pixels(const std::uint8_t* image, int channels, std::size_t pixel_count, std::size_t plane_size, T* blob, const blob_channel_map& map, std::size_t begin, std::size_t end)
+{
+    constexpr std::size_t block_size = 512;
+    std::vector<float> buffer(static_cast<std::size_t>(channels) * block_size);
+    std::vector<float*> planes(channels);
+    for (int k = 0; k < channels; ++k)
+        planes[k] = buffer.data() + k * block_size;
+
+    for (std::size_t i = begin; i < end; i += block_size)
+    {
+        const std::size_t count = std::min(block_size, end - i);
+        const std::uint8_t* block = image + i * channels;
+        switch (channels)
+        {
+        case 1:
+            create_blob_range<1>(block, channels, planes.data(), map.scale.data(), map.offset.data(), 0, count, pixel_count - i);
+            break;
+        case 3:
+            create_blob_range<3>(block, channels, planes.data(), map.scale.data(), map.offset.data(), 0, count, pixel_count - i);
+            break;
+        case 4:
+            create_blob_range<4>(block, channels, planes.data(), map.scale.data(), map.offset.data(), 0, count, pixel_count - i);
+            break;
+        default:
+            create_blob_range<0>(block, channels, planes.data(), map.scale.data(), map.offset.data(), 0, count, pixel_count - i);
+            break;
+        }
+
+        for (int k = 0; k < channels; ++k)
+            detail::convert_float_values(planes[k], blob + map.plane[k] * plane_size + i, count);
+    }
+}
+
+/*!
+ * \brief Convert pixels [begin, end) of one image to its interleaved blob.
+ */
+void convert_interleaved_blob_pixels(const std::uint8_t* image, int channels, float* blob, const blob_channel_map& map, std::size_t begin, std::size_t end)
+{
+    if (!map.swapRB_channels && interleaved_pattern_size % channels == 0)
+    {
+        const std::size_t first = begin * channels;
+        return scale_interleaved(image + first, blob + first, (end - begin) * channels, map.scale_pattern.data(), map.offset_pattern.data());
+    }
+
+    const bool swap = map.swapRB_channels;
+    switch (channels)
+    {
+    case 3:
+        return swap ? reorder_interleaved_range<3>(image, channels, blob, map.plane.data(), map.scale.data(), map.offset.data(), begin, end)
+                    : reorder_interleaved_range<0>(image, channels, blob, map.plane.data(), map.scale.data(), map.offset.data(), begin, end);
+    case 4:
+        return swap ? reorder_interleaved_range<4>(image, channels, blob, map.plane.data(), map.scale.data(), map.offset.data(), begin, end)
+                    : reorder_interleaved_range<0>(image, channels, blob, map.plane.data(), map.scale.data(), map.offset.data(), begin, end);
+    default:
+        return reorder_interleaved_range<0>(image, channels, blob, map.plane.data(), map.scale.data(), map.offset.data(), begin, end);
+    }
+}
+
+/*!
+ * \brief Convert pixels [begin, end) of one image to its interleaved 16-bit floating point blob, through an L1-resident float buffer.
+ */
+template <typename T>
+void convert_interleaved_blob_pixels(const std::uint8_t* image, int channels, T* blob, const blob_channel_map& map, std::size_t begin, std::size_t end)
+{
+    constexpr std::size_t block_size = 512;
+    std::vector<float> buffer(static_cast<std::size_t>(channels) * block_size);
+    for (std::size_t i = begin; i < end; i += block_size)
+    {
+        const std::size_t count = std::min(block_size, end - i);
+        convert_interleaved_blob_pixels(image + i * channels, channels, buffer.data(), map, 0, count);
+        detail::convert_float_values(buffer.data(), blob + i * channels, count * channels);
+    }
+}
+
+/*!
+ * \brief Minimum number of rows converted by a single thread, so that each chunk covers about 64K pixels.
+ */
+int blob_rows_per_chunk(int width)
+{
+    return std::max(1, (1 << 16) / std::max(width, 1));
+}
+
+/*!
+ * \brief Convert an image to a planar blob of the given element type, rows being split across threads.
+ */
+template <typename T>
+void convert_blob(image_view image, T* blob, const float* scale, const float* offset, bool swapRB_channels, blob_layout layout)
+{
+    const int width = image.width();
+    const int height = image.height();
+    const int channels = image.channels();
+    if (image.empty())
+        return;
+
+    const auto map = make_blob_channel_map(channels, scale, offset, swapRB_channels);
+    const std::size_t pixel_count = static_cast<std::size_t>(width) * height;
+    detail::parallel_for(height, [&](int y_begin, int y_end) {
+        if (image.is_contiguous())
+        {
+            const std::size_t begin = static_cast<std::size_t>(y_begin) * width;
+            const std::size_t end = static_cast<std::size_t>(y_end) * width;
+            if (layout == blob_layout::nhwc)
+                convert_interleaved_blob_pixels(image.data(), channels, blob, map, begin, end);
+            else
+                convert_blob_pixels(image.data(), channels, pixel_count, pixel_count, blob, map, begin, end);
+            return;
+        }
+
+        // Padded rows are converted one at a time as single row images, written at their offset in the blob
+        for (int y = y_begin; y < y_end; ++y)
+        {
+            const std::size_t first = static_cast<std::size_t>(y) * width;
+            if (layout == blob_layout::nhwc)
+                convert_interleaved_blob_pixels(image.row(y), channels, blob + first * channels, map, 0, width);
+            else
+                convert_blob_pixels(image.row(y), channels, width, pixel_count, blob + first, map, 0, width);
+        }
+    }, blob_rows_per_chunk(width));
+}
+
+/*!
+ * \brief Look up pixels [begin, end) of an interleaved image in the per channel tables, input channel k of pixel i going to planes[k][i * pixel_stride].
+ * \param pixel_stride Distance between the values of consecutive pixels in a channel, 1 for NCHW blobs and the channel count for NHWC ones
+ */
+template <int Channels, typename T>
+void quantize_blob_range(const std::uint8_t* image, int channels, T* const* planes, std::size_t pixel_stride, const T* lut, std::size_t begin, std::size_t end)
+{
+    if constexpr (Channels > 0)
+    {
+        // 8-bit stores may alias any pointer, so plane and table pointers are kept in locals to avoid reloading them for each value
+        T* out[Channels];
+        const T* tables[Channels];
+        for (int k = 0; k < Channels; ++k)
+        {
+            out[k] = planes[k];
+            tables[k] = lut + k * 256;
+        }
+
+        const std::uint8_t* pixel = image + begin * Channels;
+        for (std::size_t i = begin; i < end; ++i, pixel += Channels)
+        {
+            for (int k = 0; k < Channels; ++k)
+                out[k][i * pixel_stride] = tables[k][pixel[k]];
+        }
+    }
+    else
+    {
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            const std::uint8_t* pixel = image + i * channels;
+            for (int k = 0; k < channels; ++k)
+                planes[k][i * pixel_stride] = lut[k * 256 + pixel[k]];
+        }
+    }
+}
+
+/*!
+ * \brief Quantize an image to a planar 8-bit blob through one 256-entry table per channel, rows being split across threads.
+ */
+template <typename T>
+void quantize_blob(image_view image, T* blob, const float* scale, const float* offset, const std::vector<float>& quant_scale, const std::vector<int>& zero_point, bool swapRB_channels, blob_layout layout)
+{
+    const int width = image.width();
+    const int height = image.height();
+    const int channels = image.channels();
+    const auto components_valid = [channels](std::size_t size) {
+        return size == 1 || size == static_cast<std::size_t>(channels);
+    };
+    if (!components_valid(quant_scale.size()) || !components_valid(zero_point.size()))
+    {
+        throw std::runtime_error("Invalid quantization parameters: expected 1 or " + std::to_string(channels) + " components, got " + std::to_string(quant_scale.size()) + " scales and " + std::to_string(zero_point.size()) + " zero points");
+    }
+    for (float q : quant_scale)
+    {
+        if (!std::isfinite(q) || q <= 0.0f)
+        {
+            throw std::runtime_error("Invalid quantization scale: " + std::to_string(q) + ", the value must be positive and finite");
+        }
+    }
+    constexpr int min_value = std::numeric_limits<T>::min();
+    constexpr int max_value = std::numeric_limits<T>::max();
+    for (int zp : zero_point)
+    {
+        if (zp < min_value || zp > max_value)
+        {
+            throw std::runtime_error("Invalid quantization zero point: " + std::to_string(zp) + ", expected a value in [" + std::to_string(min_value) + ", " + std::to_string(max_value) + "]");
+        }
+    }
+
+    if (image.empty())
+        return;
+
+    // The table of input channel k holds the quantized values of the output channel it is stored to
+    const auto map = make_blob_channel_map(channels, scale, offset, swapRB_channels);
+    std::vector<T> lut(static_cast<std::size_t>(channels) * 256);
+    for (int k = 0; k < channels; ++k)
+    {
+        const int c = map.plane[k];
+        const float q = quant_scale[quant_scale.size() == 1 ? 0 : c];
+        const int zp = zero_point[zero_point.size() == 1 ? 0 : c];
+        for (int v = 0; v < 256; ++v)
+        {
+            // Computed in float as create_blob does, then rounded half to even by the default rounding mode
+            const float value = std::nearbyint(multiply_add(static_cast<float>(v), map.scale[k], map.offset[k]) / q) + static_cast<float>(zp);
+            lut[k * 256 + v] = static_cast<T>(std::clamp(value, static_cast<float>(min_value), static_cast<float>(max_value)));
+        }
+    }
+
+    const std::size_t pixel_count = static_cast<std::size_t>(width) * height;
+    const bool interleaved = layout == blob_layout::nhwc;
+    const std::size_t pixel_stride = interleaved ? channels : 1;
+    std::vector<T*> planes(channels);
+    for (int k = 0; k < channels; ++k)
+        planes[k] = blob + map.plane[k] * (interleaved ? 1 : pixel_count);
+
+    const auto quantize_range = [&](const std::uint8_t* pixels, T* const* dst, std::size_t begin, std::size_t end) {
+        switch (channels)
+        {
+        case 1:
+            return quantize_blob_range<1>(pixels, channels, dst, pixel_stride, lut.data(), begin, end);
+        case 3:
+            return quantize_blob_range<3>(pixels, channels, dst, pixel_stride, lut.data(), begin, end);
+        case 4:
+            return quantize_blob_range<4>(pixels, channels, dst, pixel_stride, lut.data(), begin, end);
+        default:
+            return quantize_blob_range<0>(pixels, channels, dst, pixel_stride, lut.data(), begin, end);
+        }
+    };
+
+    detail::parallel_for(height, [&](int y_begin, int y_end) {
+        if (image.is_contiguous())
+            return quantize_range(image.data(), planes.data(), static_cast<std::size_t>(y_begin) * width, static_cast<std::size_t>(y_end) * width);
+
+        // Padded rows are quantized one at a time, the planes starting at the offset of the row in the blob
+        std::vector<T*> row_planes(channels);
+        for (int y = y_begin; y < y_end; ++y)
+        {
+            for (int k = 0; k < channels; ++k)
+                row_planes[k] = planes[k] + static_cast<std::size_t>(y) * width * pixel_stride;
+            quantize_range(image.row(y), row_planes.data(), 0, width);
+        }
+    }, blob_rows_per_chunk(width));
+}
+
+/*!
+ * \brief Number of consecutive values sharing one coefficient pattern in saturate_values:
+ * a multiple of the 16 values converted per step and of the channel counts 1, 2, 3, 4, 6, 8, 12 and 16.
+ */
+constexpr std::size_t saturate_pattern_size = 48;
+
+/*!
+ * \brief Round a value to nearest and saturate it to [0, 255], NaNs becoming 0 as in the SIMD paths.
+ */
+inline std::uint8_t saturate_pixel(float value)
+{
+    return static_cast<std::uint8_t>(std::nearbyint(value > 0.0f ? std::min(value, 255.0f) : 0.0f));
+}
+
+#if defined(TC_IMG_AVX2)
+/*!
+ * \brief Compute src * scale + offset for 8 values, clamped to [0, 255] and rounded to nearest 32-bit integers.
+ */
+inline __m256i saturate_lanes(const float* src, const float* scale, const float* offset)
+{
+    // Clamping first keeps NaNs and out of range values, which convert to INT_MIN, away from the integer conversion
+    const __m256 value = _mm256_fmadd_ps(_mm256_loadu_ps(src), _mm256_loadu_ps(scale), _mm256_loadu_ps(offset));
+    return _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(value, _mm256_setzero_ps()), _mm256_set1_ps(255.0f)));
+}
+#elif defined(TC_IMG_SSE2)
+/*!
+ * \brief Compute src * scale + offset for 4 values, clamped to [0, 255] and rounded to nearest 32-bit integers.
+ */
+inline __m128i saturate_lanes(const float* src, const float* scale, const float* offset)
+{
+    // Clamping first keeps NaNs and out of range values, which convert to INT_MIN, away from the integer conversion
+    const __m128 value = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(src), _mm_loadu_ps(scale)), _mm_loadu_ps(offset));
+    return _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(value, _mm_setzero_ps()), _mm_set1_ps(255.0f)));
+}
+#elif defined(TC_IMG_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+/*!
+ * \brief Compute src * scale + offset for 4 values, clamped to [0, 255] and rounded to nearest 32-bit integers.
+ */
+inline int32x4_t saturate_lanes(const float* src, const float* scale, const float* offset)
+{
+    // vmaxnm returns the number when the other operand is a NaN
+    const float32x4_t value = vmlaq_f32(vld1q_f32(offset), vld1q_f32(src), vld1q_f32(scale));
+    return vcvtnq_s32_f32(vminq_f32(vmaxnmq_f32(value, vdupq_n_f32(0.0f)), vdupq_n_f32(255.0f)));
+}
+#endif
+
+/*!
+ * \brief Convert count values to pixels, computing round(src * scale + offset) saturated to [0, 255].
+ * \param scale_pattern Multipliers of saturate_pattern_size consecutive values, repeated over the whole range
+ * \param offset_pattern Addends of saturate_pattern_size consecutive values, repeated over the whole range
+ */
+void saturate_values(const float* src, std::uint8_t* dst, std::size_t count, const float* scale_pattern, const float* offset_pattern)
+{
+    std::size_t e = 0;
+    std::size_t phase = 0;
+#if defined(TC_IMG_AVX2)
+    for (; e + 16 <= count; e += 16)
+    {
+        // The in-lane packs leave the dwords ordered as a0-3 b0-3 a4-7 b4-7
+        const __m256i a = saturate_lanes(src + e, scale_pattern + phase, offset_pattern + phase);
+        const __m256i b = saturate_lanes(src + e + 8, scale_pattern + phase + 8, offset_pattern + phase + 8);
+        const __m256i words = _mm256_packs_epi32(a, b);
+        const __m128i bytes = _mm_packus_epi16(_mm256_castsi256_si128(words), _mm256_extracti128_si256(words, 1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + e), _mm_shuffle_epi32(bytes, _MM_SHUFFLE(3, 1, 2, 0)));
+        phase = phase + 16 == saturate_pattern_size ? 0 : phase + 16;
+    }
+#elif defined(TC_IMG_SSE2)
+    for (; e + 16 <= count; e += 16)
+    {
+        const __m128i lo = _mm_packs_epi32(saturate_lanes(src + e, scale_pattern + phase, offset_pattern + phase), saturate_lanes(src + e + 4, scale_pattern + phase + 4, offset_pattern + phase + 4));
+        const __m128i hi = _mm_packs_epi32(saturate_lanes(src + e + 8, scale_pattern + phase + 8, offset_pattern + phase + 8), saturate_lanes(src + e + 12, scale_pattern + phase + 12, offset_pattern + phase + 12));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + e), _mm_packus_epi16(lo, hi));
+        phase = phase + 16 == saturate_pattern_size ? 0 : phase + 16;
+    }
+#elif defined(TC_IMG_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+    for (; e + 16 <= count; e += 16)
+    {
+        const int16x8_t lo = vcombine_s16(vqmovn_s32(saturate_lanes(src + e, scale_pattern + phase, offset_pattern + phase)), vqmovn_s32(saturate_lanes(src + e + 4, scale_pattern + phase + 4, offset_pattern + phase + 4)));
+        const int16x8_t hi = vcombine_s16(vqmovn_s32(saturate_lanes(src + e + 8, scale_pattern + phase + 8, offset_pattern + phase + 8)), vqmovn_s32(saturate_lanes(src + e + 12, scale_pattern + phase + 12, offset_pattern + phase + 12)));
+        vst1q_u8(dst + e, vcombine_u8(vqmovun_s16(lo), vqmovun_s16(hi)));
+        phase = phase + 16 == saturate_pattern_size ? 0 : phase + 16;
+    }
+#endif
+
+    for (; e < count; ++e)
+    {
+        dst[e] = saturate_pixel(multiply_add(src[e], scale_pattern[phase], offset_pattern[phase]));
+        phase = phase + 1 == saturate_pattern_size ? 0 : phase + 1;
+    }
+}
+
+/*!
+ * \brief Destination channel and coefficients of each channel of a blob converted back to an image.
+ */
+struct image_channel_map
+{
+    std::vector<int> channel;
+    // Coefficients of each blob channel, repeated to fill a saturate_values pattern
+    std::vector<std::array<float, saturate_pattern_size>> scale;
+    std::vector<std::array<float, saturate_pattern_size>> offset;
+    bool swapRB_channels;
+
+    // Coefficients of 48 consecutive interleaved values, used by NHWC blobs when the channel count divides 48
+    std::array<float, saturate_pattern_size> scale_pattern;
+    std::array<float, saturate_pattern_size> offset_pattern;
+};
+
+image_channel_map make_image_channel_map(int channels, float scale_factor, const std::vector<float>& mean, const std::vector<float>& std_dev, bool swapRB_channels)
+{
+    if (scale_factor == 0.0f)
+    {
+        throw std::runtime_error("Invalid scale factor: the value must be non-zero");
+    }
+    if (swapRB_channels && channels < 3)
+    {
+        throw std::runtime_error("Invalid channels for swapRB_channels: " + std::to_string(channels) + ", at least 3 channels are required");
+    }
+
+    const std::size_t count = static_cast<std::size_t>(std::max(channels, 0));
+    image_channel_map map{std::vector<int>(count), std::vector<std::array<float, saturate_pattern_size>>(count), std::vector<std::array<float, saturate_pattern_size>>(count), swapRB_channels, {}, {}};
+    for (int c = 0; c < channels; ++c)
+    {
+        // Inverse of the create_blob normalization, with the same defaults for missing mean and std_dev components
+        const float m = c < static_cast<int>(mean.size()) ? mean[c] : 0.0f;
+        const float s = c < static_cast<int>(std_dev.size()) ? std_dev[c] : 1.0f;
+        if (s == 0.0f)
+        {
+            throw std::runtime_error("Invalid standard deviation for channel " + std::to_string(c) + ": the value must be non-zero");
+        }
+
+        map.channel[c] = (swapRB_channels && c < 3) ? (2 - c) : c;
+        map.scale[c].fill(s / scale_factor);
+        map.offset[c].fill(m / scale_factor);
+    }
+    if (channels > 0 && saturate_pattern_size % channels == 0)
+    {
+        for (std::size_t e = 0; e < saturate_pattern_size; ++e)
+        {
+            map.scale_pattern[e] = map.scale[e % channels][0];
+            map.offset_pattern[e] = map.offset[e % channels][0];
+        }
+    }
+    return map;
+}
+
+/*!
+ * \brief Number of pixels converted at once by blob_to_image_pixels, so that the scratch buffers stay in L1.
+ */
+constexpr std::size_t image_block_size = 256;
+
+/*!
+ * \brief Convert count <= image_block_size pixels of a planar float blob, plane c starting at blob + c * plane_stride, to an interleaved image.
+ * \param buffer Scratch space of channels * image_block_size bytes
+ */
+void planar_block_to_image(const float* blob, int channels, std::size_t plane_stride, std::uint8_t* image, const image_channel_map& map, std::size_t count, std::uint8_t* buffer)
+{
+    if (channels == 1)
+        return saturate_values(blob, image, count, map.scale[0].data(), map.offset[0].data());
+
+    // Rounding whole planes keeps the conversion vectorized, the planes are then interleaved from L1
+    for (int c = 0; c < channels; ++c)
+        saturate_values(blob + c * plane_stride, buffer + map.channel[c] * image_block_size, count, map.scale[c].data(), map.offset[c].data());
+
+    switch (channels)
+    {
+    case 3:
+        return detail::interleave_planes<3>(buffer, image_block_size, channels, image, count);
+    case 4:
+        return detail::interleave_planes<4>(buffer, image_block_size, channels, image, count);
+    default:
+        return detail::interleave_planes<0>(buffer, image_block_size, channels, image, count);
+    }
+}
+
+/*!
+ * \brief Convert count <= image_block_size pixels of an interleaved float blob to an interleaved image.
+ * \param buffer Scratch space of channels * image_block_size bytes
+ */
+void interleaved_block_to_image(const float* blob, int channels, std::uint8_t* image, const image_channel_map& map, std::size_t count, std::uint8_t* buffer)
+{
+    if (saturate_pattern_size % channels != 0)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            for (int c = 0; c < channels; ++c)
+                image[i * channels + map.channel[c]] = saturate_pixel(multiply_add(blob[i * channels + c], map.scale[c][0], map.offset[c][0]));
+        }
+        return;
+    }
+
+    if (!map.swapRB_channels)
+        return saturate_values(blob, image, count * channels, map.scale_pattern.data(), map.offset_pattern.data());
+
+    saturate_values(blob, buffer, count * channels, map.scale_pattern.data(), map.offset_pattern.data());
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        for (int c = 0; c < channels; ++c)
+            image[i * channels + map.channel[c]] = buffer[i * channels + c];
+    }
+}
+
+/*!
+ * \brief Convert pixels [begin, end) of one blob to its interleaved image.
+ *
+ * 16-bit floating point blobs are widened block by block into an L1-resident float buffer before being rounded.
+ */
+template <typename T>
+void blob_to_image_pixels(const T* blob, int channels, std::size_t pixel_count, std::uint8_t* image, const image_channel_map& map, blob_layout layout, std::size_t begin, std::size_t end)
+{
+    const bool interleaved = layout == blob_layout::nhwc;
+    std::vector<std::uint8_t> buffer(static_cast<std::size_t>(channels) * image_block_size);
+    std::vector<float> values(std::is_same_v<T, float> ? 0 : static_cast<std::size_t>(channels) * image_block_size);
+    for (std::size_t i = begin; i < end; i += image_block_size)
+    {
+        const std::size_t count = std::min(image_block_size, end - i);
+        const float* block = nullptr;
+        std::size_t plane_stride = image_block_size;
+        if constexpr (std::is_same_v<T, float>)
+        {
+            block = interleaved ? blob + i * channels : blob + i;
+            plane_stride = pixel_count;
+        }
+        else
+        {
+            if (interleaved)
+            {
+                detail::convert_float_values(blob + i * channels, values.data(), count * channels);
+            }
+            else
+            {
+                for (int c = 0; c < channels; ++c)
+                    detail::convert_float_values(blob + c * pixel_count + i, values.data() + c * image_block_size, count);
+            }
+            block = values.data();
+        }
+
+        if (interleaved)
+            interleaved_block_to_image(block, channels, image + i * channels, map, count, buffer.data());
+        else
+            planar_block_to_image(block, channels, plane_stride, image + i * channels, map, count, buffer.data());
+    }
+}
+
+/*!
+ * \brief Convert a blob holding images.size() images back to them, rows of all the images being split across the executor threads.
+ */
+template <typename T>
+void blob_to_images(
+    const T* blob,
+    std::size_t size,
+    int width,
+    int height,
+    int channels,
+    std::span<std::vector<std::uint8_t>> images,
+    float scale_factor,
+    const std::vector<float>& mean,
+    bool swapRB_channels,
+    const std::vector<float>& std_dev,
+    blob_layout layout,
+    executor& exec)
+{
+    const auto map = make_image_channel_map(channels, scale_factor, mean, std_dev, swapRB_channels);
+    const std::size_t pixel_count = static_cast<std::size_t>(std::max(width, 0)) * std::max(height, 0);
+    const std::size_t image_size = pixel_count * std::max(channels, 0);
+    if (size != images.size() * image_size)
+    {
+        throw std::runtime_error("Invalid blob size: got " + std::to_string(size) + " values for " + std::to_string(images.size()) + " images of " + std::to_string(width) + "x" + std::to_string(height) + "x" + std::to_string(channels) + ", expected " + std::to_string(images.size() * image_size));
+    }
+
+    for (auto& image : images)
+        image.resize(image_size);
+    if (image_size == 0)
+        return;
+
+    const int rows = static_cast<int>(images.size()) * height;
+    exec.parallel_for(rows, [&](int begin, int end) {
+        while (begin < end)
+        {
+            const int n = begin / height;
+            const int y_begin = begin % height;
+            const int y_end = std::min(height, y_begin + (end - begin));
+            blob_to_image_pixels(blob + n * image_size, channels, pixel_count, images[n].data(), map, layout, static_cast<std::size_t>(y_begin) * width, static_cast<std::size_t>(y_end) * width);
+            begin += y_end - y_begin;
+        }
+    }, blob_rows_per_chunk(width));
+}
+
+}
+
+namespace detail
+{
+void create_blob_kernel(
+    image_view image,
+    float* blob,
+    const float* scale,
+    const float* offset,
+    bool swapRB_channels,
+    blob_layout layout)
+{
+    convert_blob(image, blob, scale, offset, swapRB_channels, layout);
+}
+
+void create_blob_kernel(
+    image_view image,
+    float16* blob,
+    const float* scale,
+    const float* offset,
+    bool swapRB_channels,
+    blob_layout layout)
+{
+    convert_blob(image, blob, scale, offset, swapRB_channels, layout);
+}
+
+void create_blob_kernel(
+    image_view image,
+    bfloat16* blob,
+    const float* scale,
+    const float* offset,
+    bool swapRB_channels,
+    blob_layout layout)
+{
+    convert_blob(image, blob, scale, offset, swapRB_channels, layout);
+}
+
+void create_quantized_blob_kernel(
+    image_view image,
+    std::int8_t* blob,
+    const float* scale,
+    const float* offset,
+    const std::vector<float>& quant_scale,
+    const std::vector<int>& zero_point,
+    bool swapRB_channels,
+    blob_layout layout)
+{
+    quantize_blob(image, blob, scale, offset, quant_scale, zero_point, swapRB_channels, layout);
+}
+
+void create_quantized_blob_kernel(
+    image_view image,
+    std::uint8_t* blob,
+    const float* scale,
+    const float* offset,
+    const std::vector<float>& quant_scale,
+    const std::vector<int>& zero_point,
+    bool swapRB_channels,
+    blob_layout layout)
+{
+    quantize_blob(image, blob, scale, offset, quant_scale, zero_point, swapRB_channels, layout);
+}
+
+void blob_to_image_kernel(
+    const float* blob,
+    std::size_t size,
+    int width,
+    int height,
+    int channels,
+    std::span<std::vector<std::uint8_t>> images,
+    float scale_factor,
+    const std::vector<float>& mean,
+    bool swapRB_channels,
+    const std::vector<float>& std_dev,
+    blob_layout layout,
+    executor& exec)
+{
+    blob_to_images(blob, size, width, height, channels, images, scale_factor, mean, swapRB_channels, std_dev, layout, exec);
+}
+
+void blob_to_image_kernel(
+    const float16* blob,
+    std::size_t size,
+    int width,
+    int height,
+    int channels,
+    std::span<std::vector<std::uint8_t>> images,
+    float scale_factor,
+    const std::vector<float>& mean,
+    bool swapRB_channels,
+    const std::vector<float>& std_dev,
+    blob_layout layout,
+    executor& exec)
+{
+    blob_to_images(blob, size, width, height, channels, images, scale_factor, mean, swapRB_channels, std_dev, layout, exec);
+}
+
+void blob_to_image_kernel(
+    const bfloat16* blob,
+    std::size_t size,
+    int width,
+    int height,
+    int channels,
+    std::span<std::vector<std::uint8_t>> images,
+    float scale_factor,
+    const std::vector<float>& mean,
+    bool swapRB_channels,
+    const std::vector<float>& std_dev,
+    blob_layout layout,
+    executor& exec)
+{
+    blob_to_images(blob, size, width, height, channels, images, scale_factor, mean, swapRB_channels, std_dev, layout, exec);
+}
+}
+
+namespace
+{
+/*!
+ * \brief Implementation of create_blob_batch writing to a std::vector or a tensor.
+ */
+template <typename Blob>
+void create_blob_batch_into(
+    std::span<const std::tuple<std::vector<std::uint8_t>, int, int, int>> images,
+    Blob& batch,
+    float scale_factor,
+    const std::vector<float>& mean,
+    bool swapRB_channels,
+    const std::vector<float>& std_dev,
+    executor& exec)
+{
+    if (images.empty())
+    {
+        detail::allocate_blob(batch, {0, 0, 0, 0});
+        return;
+    }
+
+    // Validate every image once, so that workers never have to
+    const auto& [first_image, width, height, channels] = images.front();
+    for (std::size_t n = 0; n < images.size(); ++n)
+    {
+        const auto& [image, image_width, image_height, image_channels] = images[n];
+        if (image_width != width || image_height != height || image_channels != channels)
+        {
+            throw std::runtime_error("Invalid batch image size: image " + std::to_string(n) + " is " + std::to_string(image_width) + "x" + std::to_string(image_height) + "x" + std::to_string(image_channels) + ", expected " + std::to_string(width) + "x" + std::to_string(height) + "x" + std::to_string(channels));
+        }
+        if (image.size() != static_cast<std::size_t>(width) * height * channels)
+        {
+            throw std::runtime_error("Invalid batch image data: image " + std::to_string(n) + " has " + std::to_string(image.size()) + " bytes, expected " + std::to_string(static_cast<std::size_t>(width) * height * channels));
+        }
+    }
+
+    std::vector<float> scale;
+    std::vector<float> offset;
+    detail::blob_coefficients(channels, scale_factor, mean, std_dev, swapRB_channels, scale, offset);
+    const auto map = make_blob_channel_map(channels, scale.data(), offset.data(), swapRB_channels);
+
+    const std::size_t pixel_count = static_cast<std::size_t>(std::max(width, 0)) * std::max(height, 0);
+    const std::size_t image_size = pixel_count * channels;
+    float* data = detail::allocate_blob(batch, {images.size(), static_cast<std::size_t>(channels), static_cast<std::size_t>(std::max(height, 0)), static_cast<std::size_t>(std::max(width, 0))});
+    if (image_size == 0)
+        return;
+
+    // Work items are the rows of all the images, so that small batches of large images still use every thread
+    const int rows = static_cast<int>(images.size()) * height;
+    exec.parallel_for(rows, [&](int begin, int end) {
+        while (begin < end)
+        {
+            const int n = begin / height;
+            const int y_begin = begin % height;
+            const int y_end = std::min(height, y_begin + (end - begin));
+            convert_blob_pixels(std::get<0>(images[n]).data(), channels, pixel_count, pixel_count, data + n * image_size, map, static_cast<std::size_t>(y_begin) * width, static_cast<std::size_t>(y_end) * width);
+            begin += y_end - y_begin;
+        }
+    }, blob_rows_per_chunk(width));
+}
+
+/*!
+ * \brief Normalization tables of the letterbox blobs: every uint8 value of each output channel maps to one normalized float, padding included.
+ */
+struct letterbox_lut
+{
+    std::vector<int> src_channel;
+    std::vector<float> lut;
+    std::vector<float> pad;
+};
+
+letterbox_lut make_letterbox_lut(
+    int channels,
+    float scale_factor,
+    const std::vector<float>& mean,
+    bool swapRB_channels,
+    const std::vector<float>& std_dev,
+    const letterbox_pad& pad_value)
+{
+    if (pad_value.size() != 1 && pad_value.size() != static_cast<std::size_t>(channels))
+    {
+        throw std::runtime_error("Invalid pad value: expected 1 or " + std::to_string(channels) + " components, got " + std::to_string(pad_value.size()));
+    }
+
+    std::vector<float> scale;
+    std::vector<float> offset;
+    detail::blob_coefficients(channels, scale_factor, mean, std_dev, swapRB_channels, scale, offset);
+
+    letterbox_lut tables{std::vector<int>(channels), std::vector<float>(static_cast<std::size_t>(channels) * 256), std::vector<float>(channels)};
+    for (int c = 0; c < channels; ++c)
+    {
+        tables.src_channel[c] = (swapRB_channels && c < 3) ? (2 - c) : c;
+        for (int v = 0; v < 256; ++v)
+            tables.lut[c * 256 + v] = multiply_add(static_cast<float>(v), scale[c], offset[c]);
+        tables.pad[c] = tables.lut[c * 256 + pad_value[pad_value.size() == 1 ? 0 : tables.src_channel[c]]];
+    }
+    return tables;
+}
+
+/*!
+ * \brief Implementation of letterbox_blob writing to a std::vector or a tensor.
+ */
+template <typename Blob>
+void letterbox_blob_into(
+    const std::vector<std::uint8_t>& image,
+    int image_width,
+    int image_height,
+    int image_channels,
+    int target_width,
+    int target_height,
+    Blob& blob,
+    float scale_factor,
+    const std::vector<float>& mean,
+    bool swapRB_channels,
+    const std::vector<float>& std_dev,
+    const letterbox_pad& pad_value)
+{
+    const auto tables = make_letterbox_lut(image_channels, scale_factor, mean, swapRB_channels, std_dev, pad_value);
+    const auto& src_channel = tables.src_channel;
+    const auto& lut = tables.lut;
+    const auto& pad = tables.pad;
+    const auto plan = detail::get_resize_plan(detail::resize_plan_key{detail::resize_mode::letterbox, image_width, image_height, image_channels, target_width, target_height, 0});
+
+    const std::size_t plane_size = static_cast<std::size_t>(std::max(target_width, 0)) * std::max(target_height, 0);
+    float* data = detail::allocate_blob(blob, detail::blob_shape(target_width, target_height, image_channels, blob_layout::nchw));
+    const std::size_t src_stride = static_cast<std::size_t>(image_width) * image_channels;
+
+    detail::parallel_for(target_height, [&](int y_begin, int y_end) {
+        for (int y = y_begin; y < y_end; ++y)
+        {
+            const int content_y = y - plan->content_y;
+            const bool content_row = content_y >= 0 && content_y < plan->content_height && plan->content_width > 0;
+            for (int c = 0; c < image_channels; ++c)
+            {
+                float* out = data + c * plane_size + static_cast<std::size_t>(y) * target_width;
+                if (!content_row)
+                {
+                    std::fill(out, out + target_width, pad[c]);
+                    continue;
+                }
+
+                std::fill(out, out + plan->content_x, pad[c]);
+                std::fill(out + plan->content_x + plan->content_width, out + target_width, pad[c]);
+
+                const std::uint8_t* src_row = image.data() + plan->src_rows[content_y] * src_stride + src_channel[c];
+                const float* channel_lut = lut.data() + c * 256;
+                float* content = out + plan->content_x;
+                for (int x = 0; x < plan->content_width; ++x)
+                    content[x] = channel_lut[src_row[plan->src_x_offsets[x]]];
+            }
+        }
+    }, 16);
+}
+
+/*!
+ * \brief Implementation of nv12_letterbox_blob writing to a std::vector or a tensor.
+ */
+template <typename Blob>
+void nv12_letterbox_blob_into(
+    const std::vector<std::uint8_t>& nv12,
+    int image_width,
+    int image_height,
+    int target_width,
+    int target_height,
+    Blob& blob,
+    float scale_factor,
+    const std::vector<float>& mean,
+    bool swapRB_channels,
+    const std::vector<float>& std_dev,
+    const letterbox_pad& pad_value,
+    yuv_matrix matrix,
+    yuv_range range)
+{
+    if (nv12.size() != detail::yuv420_size(image_width, image_height))
+    {
+        throw std::runtime_error("Invalid NV12 data: expected " + std::to_string(detail::yuv420_size(image_width, image_height)) + " bytes for a " + std::to_string(image_width) + "x" + std::to_string(image_height) + " image, got " + std::to_string(nv12.size()));
+    }
+
+    const auto tables = make_letterbox_lut(3, scale_factor, mean, swapRB_channels, std_dev, pad_value);
+    const auto& src_channel = tables.src_channel;
+    const auto& lut = tables.lut;
+    const auto& pad = tables.pad;
+    const auto coefficients = detail::make_yuv_coefficients(matrix, range);
+
+    // A single channel plan samples the luma plane, whose offsets are then the source columns
+    const auto plan = detail::get_resize_plan(detail::resize_plan_key{detail::resize_mode::letterbox, image_width, image_height, 1, target_width, target_height, 0});
+
+    const std::size_t plane_size = static_cast<std::size_t>(std::max(target_width, 0)) * std::max(target_height, 0);
+    float* data = detail::allocate_blob(blob, detail::blob_shape(target_width, target_height, 3, blob_layout::nchw));
+    const std::size_t luma_stride = static_cast<std::size_t>(image_width);
+    const std::size_t chroma_stride = (luma_stride + 1) / 2 * 2;
+    const std::uint8_t* luma = nv12.data();
+    const std::uint8_t* chroma = luma + luma_stride * image_height;
+
+    detail::parallel_for(target_height, [&](int y_begin, int y_end) {
+        // Sampled Y, U and V values of one row, then its R, G and B values
+        const std::size_t content_width = static_cast<std::size_t>(plan->content_width);
+        std::vector<std::uint8_t> buffer(6 * content_width);
+        std::uint8_t* y_samples = buffer.data();
+        std::uint8_t* u_samples = y_samples + content_width;
+        std::uint8_t* v_samples = u_samples + content_width;
+        std::uint8_t* rgb = v_samples + content_width;
+
+        for (int y = y_begin; y < y_end; ++y)
+        {
+            const int content_y = y - plan->content_y;
+            const bool content_row = content_y >= 0 && content_y < plan->content_height && plan->content_width > 0;
+            if (content_row)
+            {
+                const int src_y = plan->src_rows[content_y];
+                const std::uint8_t* luma_row = luma + src_y * luma_stride;
+                const std::uint8_t* chroma_row = chroma + (src_y / 2) * chroma_stride;
+                for (std::size_t x = 0; x < content_width; ++x)
+                {
+                    const std::size_t src_x = static_cast<std::size_t>(plan->src_x_offsets[x]);
+                    y_samples[x] = luma_row[src_x];
+                    u_samples[x] = chroma_row[src_x & ~std::size_t{1}];
+                    v_samples[x] = chroma_row[src_x | 1];
+                }
+                detail::convert_yuv_row(y_samples, u_samples, v_samples, content_width, coefficients, rgb, rgb + content_width, rgb + 2 * content_width);
+            }
+
+            for (int c = 0; c < 3; ++c)
+            {
+                float* out = data + c * plane_size + static_cast<std::size_t>(y) * target_width;
+                if (!content_row)
+                {
+                    std::fill(out, out + target_width, pad[c]);
+                    continue;
+                }
+
+                std::fill(out, out + plan->content_x, pad[c]);
+                std::fill(out + plan->content_x + plan->content_width, out + target_width, pad[c]);
+
+                const std::uint8_t* src = rgb + src_channel[c] * content_width;
+                const float* channel_lut = lut.data() + c * 256;
+                float* content = out + plan->content_x;
+                for (std::size_t x = 0; x < content_width; ++x)
+                    content[x] = channel_lut[src[x]];
+            }
+        }
+    }, 16);
+}
+
+/*!
+ * \brief Implementation of crop_resize_batch writing to a std::vector or a tensor.
+ */
+template <typename Blob>
+void crop_resize_batch_into(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    const std::vector<std::array<int, 4>>& boxes,
+    int target_width,
+    int target_height,
+    Blob& batch,
+    float scale_factor,
+    const std::vector<float>& mean,
+    bool swapRB_channels,
+    const std::vector<float>& std_dev,
+    executor& exec)
+{
+    if (target_width < 0 || target_height < 0)
+    {
+        throw std::runtime_error("Invalid target size: " + std::to_string(target_width) + "x" + std::to_string(target_height));
+    }
+
+    for (const auto& box : boxes)
+    {
+        if (box[2] <= 0 || box[3] <= 0)
+        {
+            throw std::runtime_error("Invalid crop box size: " + std::to_string(box[2]) + "x" + std::to_string(box[3]));
+        }
+    }
+
+    // Output channel c reads input channel src_channel[c] and is normalized with scale[c] and offset[c], as create_blob does
+    std::vector<float> scale;
+    std::vector<float> offset;
+    detail::blob_coefficients(channels, scale_factor, mean, std_dev, swapRB_channels, scale, offset);
+    std::vector<int> src_channel(channels);
+    for (int c = 0; c < channels; ++c)
+        src_channel[c] = (swapRB_channels && c < 3) ? (2 - c) : c;
+
+    const std::size_t plane_size = static_cast<std::size_t>(target_width) * target_height;
+    const std::size_t crop_size = plane_size * channels;
+    float* data = detail::allocate_blob(batch, {boxes.size(), static_cast<std::size_t>(channels), static_cast<std::size_t>(target_height), static_cast<std::size_t>(target_width)});
+
+    const std::size_t stride = static_cast<std::size_t>(width) * channels;
+    exec.parallel_for(static_cast<int>(boxes.size()), [&](int begin, int end) {
+        std::vector<crop_sample> xs;
+        std::vector<crop_sample> ys;
+        for (int n = begin; n < end; ++n)
+        {
+            const auto& box = boxes[n];
+            make_crop_samples(box[0], box[2], width, target_width, xs);
+            make_crop_samples(box[1], box[3], height, target_height, ys);
+
+            float* crop = data + n * crop_size;
+            for (int y = 0; y < target_height; ++y)
+            {
+                const std::uint8_t* row0 = image.data() + ys[y].index0 * stride;
+                const std::uint8_t* row1 = image.data() + ys[y].index1 * stride;
+                const float wy = ys[y].weight1;
+                for (int c = 0; c < channels; ++c)
+                {
+                    const int sc = src_channel[c];
+                    float* out = crop + c * plane_size + static_cast<std::size_t>(y) * target_width;
+                    for (int x = 0; x < target_width; ++x)
+                    {
+                        const int x0 = xs[x].index0 * channels + sc;
+                        const int x1 = xs[x].index1 * channels + sc;
+                        const float wx = xs[x].weight1;
+                        const float top = row0[x0] + (row0[x1] - row0[x0]) * wx;
+                        const float bottom = row1[x0] + (row1[x1] - row1[x0]) * wx;
+                        out[x] = (top + (bottom - top) * wy) * scale[c] + offset[c];
+                    }
+                }
+            }
+        }
+    }, 1);
+}
+}
+
+void create_blob_batch(
+    std::span<const std::tuple<std::vector<std::uint8_t>, int, int, int>> images,
+    std::vector<float>& batch,
+    float scale_factor,
+    const std::vector<float>& mean,
+    bool swapRB_channels,
+    const std::vector<float>& std_dev,
+    executor& exec)
+{
+    create_blob_batch_into(images, batch, scale_factor, mean, swapRB_channels, std_dev, exec);
+}
+
+tensor<float> create_blob_batch(
+    std::span<const std::tuple<std::vector<std::uint8_t>, int, int, int>> images,
+    float scale_factor,
+    const std::vector<float>& mean,
+    bool swapRB_channels,
+    const std::vector<float>& std_dev,
+    executor& exec)
+{
+    tensor<float> batch;
+    create_blob_batch_into(images, batch, scale_factor, mean, swapRB_channels, std_dev, exec);
+    return batch;
+}
+
+void letterbox_blob(
+    const std::vector<std::uint8_t>& image,
+    int image_width,
+    int image_height,
+    int image_channels,
+    int target_width,
+    int target_height,
+    std::vector<float>& blob,
+    float scale_factor,
+    const std::vector<float>& mean,
+    bool swapRB_channels,
+    const std::vector<float>& std_dev,
+    const letterbox_pad& pad_value)
+{
+    letterbox_blob_into(image, image_width, image_height, image_channels, target_width, target_height, blob, scale_factor, mean, swapRB_channels, std_dev, pad_value);
+}
+
+tensor<float> letterbox_blob(
+    const std::vector<std::uint8_t>& image,
+    int image_width,
+    int image_height,
+    int image_channels,
+    int target_width,
+    int target_height,
+    float scale_factor,
+    const std::vector<float>& mean,
+    bool swapRB_channels,
+    const std::vector<float>& std_dev,
+    const letterbox_pad& pad_value)
+{
+    tensor<float> blob;
+    letterbox_blob_into(image, image_width, image_height, image_channels, target_width, target_height, blob, scale_factor, mean, swapRB_channels, std_dev, pad_value);
+    return blob;
+}
+
+void nv12_letterbox_blob(
+    const std::vector<std::uint8_t>& nv12,
+    int image_width,
+    int image_height,
+    int target_width,
+    int target_height,
+    std::vector<float>& blob,
+    float scale_factor,
+    const std::vector<float>& mean,
+    bool swapRB_channels,
+    const std::vector<float>& std_dev,
+    const letterbox_pad& pad_value,
+    yuv_matrix matrix,
+    yuv_range range)
+{
+    nv12_letterbox_blob_into(nv12, image_width, image_height, target_width, target_height, blob, scale_factor, mean, swapRB_channels, std_dev, pad_value, matrix, range);
+}
+
+tensor<float> nv12_letterbox_blob(
+    const std::vector<std::uint8_t>& nv12,
+    int image_width,
+    int image_height,
+    int target_width,
+    int target_height,
+    float scale_factor,
+    const std::vector<float>& mean,
+    bool swapRB_channels,
+    const std::vector<float>& std_dev,
+    const letterbox_pad& pad_value,
+    yuv_matrix matrix,
+    yuv_range range)
+{
+    tensor<float> blob;
+    nv12_letterbox_blob_into(nv12, image_width, image_height, target_width, target_height, blob, scale_factor, mean, swapRB_channels, std_dev, pad_value, matrix, range);
+    return blob;
+}
+
+void crop_resize_batch(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    const std::vector<std::array<int, 4>>& boxes,
+    int target_width,
+    int target_height,
+    std::vector<float>& batch,
+    float scale_factor,
+    const std::vector<float>& mean,
+    bool swapRB_channels,
+    const std::vector<float>& std_dev,
+    executor& exec)
+{
+    crop_resize_batch_into(image, width, height, channels, boxes, target_width, target_height, batch, scale_factor, mean, swapRB_channels, std_dev, exec);
+}
+
+tensor<float> crop_resize_batch(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    const std::vector<std::array<int, 4>>& boxes,
+    int target_width,
+    int target_height,
+    float scale_factor,
+    const std::vector<float>& mean,
+    bool swapRB_channels,
+    const std::vector<float>& std_dev,
+    executor& exec)
+{
+    tensor<float> batch;
+    crop_resize_batch_into(image, width, height, channels, boxes, target_width, target_height, batch, scale_factor, mean, swapRB_channels, std_dev, exec);
+    return batch;
+}
+
+}
@@ -0,0 +1,320 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <teiacare/image/image_pyramid.hpp>
+
+#include "simd.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace tc::img
+{
+namespace
+{
+constexpr int interpolation_bits = 11;
+constexpr int interpolation_one = 1 << interpolation_bits;
+
+/*!
+ * \brief Source indices and fixed-point weight of the second one, for one output coordinate.
+ */
+struct axis_sample
+{
+    int index0;
+    int index1;
+    int weight1;
+};
+
+std::vector<axis_sample> make_axis_samples(int src_size, int dst_size)
+{
+    std::vector<axis_sample> samples(dst_size);
+    const double scale = static_cast<double>(src_size) / dst_size;
+    for (int i = 0; i < dst_size; ++i)
+    {
+        // Align pixel centers, clamping to the valid source range
+        const double s = std::clamp((i + 0.5) * scale - 0.5, 0.0, static_cast<double>(src_size - 1));
+        const int index0 = static_cast<int>(s);
+        const int index1 = std::min(index0 + 1, src_size - 1);
+        const int weight1 = static_cast<int>(std::lround((s - index0) * interpolation_one));
+        samples[i] = axis_sample{index0, index1, weight1};
+    }
+    return samples;
+}
+
+/*!
+ * \brief Downscale one row pair by exactly 2:1 in both directions, averaging each 2x2 block with rounding.
+ */
+void downscale_half_row(const std::uint8_t* row0, const std::uint8_t* row1, std::uint8_t* dst, int dst_width, int channels)
+{
+    int x = 0;
+
+#if defined(TC_IMG_SSE2)
+    const __m128i two = _mm_set1_epi16(2);
+    if (channels == 1)
+    {
+        // Even and odd bytes of each 16-bit lane are the two horizontal neighbours
+        const __m128i low_mask = _mm_set1_epi16(0x00FF);
+        const auto pair_sum = [&](const std::uint8_t* p) {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            return _mm_add_epi16(_mm_and_si128(v, low_mask), _mm_srli_epi16(v, 8));
+        };
+        for (; x + 16 <= dst_width; x += 16)
+        {
+            const std::uint8_t* p0 = row0 + 2 * x;
+            const std::uint8_t* p1 = row1 + 2 * x;
+            const __m128i lo = _mm_add_epi16(pair_sum(p0), pair_sum(p1));
+            const __m128i hi = _mm_add_epi16(pair_sum(p0 + 16), pair_sum(p1 + 16));
+            const __m128i avg = _mm_packus_epi16(_mm_srli_epi16(_mm_add_epi16(lo, two), 2), _mm_srli_epi16(_mm_add_epi16(hi, two), 2));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x), avg);
+        }
+    }
+    else if (channels == 4)
+    {
+        // Each 64-bit half of a widened register holds one pixel, adding the halves sums two neighbours
+        const __m128i zero = _mm_setzero_si128();
+        const auto pair_sum = [&](const std::uint8_t* p) {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            const __m128i lo = _mm_unpacklo_epi8(v, zero);
+            const __m128i hi = _mm_unpackhi_epi8(v, zero);
+            return _mm_unpacklo_epi64(_mm_add_epi16(lo, _mm_srli_si128(lo, 8)), _mm_add_epi16(hi, _mm_srli_si128(hi, 8)));
+        };
+        for (; x + 4 <= dst_width; x += 4)
+        {
+            const std::uint8_t* p0 = row0 + 8 * x;
+            const std::uint8_t* p1 = row1 + 8 * x;
+            const __m128i lo = _mm_add_epi16(pair_sum(p0), pair_sum(p1));
+            const __m128i hi = _mm_add_epi16(pair_sum(p0 + 16), pair_sum(p1 + 16));
+            const __m128i avg = _mm_packus_epi16(_mm_srli_epi16(_mm_add_epi16(lo, two), 2), _mm_srli_epi16(_mm_add_epi16(hi, two), 2));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 4 * x), avg);
+        }
+    }
+#if defined(TC_IMG_SSSE3)
+    else if (channels == 3)
+    {
+        // Each 12 byte group holds two horizontal pairs: the shuffles widen the first and the second pixel of both pairs to 16-bit lanes
+        const __m128i first = _mm_setr_epi8(0, -1, 1, -1, 2, -1, 6, -1, 7, -1, 8, -1, -1, -1, -1, -1);
+        const __m128i second = _mm_setr_epi8(3, -1, 4, -1, 5, -1, 9, -1, 10, -1, 11, -1, -1, -1, -1, -1);
+        const __m128i compact = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 8, 9, 10, 11, 12, 13, -1, -1, -1, -1);
+        const auto pair_sum = [&](const std::uint8_t* p) {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            return _mm_add_epi16(_mm_shuffle_epi8(v, first), _mm_shuffle_epi8(v, second));
+        };
+        // 16 byte stores carry 12 useful bytes, the bound keeps the 4 extra ones inside the row (the next iteration rewrites them)
+        for (; x + 6 <= dst_width; x += 4)
+        {
+            const std::uint8_t* p0 = row0 + 6 * x;
+            const std::uint8_t* p1 = row1 + 6 * x;
+            const __m128i lo = _mm_add_epi16(pair_sum(p0), pair_sum(p1));
+            const __m128i hi = _mm_add_epi16(pair_sum(p0 + 12), pair_sum(p1 + 12));
+            const __m128i avg = _mm_packus_epi16(_mm_srli_epi16(_mm_add_epi16(lo, two), 2), _mm_srli_epi16(_mm_add_epi16(hi, two), 2));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 3 * x), _mm_shuffle_epi8(avg, compact));
+        }
+    }
+#endif
+#elif defined(TC_IMG_NEON)
+    // Structured loads deinterleave the channels, pairwise widening adds sum the horizontal neighbours
+    if (channels == 1)
+    {
+        for (; x + 8 <= dst_width; x += 8)
+        {
+            const uint16x8_t sum = vpadalq_u8(vpaddlq_u8(vld1q_u8(row0 + 2 * x)), vld1q_u8(row1 + 2 * x));
+            vst1_u8(dst + x, vrshrn_n_u16(sum, 2));
+        }
+    }
+    else if (channels == 3)
+    {
+        for (; x + 8 <= dst_width; x += 8)
+        {
+            const uint8x16x3_t a = vld3q_u8(row0 + 6 * x);
+            const uint8x16x3_t b = vld3q_u8(row1 + 6 * x);
+            uint8x8x3_t avg;
+            for (int c = 0; c < 3; ++c)
+                avg.val[c] = vrshrn_n_u16(vpadalq_u8(vpaddlq_u8(a.val[c]), b.val[c]), 2);
+            vst3_u8(dst + 3 * x, avg);
+        }
+    }
+    else if (channels == 4)
+    {
+        for (; x + 8 <= dst_width; x += 8)
+        {
+            const uint8x16x4_t a = vld4q_u8(row0 + 8 * x);
+            const uint8x16x4_t b = vld4q_u8(row1 + 8 * x);
+            uint8x8x4_t avg;
+            for (int c = 0; c < 4; ++c)
+                avg.val[c] = vrshrn_n_u16(vpadalq_u8(vpaddlq_u8(a.val[c]), b.val[c]), 2);
+            vst4_u8(dst + 4 * x, avg);
+        }
+    }
+#endif
+
+    for (; x < dst_width; ++x)
+    {
+        const std::uint8_t* p0 = row0 + 2 * x * channels;
+        const std::uint8_t* p1 = row1 + 2 * x * channels;
+        for (int c = 0; c < channels; ++c)
+        {
+            const int sum = p0[c] + p0[c + channels] + p1[c] + p1[c + channels];
+            dst[x * channels + c] = static_cast<std::uint8_t>((sum + 2) >> 2);
+        }
+    }
+}
+
+void downscale_half(const std::uint8_t* src, int src_width, int channels, std::uint8_t* dst, int dst_width, int dst_height)
+{
+    const std::size_t src_stride = static_cast<std::size_t>(src_width) * channels;
+    const std::size_t dst_stride = static_cast<std::size_t>(dst_width) * channels;
+    for (int y = 0; y < dst_height; ++y)
+    {
+        const std::uint8_t* row0 = src + 2 * y * src_stride;
+        downscale_half_row(row0, row0 + src_stride, dst + y * dst_stride, dst_width, channels);
+    }
+}
+
+void downscale_bilinear(const std::uint8_t* src, int src_width, int src_height, int channels, std::uint8_t* dst, int dst_width, int dst_height)
+{
+    const auto xs = make_axis_samples(src_width, dst_width);
+    const auto ys = make_axis_samples(src_height, dst_height);
+    const std::size_t src_stride = static_cast<std::size_t>(src_width) * channels;
+    const std::size_t dst_stride = static_cast<std::size_t>(dst_width) * channels;
+
+    // Horizontally interpolated source rows, reused while consecutive output rows sample the same source rows
+    std::vector<int> rows[2] = {std::vector<int>(dst_stride), std::vector<int>(dst_stride)};
+    int cached_rows[2] = {-1, -1};
+    const auto interpolate_row = [&](int src_y, std::vector<int>& out) {
+        const std::uint8_t* src_row = src + src_y * src_stride;
+        for (int x = 0; x < dst_width; ++x)
+        {
+            const std::uint8_t* a = src_row + xs[x].index0 * channels;
+            const std::uint8_t* b = src_row + xs[x].index1 * channels;
+            const int w1 = xs[x].weight1;
+            for (int c = 0; c < channels; ++c)
+                out[x * channels + c] = a[c] * (interpolation_one - w1) + b[c] * w1;
+        }
+    };
+
+    constexpr int shift = 2 * interpolation_bits;
+    constexpr int rounding = 1 << (shift - 1);
+    for (int y = 0; y < dst_height; ++y)
+    {
+        for (int i = 0; i < 2; ++i)
+        {
+            const int src_y = (i == 0) ? ys[y].index0 : ys[y].index1;
+            if (cached_rows[i] == src_y)
+                continue;
+
+            if (cached_rows[1 - i] == src_y)
+                std::copy(rows[1 - i].begin(), rows[1 - i].end(), rows[i].begin());
+            else
+                interpolate_row(src_y, rows[i]);
+            cached_rows[i] = src_y;
+        }
+
+        const int w1 = ys[y].weight1;
+        const int w0 = interpolation_one - w1;
+        std::uint8_t* dst_row = dst + y * dst_stride;
+        for (std::size_t i = 0; i < dst_stride; ++i)
+            dst_row[i] = static_cast<std::uint8_t>((rows[0][i] * w0 + rows[1][i] * w1 + rounding) >> shift);
+    }
+}
+
+}
+
+const std::uint8_t* image_pyramid::level_data(std::size_t level) const
+{
+    return data.data() + levels.at(level).offset;
+}
+
+std::uint8_t* image_pyramid::level_data(std::size_t level)
+{
+    return data.data() + levels.at(level).offset;
+}
+
+std::size_t image_pyramid::level_size(std::size_t level) const
+{
+    const auto& l = levels.at(level);
+    return static_cast<std::size_t>(l.width) * l.height * channels;
+}
+
+void build_image_pyramid(
+    const std::vector<std::uint8_t>& image,
+    int image_width,
+    int image_height,
+    int image_channels,
+    int levels,
+    double scale_factor,
+    image_pyramid& pyramid)
+{
+    if (levels < 1)
+    {
+        throw std::runtime_error("Invalid pyramid levels: " + std::to_string(levels) + ", at least 1 level is required");
+    }
+
+    if (!(scale_factor > 0.0 && scale_factor < 1.0))
+    {
+        throw std::runtime_error("Invalid pyramid scale factor: " + std::to_string(scale_factor) + ", expected a value in range (0, 1)");
+    }
+
+    if (image_width <= 0 || image_height <= 0 || image_channels <= 0)
+    {
+        throw std::runtime_error("Invalid image size: " + std::to_string(image_width) + "x" + std::to_string(image_height) + "x" + std::to_string(image_channels));
+    }
+
+    if (image.size() != static_cast<std::size_t>(image_width) * image_height * image_channels)
+    {
+        throw std::runtime_error("Invalid image data: expected " + std::to_string(image_width) + "x" + std::to_string(image_height) + "x" + std::to_string(image_channels) + " bytes, got " + std::to_string(image.size()));
+    }
+
+    // Compute the layout of every level first, so that all of them fit in one allocation
+    pyramid.channels = image_channels;
+    pyramid.levels.clear();
+    std::size_t total_size = 0;
+    int width = image_width;
+    int height = image_height;
+    for (int i = 0; i < levels && width > 0 && height > 0; ++i)
+    {
+        pyramid.levels.push_back(image_pyramid_level{total_size, width, height});
+        total_size += static_cast<std::size_t>(width) * height * image_channels;
+        width = static_cast<int>(width * scale_factor);
+        height = static_cast<int>(height * scale_factor);
+    }
+    pyramid.data.resize(total_size);
+
+    std::memcpy(pyramid.level_data(0), image.data(), pyramid.level_size(0));
+    for (std::size_t i = 1; i < pyramid.levels.size(); ++i)
+    {
+        const auto& src = pyramid.levels[i - 1];
+        const auto& dst = pyramid.levels[i];
+        if (src.width == 2 * dst.width && src.height == 2 * dst.height)
+            downscale_half(pyramid.level_data(i - 1), src.width, image_channels, pyramid.level_data(i), dst.width, dst.height);
+        else
+            downscale_bilinear(pyramid.level_data(i - 1), src.width, src.height, image_channels, pyramid.level_data(i), dst.width, dst.height);
+    }
+}
+
+image_pyramid build_image_pyramid(
+    const std::vector<std::uint8_t>& image,
+    int image_width,
+    int image_height,
+    int image_channels,
+    int levels,
+    double scale_factor)
+{
+    image_pyramid pyramid;
+    build_image_pyramid(image, image_width, image_height, image_channels, levels, scale_factor, pyramid);
+    return pyramid;
+}
+
+}
@@ -14,11 +14,208 @@
 
 #include <teiacare/image/image_resize.hpp>
 
+#include "parallel.hpp"
+#include "resize_plan.hpp"
 #include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
 
 namespace tc::img
 {
+namespace
+{
+/*!
+ * \brief Build one full output row made only of pad pixels, used as the source for every band write.
+ */
+std::vector<std::uint8_t> make_pad_row(int target_width, int image_channels, const letterbox_pad& pad_value)
+{
+    if (pad_value.size() != 1 && pad_value.size() != static_cast<std::size_t>(image_channels))
+    {
+        throw std::runtime_error("Invalid pad value: expected 1 or " + std::to_string(image_channels) + " components, got " + std::to_string(pad_value.size()));
+    }
+
+    std::vector<std::uint8_t> pad_row(static_cast<std::size_t>(std::max(target_width, 0)) * image_channels);
+    if (pad_value.size() == 1)
+    {
+        std::fill(pad_row.begin(), pad_row.end(), pad_value[0]);
+        return pad_row;
+    }
+
+    for (std::size_t i = 0; i < pad_row.size(); i += image_channels)
+        std::copy(pad_value.begin(), pad_value.end(), pad_row.begin() + i);
+
+    return pad_row;
+}
+
+/*!
+ * \brief Reject a source image without pixels, which stretch and center-crop resizing cannot sample from.
+ */
+void check_source_size(int image_width, int image_height)
+{
+    if (image_width <= 0 || image_height <= 0)
+    {
+        throw std::runtime_error("Invalid image size: " + std::to_string(image_width) + "x" + std::to_string(image_height));
+    }
+}
+
+/*!
+ * \brief Copy the source pixel sampled by each of the count output pixels, with a fixed size copy per pixel unless Channels is dynamic_channels.
+ */
+template <int Channels>
+void sample_row(const std::uint8_t* src_row, const int* src_x_offsets, int count, int channels, std::uint8_t* out)
+{
+    if constexpr (Channels == dynamic_channels)
+    {
+        for (int x = 0; x < count; ++x, out += channels)
+            std::memcpy(out, src_row + src_x_offsets[x], channels);
+    }
+    else
+    {
+        for (int x = 0; x < count; ++x, out += Channels)
+            std::memcpy(out, src_row + src_x_offsets[x], Channels);
+    }
+}
+
+/*!
+ * \brief Write output row y: pad rows are copied from pad_row, content rows get left/right bands plus sampled pixels.
+ * \param image_stride Distance in bytes between consecutive rows of the source image
+ */
+void write_resize_row(
+    const std::uint8_t* image,
+    std::size_t image_stride,
+    int image_channels,
+    int target_width,
+    const detail::resize_plan& plan,
+    const std::vector<std::uint8_t>& pad_row,
+    int y,
+    std::uint8_t* dst)
+{
+    const std::size_t row_bytes = static_cast<std::size_t>(target_width) * image_channels;
+    const int content_y = y - plan.content_y;
+    if (content_y < 0 || content_y >= plan.content_height || plan.content_width <= 0)
+    {
+        std::memcpy(dst, pad_row.data(), row_bytes);
+        return;
+    }
+
+    const std::size_t left_bytes = static_cast<std::size_t>(plan.content_x) * image_channels;
+    const std::size_t content_bytes = static_cast<std::size_t>(plan.content_width) * image_channels;
+    std::memcpy(dst, pad_row.data(), left_bytes);
+    std::memcpy(dst + left_bytes + content_bytes, pad_row.data(), row_bytes - left_bytes - content_bytes);
+
+    const std::uint8_t* src_row = image + static_cast<std::size_t>(plan.src_rows[content_y]) * image_stride;
+    visit_channels(image_channels, [&](auto channels) {
+        sample_row<decltype(channels)::value>(src_row, plan.src_x_offsets.data(), plan.content_width, image_channels, dst + left_bytes);
+    });
+}
+
+void resize_into(
+    const std::vector<std::uint8_t>& image,
+    const detail::resize_plan_key& key,
+    std::vector<std::uint8_t>& resized_image,
+    const letterbox_pad& pad_value)
+{
+    const auto pad_row = make_pad_row(key.target_width, key.image_channels, pad_value);
+    const auto plan = detail::get_resize_plan(key);
+
+    // Every output byte is written exactly once, so reused buffers never keep stale padding
+    const std::size_t row_bytes = pad_row.size();
+    const std::size_t image_stride = static_cast<std::size_t>(key.image_width) * key.image_channels;
+    resized_image.resize(row_bytes * std::max(key.target_height, 0));
+    for (int y = 0; y < key.target_height; ++y)
+        write_resize_row(image.data(), image_stride, key.image_channels, key.target_width, *plan, pad_row, y, resized_image.data() + y * row_bytes);
+}
+
+/*!
+ * \brief Resize a possibly strided view into a possibly strided span, the target size being the size of the span.
+ */
+void resize_into(image_view image, detail::resize_mode mode, image_span resized_image, const letterbox_pad& pad_value)
+{
+    if (resized_image.channels() != image.channels())
+    {
+        throw std::runtime_error("Invalid resized image channels: " + std::to_string(resized_image.channels()) + ", expected " + std::to_string(image.channels()));
+    }
+
+    const detail::resize_plan_key key{mode, image.width(), image.height(), image.channels(), resized_image.width(), resized_image.height(), 0};
+    const auto pad_row = make_pad_row(key.target_width, key.image_channels, pad_value);
+    const auto plan = detail::get_resize_plan(key);
+    for (int y = 0; y < key.target_height; ++y)
+        write_resize_row(image.data(), image.stride(), key.image_channels, key.target_width, *plan, pad_row, y, resized_image.row(y));
+}
+
+std::vector<std::uint8_t> resize_to_new(
+    const std::vector<std::uint8_t>& image,
+    const detail::resize_plan_key& key,
+    const letterbox_pad& pad_value)
+{
+    const auto pad_row = make_pad_row(key.target_width, key.image_channels, pad_value);
+    const auto plan = detail::get_resize_plan(key);
+
+    // Rows are assembled in a small scratch buffer and appended, avoiding a zero-fill pass over the whole output
+    const std::size_t image_stride = static_cast<std::size_t>(key.image_width) * key.image_channels;
+    std::vector<std::uint8_t> row(pad_row.size());
+    std::vector<std::uint8_t> resized_image;
+    resized_image.reserve(pad_row.size() * std::max(key.target_height, 0));
+    for (int y = 0; y < key.target_height; ++y)
+    {
+        write_resize_row(image.data(), image_stride, key.image_channels, key.target_width, *plan, pad_row, y, row.data());
+        resized_image.insert(resized_image.end(), row.begin(), row.end());
+    }
+    return resized_image;
+}
+
+}
+
 void image_resize_aspect_ratio(
+    const std::vector<std::uint8_t>& image,
+    int image_width,
+    int image_height,
+    int image_channels,
+    int target_width,
+    int target_height,
+    std::vector<std::uint8_t>& resized_image,
+    const letterbox_pad& pad_value)
+{
+    const detail::resize_plan_key key{detail::resize_mode::letterbox, image_width, image_height, image_channels, target_width, target_height, 0};
+    resize_into(image, key, resized_image, pad_value);
+}
+
+std::vector<std::uint8_t> image_resize_aspect_ratio(
+    const std::vector<std::uint8_t>& image,
+    int image_width,
+    int image_height,
+    int image_channels,
+    int target_width,
+    int target_height,
+    const letterbox_pad& pad_value)
+{
+    const detail::resize_plan_key key{detail::resize_mode::letterbox, image_width, image_height, image_channels, target_width, target_height, 0};
+    return resize_to_new(image, key, pad_value);
+}
+
+void image_resize_aspect_ratio(
+    image_view image,
+    image_span resized_image,
+    const letterbox_pad& pad_value)
+{
+    resize_into(image, detail::resize_mode::letterbox, resized_image, pad_value);
+}
+
+image image_resize_aspect_ratio(
+    image_view image,
+    int target_width,
+    int target_height,
+    const letterbox_pad& pad_value)
+{
+    tc::img::image resized_image(target_width, target_height, image.channels());
+    resize_into(image, detail::resize_mode::letterbox, resized_image, pad_value);
+    return resized_image;
+}
+
+void image_resize_stretch(
     const std::vector<std::uint8_t>& image,
     int image_width,
     int image_height,
@@ -27,60 +224,120 @@ void image_resize_aspect_ratio(
     int target_height,
     std::vector<std::uint8_t>& resized_image)
 {
-    // Calculate the aspect ratios
-    double aspect_ratio_image = static_cast<double>(image_width) / image_height;
-    double aspect_ratio_target = static_cast<double>(target_width) / target_height;
+    check_source_size(image_width, image_height);
+
+    const detail::resize_plan_key key{detail::resize_mode::stretch, image_width, image_height, image_channels, target_width, target_height, 0};
+    resize_into(image, key, resized_image, {0});
+}
+
+std::vector<std::uint8_t> image_resize_stretch(
+    const std::vector<std::uint8_t>& image,
+    int image_width,
+    int image_height,
+    int image_channels,
+    int target_width,
+    int target_height)
+{
+    check_source_size(image_width, image_height);
 
-    // Determine the scaling factors and new dimensions
-    int new_width;
-    int new_height;
-    if (aspect_ratio_image > aspect_ratio_target)
+    const detail::resize_plan_key key{detail::resize_mode::stretch, image_width, image_height, image_channels, target_width, target_height, 0};
+    return resize_to_new(image, key, {0});
+}
+
+void image_resize_center_crop(
+    const std::vector<std::uint8_t>& image,
+    int image_width,
+    int image_height,
+    int image_channels,
+    int resize_size,
+    int crop_width,
+    int crop_height,
+    std::vector<std::uint8_t>& resized_image,
+    const letterbox_pad& pad_value)
+{
+    check_source_size(image_width, image_height);
+    if (resize_size <= 0)
     {
-        new_width = target_width;
-        new_height = static_cast<int>(target_width / aspect_ratio_image);
+        throw std::runtime_error("Invalid resize size: " + std::to_string(resize_size));
     }
-    else
+
+    const detail::resize_plan_key key{detail::resize_mode::center_crop, image_width, image_height, image_channels, crop_width, crop_height, resize_size};
+    resize_into(image, key, resized_image, pad_value);
+}
+
+std::vector<std::uint8_t> image_resize_center_crop(
+    const std::vector<std::uint8_t>& image,
+    int image_width,
+    int image_height,
+    int image_channels,
+    int resize_size,
+    int crop_width,
+    int crop_height,
+    const letterbox_pad& pad_value)
+{
+    check_source_size(image_width, image_height);
+    if (resize_size <= 0)
     {
-        new_height = target_height;
-        new_width = static_cast<int>(target_height * aspect_ratio_image);
+        throw std::runtime_error("Invalid resize size: " + std::to_string(resize_size));
     }
 
-    // Calculate padding
-    int pad_x = (target_width - new_width) / 2;
-    int pad_y = (target_height - new_height) / 2;
+    const detail::resize_plan_key key{detail::resize_mode::center_crop, image_width, image_height, image_channels, crop_width, crop_height, resize_size};
+    return resize_to_new(image, key, pad_value);
+}
+
+void image_resize_aspect_ratio_batch(
+    std::span<const std::tuple<std::vector<std::uint8_t>, int, int, int>> images,
+    int target_width,
+    int target_height,
+    std::vector<std::uint8_t>& resized_batch,
+    const letterbox_pad& pad_value)
+{
+    if (images.empty())
+    {
+        resized_batch.clear();
+        return;
+    }
 
-    // Scale factors
-    double scale_x = static_cast<double>(image_width) / new_width;
-    double scale_y = static_cast<double>(image_height) / new_height;
+    const int image_channels = std::get<3>(images.front());
+    const auto pad_row = make_pad_row(target_width, image_channels, pad_value);
 
-    // Resize with aspect ratio preservation
-    for (int y = 0; y < new_height; ++y)
+    // Resolve one plan per image up front: frames sharing the same size share the same cached plan
+    std::vector<std::shared_ptr<const detail::resize_plan>> plans(images.size());
+    for (std::size_t n = 0; n < images.size(); ++n)
     {
-        for (int x = 0; x < new_width; ++x)
+        const auto& [image, image_width, image_height, channels] = images[n];
+        if (channels != image_channels)
         {
-            int src_x = std::min(static_cast<int>(x * scale_x), image_width - 1);
-            int src_y = std::min(static_cast<int>(y * scale_y), image_height - 1);
-
-            for (int c = 0; c < image_channels; ++c)
-            {
-                auto idx = ((y + pad_y) * target_width + (x + pad_x)) * image_channels + c;
-                resized_image[idx] = image[(src_y * image_width + src_x) * image_channels + c];
-            }
+            throw std::runtime_error("Invalid batch image channels: image " + std::to_string(n) + " has " + std::to_string(channels) + " channels, expected " + std::to_string(image_channels));
         }
+
+        plans[n] = detail::get_resize_plan(detail::resize_plan_key{detail::resize_mode::letterbox, image_width, image_height, image_channels, target_width, target_height, 0});
     }
+
+    const std::size_t row_bytes = pad_row.size();
+    const std::size_t image_bytes = row_bytes * std::max(target_height, 0);
+    resized_batch.resize(image_bytes * images.size());
+
+    detail::parallel_for(static_cast<int>(images.size()), [&](int begin, int end) {
+        for (int n = begin; n < end; ++n)
+        {
+            const auto& [image, image_width, image_height, channels] = images[n];
+            std::uint8_t* dst = resized_batch.data() + n * image_bytes;
+            for (int y = 0; y < target_height; ++y)
+                write_resize_row(image.data(), static_cast<std::size_t>(image_width) * image_channels, image_channels, target_width, *plans[n], pad_row, y, dst + y * row_bytes);
+        }
+    });
 }
 
-std::vector<std::uint8_t> image_resize_aspect_ratio(
-    const std::vector<std::uint8_t>& image,
-    int image_width,
-    int image_height,
-    int image_channels,
+std::vector<std::uint8_t> image_resize_aspect_ratio_batch(
+    std::span<const std::tuple<std::vector<std::uint8_t>, int, int, int>> images,
     int target_width,
-    int target_height)
+    int target_height,
+    const letterbox_pad& pad_value)
 {
-    std::vector<std::uint8_t> resized_image(target_width * target_height * image_channels, std::uint8_t(0));
-    image_resize_aspect_ratio(image, image_width, image_height, image_channels, target_width, target_height, resized_image);
-    return resized_image;
+    std::vector<std::uint8_t> resized_batch;
+    image_resize_aspect_ratio_batch(images, target_width, target_height, resized_batch, pad_value);
+    return resized_batch;
 }
 
 }
@@ -0,0 +1,674 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <teiacare/image/image_rotate.hpp>
+
+#include "parallel.hpp"
+#include "simd.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
+namespace tc::img
+{
+namespace
+{
+// Side in pixels of the square tiles walked by the transposing kernels, so that source and destination rows of a tile stay in cache
+constexpr int tile_size = 64;
+
+#if defined(TC_IMG_SSE2) || defined(TC_IMG_NEON)
+#if defined(TC_IMG_SSE2)
+using chunk = __m128i;
+
+inline chunk load_chunk(const std::uint8_t* p)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+}
+
+inline void store_chunk(std::uint8_t* p, chunk v)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);
+}
+
+/*!
+ * \brief Reverse the order of the pixels stored in a 16-byte chunk, for 1 or 4 channels.
+ */
+template <int Channels>
+inline chunk reverse_chunk(chunk v)
+{
+    v = _mm_shuffle_epi32(v, _MM_SHUFFLE(0, 1, 2, 3));
+    if constexpr (Channels == 1)
+    {
+        v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1));
+        v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+    }
+    return v;
+}
+#else
+using chunk = uint8x16_t;
+
+inline chunk load_chunk(const std::uint8_t* p)
+{
+    return vld1q_u8(p);
+}
+
+inline void store_chunk(std::uint8_t* p, chunk v)
+{
+    vst1q_u8(p, v);
+}
+
+/*!
+ * \brief Reverse the order of the pixels stored in a 16-byte chunk, for 1 or 4 channels.
+ */
+template <int Channels>
+inline chunk reverse_chunk(chunk v)
+{
+    if constexpr (Channels == 1)
+        v = vrev64q_u8(v);
+    else
+        v = vreinterpretq_u8_u32(vrev64q_u32(vreinterpretq_u32_u8(v)));
+    return vextq_u8(v, v, 8);
+}
+#endif
+#endif
+
+/*!
+ * \brief Write row b reversed into out_a and row a reversed into out_b, each row holding count pixels.
+ *
+ * Both source pixels of a pair are read before being written, so the outputs may alias the inputs.
+ * When a and b are the same row only half of the pairs are processed, which reverses the row (in place if out_a is a).
+ */
+template <int Channels>
+void reverse_rows(const std::uint8_t* a, const std::uint8_t* b, std::uint8_t* out_a, std::uint8_t* out_b, int count, int channels)
+{
+    if constexpr (Channels > 0)
+        channels = Channels;
+
+    const bool same_row = (a == b);
+    const int pairs = same_row ? (count + 1) / 2 : count;
+    int i = 0;
+
+#if defined(TC_IMG_SSE2) || defined(TC_IMG_NEON)
+    if constexpr (Channels == 1 || Channels == 4)
+    {
+        constexpr int step = 16 / Channels;
+        // Chunks of the same row are swapped from both ends until they would overlap
+        for (; same_row ? (2 * (i + step) <= count) : (i + step <= count); i += step)
+        {
+            const int j = count - i - step;
+            const chunk va = load_chunk(a + i * Channels);
+            const chunk vb = load_chunk(b + j * Channels);
+            store_chunk(out_a + i * Channels, reverse_chunk<Channels>(vb));
+            store_chunk(out_b + j * Channels, reverse_chunk<Channels>(va));
+        }
+    }
+#endif
+
+    for (; i < pairs; ++i)
+    {
+        const std::size_t ia = static_cast<std::size_t>(i) * channels;
+        const std::size_t ib = static_cast<std::size_t>(count - 1 - i) * channels;
+        for (int c = 0; c < channels; ++c)
+        {
+            const std::uint8_t va = a[ia + c];
+            const std::uint8_t vb = b[ib + c];
+            out_a[ia + c] = vb;
+            out_b[ib + c] = va;
+        }
+    }
+}
+
+#if defined(TC_IMG_SSE2)
+/*!
+ * \brief Transpose the 4x4 matrix of 32-bit elements whose rows are r0..r3, storing the transposed rows in t[0..3].
+ */
+inline void transpose_4x4_epi32(__m128i r0, __m128i r1, __m128i r2, __m128i r3, __m128i* t)
+{
+    const __m128i lo01 = _mm_unpacklo_epi32(r0, r1);
+    const __m128i lo23 = _mm_unpacklo_epi32(r2, r3);
+    const __m128i hi01 = _mm_unpackhi_epi32(r0, r1);
+    const __m128i hi23 = _mm_unpackhi_epi32(r2, r3);
+    t[0] = _mm_unpacklo_epi64(lo01, lo23);
+    t[1] = _mm_unpackhi_epi64(lo01, lo23);
+    t[2] = _mm_unpacklo_epi64(hi01, hi23);
+    t[3] = _mm_unpackhi_epi64(hi01, hi23);
+}
+
+#if defined(TC_IMG_SSSE3)
+/*!
+ * \brief Transpose a block of 4x4 pixels of 3 channels.
+ *
+ * Rows are widened to 4 bytes per pixel so that the 32-bit transpose applies, then packed back to 12 bytes.
+ * Loads and stores cover exactly 12 bytes per row, so the block never touches the pixels around it.
+ */
+inline void transpose_block_rgb_4x4(const std::uint8_t* const* src_rows, std::ptrdiff_t src_offset, std::uint8_t* const* dst_rows, std::ptrdiff_t dst_offset)
+{
+    const __m128i widen = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m128i pack = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+
+    __m128i r[4];
+    for (int k = 0; k < 4; ++k)
+    {
+        const std::uint8_t* p = src_rows[k] + src_offset;
+        std::int32_t tail;
+        std::memcpy(&tail, p + 8, sizeof(tail));
+        r[k] = _mm_shuffle_epi8(_mm_unpacklo_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)), _mm_cvtsi32_si128(tail)), widen);
+    }
+
+    __m128i t[4];
+    transpose_4x4_epi32(r[0], r[1], r[2], r[3], t);
+    for (int k = 0; k < 4; ++k)
+    {
+        std::uint8_t* p = dst_rows[k] + dst_offset;
+        const __m128i v = _mm_shuffle_epi8(t[k], pack);
+        const std::int32_t tail = _mm_cvtsi128_si32(_mm_srli_si128(v, 8));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(p), v);
+        std::memcpy(p + 8, &tail, sizeof(tail));
+    }
+}
+#endif
+#elif defined(TC_IMG_NEON)
+/*!
+ * \brief Transpose an 8x8 byte matrix held in 8 registers.
+ */
+inline void transpose_8x8_u8(const uint8x8_t* r, uint8x8_t* out)
+{
+    const uint8x8x2_t t0 = vtrn_u8(r[0], r[1]);
+    const uint8x8x2_t t1 = vtrn_u8(r[2], r[3]);
+    const uint8x8x2_t t2 = vtrn_u8(r[4], r[5]);
+    const uint8x8x2_t t3 = vtrn_u8(r[6], r[7]);
+    const uint16x4x2_t u0 = vtrn_u16(vreinterpret_u16_u8(t0.val[0]), vreinterpret_u16_u8(t1.val[0]));
+    const uint16x4x2_t u1 = vtrn_u16(vreinterpret_u16_u8(t0.val[1]), vreinterpret_u16_u8(t1.val[1]));
+    const uint16x4x2_t u2 = vtrn_u16(vreinterpret_u16_u8(t2.val[0]), vreinterpret_u16_u8(t3.val[0]));
+    const uint16x4x2_t u3 = vtrn_u16(vreinterpret_u16_u8(t2.val[1]), vreinterpret_u16_u8(t3.val[1]));
+    const uint32x2x2_t v0 = vtrn_u32(vreinterpret_u32_u16(u0.val[0]), vreinterpret_u32_u16(u2.val[0]));
+    const uint32x2x2_t v1 = vtrn_u32(vreinterpret_u32_u16(u1.val[0]), vreinterpret_u32_u16(u3.val[0]));
+    const uint32x2x2_t v2 = vtrn_u32(vreinterpret_u32_u16(u0.val[1]), vreinterpret_u32_u16(u2.val[1]));
+    const uint32x2x2_t v3 = vtrn_u32(vreinterpret_u32_u16(u1.val[1]), vreinterpret_u32_u16(u3.val[1]));
+    out[0] = vreinterpret_u8_u32(v0.val[0]);
+    out[1] = vreinterpret_u8_u32(v1.val[0]);
+    out[2] = vreinterpret_u8_u32(v2.val[0]);
+    out[3] = vreinterpret_u8_u32(v3.val[0]);
+    out[4] = vreinterpret_u8_u32(v0.val[1]);
+    out[5] = vreinterpret_u8_u32(v1.val[1]);
+    out[6] = vreinterpret_u8_u32(v2.val[1]);
+    out[7] = vreinterpret_u8_u32(v3.val[1]);
+}
+#endif
+
+/*!
+ * \brief Transpose a block of Size x Size pixels: destination row k receives the pixels of column k of the source rows.
+ */
+template <int Channels, int Size>
+inline void transpose_block(const std::uint8_t* const* src_rows, std::uint8_t* const* dst_rows, int channels)
+{
+#if defined(TC_IMG_SSE2)
+    if constexpr (Channels == 1 && Size == 8)
+    {
+        __m128i r[8];
+        for (int k = 0; k < 8; ++k)
+            r[k] = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src_rows[k]));
+
+        const __m128i b0 = _mm_unpacklo_epi8(r[0], r[1]);
+        const __m128i b1 = _mm_unpacklo_epi8(r[2], r[3]);
+        const __m128i b2 = _mm_unpacklo_epi8(r[4], r[5]);
+        const __m128i b3 = _mm_unpacklo_epi8(r[6], r[7]);
+        const __m128i c0 = _mm_unpacklo_epi16(b0, b1);
+        const __m128i c1 = _mm_unpackhi_epi16(b0, b1);
+        const __m128i c2 = _mm_unpacklo_epi16(b2, b3);
+        const __m128i c3 = _mm_unpackhi_epi16(b2, b3);
+        const __m128i d[4] = {_mm_unpacklo_epi32(c0, c2), _mm_unpackhi_epi32(c0, c2), _mm_unpacklo_epi32(c1, c3), _mm_unpackhi_epi32(c1, c3)};
+        for (int k = 0; k < 4; ++k)
+        {
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(dst_rows[2 * k]), d[k]);
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(dst_rows[2 * k + 1]), _mm_unpackhi_epi64(d[k], d[k]));
+        }
+        return;
+    }
+#if defined(TC_IMG_SSSE3)
+    if constexpr (Channels == 3 && Size == 8)
+    {
+        // Source quadrant (i, j) becomes destination quadrant (j, i)
+        for (int i = 0; i < 2; ++i)
+        {
+            for (int j = 0; j < 2; ++j)
+                transpose_block_rgb_4x4(src_rows + 4 * i, 12 * j, dst_rows + 4 * j, 12 * i);
+        }
+        return;
+    }
+#endif
+    if constexpr (Channels == 4 && Size == 4)
+    {
+        __m128i t[4];
+        transpose_4x4_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src_rows[0])), _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_rows[1])),
+                            _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_rows[2])), _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_rows[3])), t);
+        for (int k = 0; k < 4; ++k)
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_rows[k]), t[k]);
+        return;
+    }
+#elif defined(TC_IMG_NEON)
+    if constexpr (Channels == 1 && Size == 8)
+    {
+        uint8x8_t r[8];
+        uint8x8_t t[8];
+        for (int k = 0; k < 8; ++k)
+            r[k] = vld1_u8(src_rows[k]);
+        transpose_8x8_u8(r, t);
+        for (int k = 0; k < 8; ++k)
+            vst1_u8(dst_rows[k], t[k]);
+        return;
+    }
+    if constexpr (Channels == 3 && Size == 8)
+    {
+        // Structured loads split the rows into channel planes, each plane is transposed as a byte matrix
+        uint8x8x3_t rows[8];
+        for (int k = 0; k < 8; ++k)
+            rows[k] = vld3_u8(src_rows[k]);
+        for (int c = 0; c < 3; ++c)
+        {
+            uint8x8_t r[8];
+            uint8x8_t t[8];
+            for (int k = 0; k < 8; ++k)
+                r[k] = rows[k].val[c];
+            transpose_8x8_u8(r, t);
+            for (int k = 0; k < 8; ++k)
+                rows[k].val[c] = t[k];
+        }
+        for (int k = 0; k < 8; ++k)
+            vst3_u8(dst_rows[k], rows[k]);
+        return;
+    }
+    if constexpr (Channels == 4 && Size == 4)
+    {
+        const uint32x4x2_t t0 = vtrnq_u32(vreinterpretq_u32_u8(vld1q_u8(src_rows[0])), vreinterpretq_u32_u8(vld1q_u8(src_rows[1])));
+        const uint32x4x2_t t1 = vtrnq_u32(vreinterpretq_u32_u8(vld1q_u8(src_rows[2])), vreinterpretq_u32_u8(vld1q_u8(src_rows[3])));
+        vst1q_u8(dst_rows[0], vreinterpretq_u8_u32(vcombine_u32(vget_low_u32(t0.val[0]), vget_low_u32(t1.val[0]))));
+        vst1q_u8(dst_rows[1], vreinterpretq_u8_u32(vcombine_u32(vget_low_u32(t0.val[1]), vget_low_u32(t1.val[1]))));
+        vst1q_u8(dst_rows[2], vreinterpretq_u8_u32(vcombine_u32(vget_high_u32(t0.val[0]), vget_high_u32(t1.val[0]))));
+        vst1q_u8(dst_rows[3], vreinterpretq_u8_u32(vcombine_u32(vget_high_u32(t0.val[1]), vget_high_u32(t1.val[1]))));
+        return;
+    }
+#endif
+
+    if constexpr (Channels > 0)
+        channels = Channels;
+
+    for (int k = 0; k < Size; ++k)
+    {
+        for (int r = 0; r < Size; ++r)
+            std::memcpy(dst_rows[k] + r * channels, src_rows[r] + k * channels, channels);
+    }
+}
+
+/*!
+ * \brief Transpose a region of width x height pixels: destination row x receives column x of the source.
+ * \param src First source row
+ * \param src_step Signed distance in bytes between consecutive source rows
+ * \param dst First destination row
+ * \param dst_step Signed distance in bytes between consecutive destination rows
+ *
+ * Negative steps walk the rows bottom-up, which turns the transposition into a 90 or 270 degree rotation.
+ */
+template <int Channels>
+void transpose_region(const std::uint8_t* src, std::ptrdiff_t src_step, std::uint8_t* dst, std::ptrdiff_t dst_step, int width, int height, int channels)
+{
+    if constexpr (Channels > 0)
+        channels = Channels;
+
+    // 8x8 pixel blocks for 1 and 3 channels and 4x4 pixel blocks for 4 channels fill whole SIMD registers
+    constexpr int block = (Channels == 4) ? 4 : 8;
+    const std::uint8_t* src_rows[block];
+    std::uint8_t* dst_rows[block];
+
+    for (int ty = 0; ty < height; ty += tile_size)
+    {
+        const int tile_height = std::min(tile_size, height - ty);
+        for (int tx = 0; tx < width; tx += tile_size)
+        {
+            const int tile_width = std::min(tile_size, width - tx);
+            const int full_height = tile_height - tile_height % block;
+            const int full_width = tile_width - tile_width % block;
+
+            for (int by = 0; by < full_height; by += block)
+            {
+                for (int bx = 0; bx < full_width; bx += block)
+                {
+                    for (int k = 0; k < block; ++k)
+                    {
+                        src_rows[k] = src + (ty + by + k) * src_step + static_cast<std::ptrdiff_t>(tx + bx) * channels;
+                        dst_rows[k] = dst + (tx + bx + k) * dst_step + static_cast<std::ptrdiff_t>(ty + by) * channels;
+                    }
+                    transpose_block<Channels, block>(src_rows, dst_rows, channels);
+                }
+            }
+
+            // Remaining columns and rows of the tile that do not fill a whole block
+            for (int y = 0; y < tile_height; ++y)
+            {
+                const int x_begin = (y < full_height) ? full_width : 0;
+                const std::uint8_t* src_row = src + (ty + y) * src_step;
+                for (int x = x_begin; x < tile_width; ++x)
+                    std::memcpy(dst + (tx + x) * dst_step + static_cast<std::ptrdiff_t>(ty + y) * channels, src_row + static_cast<std::ptrdiff_t>(tx + x) * channels, channels);
+            }
+        }
+    }
+}
+
+template <int Channels>
+void transpose_image(const std::uint8_t* src, std::ptrdiff_t src_step, std::uint8_t* dst, std::ptrdiff_t dst_step, int width, int height, int channels)
+{
+    // Bands of source rows map to disjoint bands of destination columns
+    const int bands = (height + tile_size - 1) / tile_size;
+    detail::parallel_for(bands, [&](int band_begin, int band_end) {
+        const int y_begin = band_begin * tile_size;
+        const int y_end = std::min(height, band_end * tile_size);
+        transpose_region<Channels>(src + y_begin * src_step, src_step, dst + static_cast<std::ptrdiff_t>(y_begin) * channels, dst_step, width, y_end - y_begin, channels);
+    });
+}
+
+/*!
+ * \brief Transpose a square image in place, by swapping tiles mirrored across the diagonal through a small buffer.
+ */
+template <int Channels>
+void transpose_square_in_place(std::uint8_t* data, int size, int channels)
+{
+    const std::ptrdiff_t step = static_cast<std::ptrdiff_t>(size) * channels;
+    const int tiles = (size + tile_size - 1) / tile_size;
+
+    detail::parallel_for(tiles, [&](int tile_begin, int tile_end) {
+        std::vector<std::uint8_t> buffer(static_cast<std::size_t>(tile_size) * tile_size * channels);
+        const std::ptrdiff_t buffer_step = static_cast<std::ptrdiff_t>(tile_size) * channels;
+        for (int ti = tile_begin; ti < tile_end; ++ti)
+        {
+            for (int tj = ti; tj < tiles; ++tj)
+            {
+                // Tile a spans rows ti and columns tj, tile b is its mirror across the diagonal
+                const int a_height = std::min(tile_size, size - ti * tile_size);
+                const int a_width = std::min(tile_size, size - tj * tile_size);
+                std::uint8_t* a = data + static_cast<std::ptrdiff_t>(ti) * tile_size * step + static_cast<std::ptrdiff_t>(tj) * tile_size * channels;
+                std::uint8_t* b = data + static_cast<std::ptrdiff_t>(tj) * tile_size * step + static_cast<std::ptrdiff_t>(ti) * tile_size * channels;
+
+                for (int y = 0; y < a_height; ++y)
+                    std::memcpy(buffer.data() + y * buffer_step, a + y * step, static_cast<std::size_t>(a_width) * channels);
+                if (a != b)
+                    transpose_region<Channels>(b, step, a, step, a_height, a_width, channels);
+                transpose_region<Channels>(buffer.data(), buffer_step, b, step, a_width, a_height, channels);
+            }
+        }
+    });
+}
+
+/*!
+ * \brief Dispatch a kernel templated on the channel count to its specializations for 1, 3 and 4 channels.
+ */
+template <typename Func>
+void dispatch_channels(int channels, Func func)
+{
+    switch (channels)
+    {
+    case 1:
+        return func.template operator()<1>();
+    case 3:
+        return func.template operator()<3>();
+    case 4:
+        return func.template operator()<4>();
+    default:
+        return func.template operator()<0>();
+    }
+}
+
+enum class transpose_mode
+{
+    transpose,
+    rotate90,
+    rotate270
+};
+
+void transpose_into(const std::vector<std::uint8_t>& image, int width, int height, int channels, std::vector<std::uint8_t>& output, transpose_mode mode)
+{
+    if (width <= 0 || height <= 0)
+    {
+        output.clear();
+        return;
+    }
+
+    const std::size_t size = static_cast<std::size_t>(width) * height * channels;
+    if (&image == &output && width == height)
+    {
+        // Square images rotate in place as a transposition followed by a flip
+        dispatch_channels(channels, [&]<int Channels>() {
+            transpose_square_in_place<Channels>(output.data(), width, channels);
+            if (mode == transpose_mode::transpose)
+                return;
+
+            const std::ptrdiff_t step = static_cast<std::ptrdiff_t>(width) * channels;
+            std::uint8_t* data = output.data();
+            if (mode == transpose_mode::rotate90)
+            {
+                detail::parallel_for(height, [&](int begin, int end) {
+                    for (int y = begin; y < end; ++y)
+                        reverse_rows<Channels>(data + y * step, data + y * step, data + y * step, data + y * step, width, channels);
+                }, 16);
+            }
+            else
+            {
+                detail::parallel_for(height / 2, [&](int begin, int end) {
+                    for (int y = begin; y < end; ++y)
+                        std::swap_ranges(data + y * step, data + (y + 1) * step, data + (height - 1 - y) * step);
+                }, 16);
+            }
+        });
+        return;
+    }
+
+    // Non square images cannot be transposed in place, work from a copy of the input
+    std::vector<std::uint8_t> copy;
+    const std::vector<std::uint8_t>& source = (&image == &output) ? (copy = image) : image;
+    output.resize(size);
+
+    const std::ptrdiff_t src_step = static_cast<std::ptrdiff_t>(width) * channels;
+    const std::ptrdiff_t dst_step = static_cast<std::ptrdiff_t>(height) * channels;
+    const std::uint8_t* src = source.data();
+    std::uint8_t* dst = output.data();
+    if (mode == transpose_mode::rotate90)
+    {
+        // Walking the source bottom-up mirrors the destination columns
+        src += (height - 1) * src_step;
+        dispatch_channels(channels, [&]<int Channels>() { transpose_image<Channels>(src, -src_step, dst, dst_step, width, height, channels); });
+    }
+    else if (mode == transpose_mode::rotate270)
+    {
+        // Writing the destination bottom-up mirrors its rows
+        dst += (width - 1) * dst_step;
+        dispatch_channels(channels, [&]<int Channels>() { transpose_image<Channels>(src, src_step, dst, -dst_step, width, height, channels); });
+    }
+    else
+    {
+        dispatch_channels(channels, [&]<int Channels>() { transpose_image<Channels>(src, src_step, dst, dst_step, width, height, channels); });
+    }
+}
+
+}
+
+void flip_horizontal(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    std::vector<std::uint8_t>& flipped_image)
+{
+    flipped_image.resize(image.size());
+    const std::ptrdiff_t step = static_cast<std::ptrdiff_t>(width) * channels;
+    const std::uint8_t* src = image.data();
+    std::uint8_t* dst = flipped_image.data();
+
+    dispatch_channels(channels, [&]<int Channels>() {
+        detail::parallel_for(height, [&](int begin, int end) {
+            for (int y = begin; y < end; ++y)
+                reverse_rows<Channels>(src + y * step, src + y * step, dst + y * step, dst + y * step, width, channels);
+        }, 16);
+    });
+}
+
+std::vector<std::uint8_t> flip_horizontal(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels)
+{
+    std::vector<std::uint8_t> flipped_image;
+    flip_horizontal(image, width, height, channels, flipped_image);
+    return flipped_image;
+}
+
+void flip_vertical(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    std::vector<std::uint8_t>& flipped_image)
+{
+    const bool in_place = (&image == &flipped_image);
+    flipped_image.resize(image.size());
+    const std::size_t row_size = static_cast<std::size_t>(width) * channels;
+
+    detail::parallel_for((height + 1) / 2, [&](int begin, int end) {
+        for (int y = begin; y < end; ++y)
+        {
+            const std::size_t top = y * row_size;
+            const std::size_t bottom = (height - 1 - y) * row_size;
+            if (in_place)
+            {
+                std::swap_ranges(flipped_image.begin() + top, flipped_image.begin() + top + row_size, flipped_image.begin() + bottom);
+            }
+            else
+            {
+                std::memcpy(flipped_image.data() + top, image.data() + bottom, row_size);
+                std::memcpy(flipped_image.data() + bottom, image.data() + top, row_size);
+            }
+        }
+    }, 16);
+}
+
+std::vector<std::uint8_t> flip_vertical(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels)
+{
+    std::vector<std::uint8_t> flipped_image;
+    flip_vertical(image, width, height, channels, flipped_image);
+    return flipped_image;
+}
+
+void rotate90(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    std::vector<std::uint8_t>& rotated_image)
+{
+    transpose_into(image, width, height, channels, rotated_image, transpose_mode::rotate90);
+}
+
+std::vector<std::uint8_t> rotate90(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels)
+{
+    std::vector<std::uint8_t> rotated_image;
+    rotate90(image, width, height, channels, rotated_image);
+    return rotated_image;
+}
+
+void rotate180(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    std::vector<std::uint8_t>& rotated_image)
+{
+    rotated_image.resize(image.size());
+    const std::ptrdiff_t step = static_cast<std::ptrdiff_t>(width) * channels;
+    const std::uint8_t* src = image.data();
+    std::uint8_t* dst = rotated_image.data();
+
+    // Row y of the output is row height - 1 - y reversed, so rows are processed in mirrored pairs
+    dispatch_channels(channels, [&]<int Channels>() {
+        detail::parallel_for((height + 1) / 2, [&](int begin, int end) {
+            for (int y = begin; y < end; ++y)
+            {
+                const std::ptrdiff_t top = y * step;
+                const std::ptrdiff_t bottom = (height - 1 - y) * step;
+                reverse_rows<Channels>(src + top, src + bottom, dst + top, dst + bottom, width, channels);
+            }
+        }, 16);
+    });
+}
+
+std::vector<std::uint8_t> rotate180(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels)
+{
+    std::vector<std::uint8_t> rotated_image;
+    rotate180(image, width, height, channels, rotated_image);
+    return rotated_image;
+}
+
+void rotate270(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    std::vector<std::uint8_t>& rotated_image)
+{
+    transpose_into(image, width, height, channels, rotated_image, transpose_mode::rotate270);
+}
+
+std::vector<std::uint8_t> rotate270(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels)
+{
+    std::vector<std::uint8_t> rotated_image;
+    rotate270(image, width, height, channels, rotated_image);
+    return rotated_image;
+}
+
+void transpose(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    std::vector<std::uint8_t>& transposed_image)
+{
+    transpose_into(image, width, height, channels, transposed_image, transpose_mode::transpose);
+}
+
+std::vector<std::uint8_t> transpose(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels)
+{
+    std::vector<std::uint8_t> transposed_image;
+    transpose(image, width, height, channels, transposed_image);
+    return transposed_image;
+}
+
+}
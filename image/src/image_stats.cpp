@@ -0,0 +1,187 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <teiacare/image/image_stats.hpp>
+
+#include "parallel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+
+namespace tc::img
+{
+namespace
+{
+// Consecutive pixels count into different copies of the histograms, so that runs of equal values do not serialize on one counter
+constexpr std::size_t histogram_copies = 4;
+
+// Pixels counted in 32-bit histograms before they are added to the 64-bit totals
+constexpr std::size_t stats_block_size = 1 << 16;
+
+/*!
+ * \brief Count the values of count pixels into histogram_copies interleaved sets of per-channel histograms.
+ * \tparam Channels Number of channels, or 0 to use the channels argument
+ */
+template <int Channels>
+void count_values(const std::uint8_t* pixels, std::size_t count, int channels, std::uint32_t* histograms)
+{
+    const std::size_t c = Channels > 0 ? Channels : static_cast<std::size_t>(channels);
+    std::size_t i = 0;
+    for (; i + histogram_copies <= count; i += histogram_copies)
+    {
+        const std::uint8_t* p = pixels + i * c;
+        for (std::size_t k = 0; k < histogram_copies * c; ++k)
+            ++histograms[k * 256 + p[k]];
+    }
+
+    for (; i < count; ++i)
+    {
+        const std::uint8_t* p = pixels + i * c;
+        for (std::size_t k = 0; k < c; ++k)
+            ++histograms[k * 256 + p[k]];
+    }
+}
+
+using count_kernel = void (*)(const std::uint8_t*, std::size_t, int, std::uint32_t*);
+
+count_kernel select_count_kernel(int channels)
+{
+    switch (channels)
+    {
+    case 1:
+        return &count_values<1>;
+    case 3:
+        return &count_values<3>;
+    case 4:
+        return &count_values<4>;
+    default:
+        return &count_values<0>;
+    }
+}
+}
+
+double channel_stats::mean() const
+{
+    return count > 0 ? static_cast<double>(sum) / static_cast<double>(count) : 0.0;
+}
+
+double channel_stats::variance() const
+{
+    if (count == 0)
+        return 0.0;
+
+    const double m = mean();
+    return std::max(0.0, static_cast<double>(sum_squares) / static_cast<double>(count) - m * m);
+}
+
+double channel_stats::std_dev() const
+{
+    return std::sqrt(variance());
+}
+
+channel_stats& channel_stats::operator+=(const channel_stats& other)
+{
+    if (other.count == 0)
+        return *this;
+
+    min = count > 0 ? std::min(min, other.min) : other.min;
+    max = count > 0 ? std::max(max, other.max) : other.max;
+    count += other.count;
+    sum += other.sum;
+    sum_squares += other.sum_squares;
+    for (std::size_t v = 0; v < histogram.size(); ++v)
+        histogram[v] += other.histogram[v];
+    return *this;
+}
+
+void image_stats(const std::vector<std::uint8_t>& image, int channels, std::vector<channel_stats>& stats)
+{
+    if (channels <= 0)
+    {
+        throw std::runtime_error("Invalid channels: " + std::to_string(channels));
+    }
+
+    const std::size_t c = static_cast<std::size_t>(channels);
+    if (image.size() % c != 0)
+    {
+        throw std::runtime_error("Invalid image size: " + std::to_string(image.size()) + " bytes are not a multiple of " + std::to_string(channels) + " channels");
+    }
+
+    const std::size_t count = image.size() / c;
+    const count_kernel kernel = select_count_kernel(channels);
+    std::vector<std::uint64_t> totals(c * 256, 0);
+    std::mutex totals_mutex;
+
+    const int blocks = static_cast<int>((count + stats_block_size - 1) / stats_block_size);
+    detail::parallel_for(blocks, [&](int begin, int end) {
+        std::vector<std::uint32_t> histograms(histogram_copies * c * 256);
+        std::vector<std::uint64_t> partial(c * 256, 0);
+        for (int block = begin; block < end; ++block)
+        {
+            const std::size_t first = static_cast<std::size_t>(block) * stats_block_size;
+            const std::size_t last = std::min(count, first + stats_block_size);
+            std::fill(histograms.begin(), histograms.end(), 0u);
+            kernel(image.data() + first * c, last - first, channels, histograms.data());
+
+            // Copy k holds channel k % channels
+            for (std::size_t k = 0; k < histogram_copies * c; ++k)
+            {
+                std::uint64_t* dst = partial.data() + (k % c) * 256;
+                const std::uint32_t* src = histograms.data() + k * 256;
+                for (std::size_t v = 0; v < 256; ++v)
+                    dst[v] += src[v];
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(totals_mutex);
+        for (std::size_t i = 0; i < totals.size(); ++i)
+            totals[i] += partial[i];
+    }, 4);
+
+    stats.assign(c, channel_stats{});
+    for (std::size_t ch = 0; ch < c; ++ch)
+    {
+        channel_stats& s = stats[ch];
+        std::copy_n(totals.begin() + ch * 256, 256, s.histogram.begin());
+        s.count = count;
+        bool found = false;
+        for (std::size_t v = 0; v < 256; ++v)
+        {
+            const std::uint64_t n = s.histogram[v];
+            if (n == 0)
+                continue;
+
+            s.sum += n * v;
+            s.sum_squares += n * v * v;
+            s.max = static_cast<std::uint8_t>(v);
+            if (!found)
+            {
+                s.min = static_cast<std::uint8_t>(v);
+                found = true;
+            }
+        }
+    }
+}
+
+std::vector<channel_stats> image_stats(const std::vector<std::uint8_t>& image, int channels)
+{
+    std::vector<channel_stats> stats;
+    image_stats(image, channels, stats);
+    return stats;
+}
+
+}
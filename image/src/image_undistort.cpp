@@ -0,0 +1,117 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <teiacare/image/image_undistort.hpp>
+
+#include "parallel.hpp"
+#include "sampling.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace tc::img
+{
+namespace
+{
+void validate_intrinsics(const camera_intrinsics& camera)
+{
+    if (camera.fx == 0.0 || camera.fy == 0.0 || !std::isfinite(camera.fx) || !std::isfinite(camera.fy))
+    {
+        throw std::runtime_error("Invalid camera intrinsics: focal lengths must be finite and non-zero");
+    }
+}
+
+/*!
+ * \brief Build a remap plan from a lens model mapping normalized undistorted coordinates to normalized distorted coordinates.
+ */
+template <typename DistortFunc>
+remap_plan make_lens_remap_plan(
+    const camera_intrinsics& camera,
+    const camera_intrinsics& new_camera,
+    int target_width,
+    int target_height,
+    interpolation interp,
+    DistortFunc distort)
+{
+    validate_intrinsics(camera);
+    validate_intrinsics(new_camera);
+    const bool nearest = (interp == interpolation::nearest);
+
+    remap_plan plan;
+    plan.width = std::max(target_width, 0);
+    plan.height = std::max(target_height, 0);
+    plan.interp = interp;
+    plan.coords.resize(2 * static_cast<std::size_t>(plan.width) * plan.height);
+    plan.weights.resize(static_cast<std::size_t>(plan.width) * plan.height);
+
+    const double inv_fx = 1.0 / new_camera.fx;
+    const double inv_fy = 1.0 / new_camera.fy;
+    detail::parallel_for(plan.height, [&](int y_begin, int y_end) {
+        for (int y = y_begin; y < y_end; ++y)
+        {
+            const double ny = (y - new_camera.cy) * inv_fy;
+            const std::size_t row = static_cast<std::size_t>(y) * plan.width;
+            for (int x = 0; x < plan.width; ++x)
+            {
+                double dx, dy;
+                distort((x - new_camera.cx) * inv_fx, ny, dx, dy);
+                detail::store_remap_coordinate(camera.fx * dx + camera.cx, camera.fy * dy + camera.cy, nearest, plan.coords.data() + 2 * (row + x), plan.weights.data() + row + x);
+            }
+        }
+    }, 16);
+
+    return plan;
+}
+
+}
+
+remap_plan make_undistort_remap_plan(
+    const camera_intrinsics& camera,
+    const brown_conrady_distortion& distortion,
+    const camera_intrinsics& new_camera,
+    int target_width,
+    int target_height,
+    interpolation interp)
+{
+    const auto& d = distortion;
+    return make_lens_remap_plan(camera, new_camera, target_width, target_height, interp, [&d](double x, double y, double& dx, double& dy) {
+        const double r2 = x * x + y * y;
+        const double radial = 1.0 + r2 * (d.k1 + r2 * (d.k2 + r2 * d.k3));
+        dx = x * radial + 2.0 * d.p1 * x * y + d.p2 * (r2 + 2.0 * x * x);
+        dy = y * radial + d.p1 * (r2 + 2.0 * y * y) + 2.0 * d.p2 * x * y;
+    });
+}
+
+remap_plan make_undistort_remap_plan(
+    const camera_intrinsics& camera,
+    const fisheye_distortion& distortion,
+    const camera_intrinsics& new_camera,
+    int target_width,
+    int target_height,
+    interpolation interp)
+{
+    const auto& d = distortion;
+    return make_lens_remap_plan(camera, new_camera, target_width, target_height, interp, [&d](double x, double y, double& dx, double& dy) {
+        // Equidistant projection: the distorted radius is a polynomial of the incidence angle
+        const double r = std::sqrt(x * x + y * y);
+        const double theta = std::atan(r);
+        const double theta2 = theta * theta;
+        const double theta_d = theta * (1.0 + theta2 * (d.k1 + theta2 * (d.k2 + theta2 * (d.k3 + theta2 * d.k4))));
+        const double scale = (r > 1e-12) ? theta_d / r : 1.0;
+        dx = x * scale;
+        dy = y * scale;
+    });
+}
+
+}
@@ -0,0 +1,413 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <teiacare/image/image_warp.hpp>
+
+#include "sampling.hpp"
+#include "simd.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <stdexcept>
+#include <string>
+
+namespace tc::img
+{
+namespace
+{
+constexpr int coord_bits = 16;
+constexpr double coord_one = 1 << coord_bits;
+constexpr int block_size = 256;
+
+// Rows whose coordinates stay within this bound (in pixels) can be stepped in 16.16 fixed point without overflow
+constexpr double coord_limit = 8192.0;
+
+std::array<double, 6> invert_affine(const std::array<double, 6>& m)
+{
+    const double det = m[0] * m[4] - m[1] * m[3];
+    if (det == 0.0 || !std::isfinite(det))
+    {
+        throw std::runtime_error("Invalid affine matrix: the matrix is not invertible");
+    }
+
+    const double a = m[4] / det;
+    const double b = -m[1] / det;
+    const double d = -m[3] / det;
+    const double e = m[0] / det;
+    return {a, b, -a * m[2] - b * m[5], d, e, -d * m[2] - e * m[5]};
+}
+
+/*!
+ * \brief Compute count fixed-point coordinates start + i * step, splitting them in integer part and 8-bit weight.
+ */
+void step_coordinates(int start, int step, int count, bool round_to_nearest, int* coords, std::uint16_t* weights)
+{
+    int i = 0;
+    if (round_to_nearest)
+        start += 1 << (coord_bits - 1);
+
+#if defined(TC_IMG_SSE2)
+    __m128i v = _mm_setr_epi32(start, start + step, start + 2 * step, start + 3 * step);
+    const __m128i step4 = _mm_set1_epi32(4 * step);
+    const __m128i weight_mask = _mm_set1_epi32(detail::sampling_weight_one - 1);
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i v1 = _mm_add_epi32(v, step4);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(coords + i), _mm_srai_epi32(v, coord_bits));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(coords + i + 4), _mm_srai_epi32(v1, coord_bits));
+        const __m128i w0 = _mm_and_si128(_mm_srli_epi32(v, coord_bits - detail::sampling_weight_bits), weight_mask);
+        const __m128i w1 = _mm_and_si128(_mm_srli_epi32(v1, coord_bits - detail::sampling_weight_bits), weight_mask);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(weights + i), _mm_packs_epi32(w0, w1));
+        v = _mm_add_epi32(v1, step4);
+    }
+#elif defined(TC_IMG_NEON)
+    const int32_t lanes[4] = {start, start + step, start + 2 * step, start + 3 * step};
+    int32x4_t v = vld1q_s32(lanes);
+    const int32x4_t step4 = vdupq_n_s32(4 * step);
+    const uint32x4_t weight_mask = vdupq_n_u32(detail::sampling_weight_one - 1);
+    for (; i + 8 <= count; i += 8)
+    {
+        const int32x4_t v1 = vaddq_s32(v, step4);
+        vst1q_s32(coords + i, vshrq_n_s32(v, coord_bits));
+        vst1q_s32(coords + i + 4, vshrq_n_s32(v1, coord_bits));
+        const uint32x4_t w0 = vandq_u32(vshrq_n_u32(vreinterpretq_u32_s32(v), coord_bits - detail::sampling_weight_bits), weight_mask);
+        const uint32x4_t w1 = vandq_u32(vshrq_n_u32(vreinterpretq_u32_s32(v1), coord_bits - detail::sampling_weight_bits), weight_mask);
+        vst1q_u16(weights + i, vcombine_u16(vmovn_u32(w0), vmovn_u32(w1)));
+        v = vaddq_s32(v1, step4);
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        const int c = start + i * step;
+        coords[i] = c >> coord_bits;
+        weights[i] = static_cast<std::uint16_t>((c >> (coord_bits - detail::sampling_weight_bits)) & (detail::sampling_weight_one - 1));
+    }
+}
+
+int to_fixed(double coord)
+{
+    return static_cast<int>(std::lround(coord * coord_one));
+}
+
+void warp_affine_rows(
+    const detail::sampling_source& src,
+    const std::array<double, 6>& inverse,
+    int target_width,
+    interpolation interp,
+    std::uint8_t* dst,
+    int y_begin,
+    int y_end)
+{
+    int xs[block_size];
+    int ys[block_size];
+    std::uint16_t wx[block_size];
+    std::uint16_t wy[block_size];
+    const bool nearest = (interp == interpolation::nearest);
+    const std::size_t row_bytes = static_cast<std::size_t>(target_width) * src.channels;
+
+    for (int y = y_begin; y < y_end; ++y)
+    {
+        // Source coordinates of the first pixel of the row, then a constant step per output pixel
+        const double row_x = inverse[1] * y + inverse[2];
+        const double row_y = inverse[4] * y + inverse[5];
+        const double last_x = row_x + inverse[0] * (target_width - 1);
+        const double last_y = row_y + inverse[3] * (target_width - 1);
+        const bool fixed_point = std::max({std::abs(row_x), std::abs(row_y), std::abs(last_x), std::abs(last_y)}) < coord_limit;
+
+        std::uint8_t* dst_row = dst + y * row_bytes;
+        for (int x = 0; x < target_width; x += block_size)
+        {
+            const int count = std::min(block_size, target_width - x);
+            if (fixed_point)
+            {
+                step_coordinates(to_fixed(row_x + inverse[0] * x), to_fixed(inverse[0]), count, nearest, xs, wx);
+                step_coordinates(to_fixed(row_y + inverse[3] * x), to_fixed(inverse[3]), count, nearest, ys, wy);
+            }
+            else
+            {
+                // Fallback for large images or transforms mapping the row far outside the image
+                for (int i = 0; i < count; ++i)
+                {
+                    detail::split_coordinate(row_x + inverse[0] * (x + i), nearest, xs[i], wx[i]);
+                    detail::split_coordinate(row_y + inverse[3] * (x + i), nearest, ys[i], wy[i]);
+                }
+            }
+
+            std::uint8_t* out = dst_row + static_cast<std::size_t>(x) * src.channels;
+            if (nearest)
+                detail::sample_nearest(src, xs, ys, count, out);
+            else
+                detail::sample_bilinear(src, xs, ys, wx, wy, count, out);
+        }
+    }
+}
+
+
+std::array<double, 9> invert_perspective(const std::array<double, 9>& m)
+{
+    const double c00 = m[4] * m[8] - m[5] * m[7];
+    const double c01 = m[5] * m[6] - m[3] * m[8];
+    const double c02 = m[3] * m[7] - m[4] * m[6];
+    const double det = m[0] * c00 + m[1] * c01 + m[2] * c02;
+    if (det == 0.0 || !std::isfinite(det))
+    {
+        throw std::runtime_error("Invalid perspective matrix: the matrix is not invertible");
+    }
+
+    return {
+        c00 / det, (m[2] * m[7] - m[1] * m[8]) / det, (m[1] * m[5] - m[2] * m[4]) / det,
+        c01 / det, (m[0] * m[8] - m[2] * m[6]) / det, (m[2] * m[3] - m[0] * m[5]) / det,
+        c02 / det, (m[1] * m[6] - m[0] * m[7]) / det, (m[0] * m[4] - m[1] * m[3]) / det};
+}
+
+/*!
+ * \brief Expand count packed plan entries to the separate coordinate and weight arrays used by the sampling kernels.
+ */
+void unpack_plan_entries(const std::int16_t* coords, const std::uint16_t* weights, int count, int* xs, int* ys, std::uint16_t* wx, std::uint16_t* wy)
+{
+    int i = 0;
+
+#if defined(TC_IMG_SSE2)
+    // Each (x, y) int16 pair is read as one 32-bit lane: y is its sign-extended high half, x its sign-extended low half
+    const __m128i weight_mask = _mm_set1_epi16(detail::sampling_weight_one - 1);
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i c0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(coords + 2 * i));
+        const __m128i c1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(coords + 2 * i + 8));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(xs + i), _mm_srai_epi32(_mm_slli_epi32(c0, 16), 16));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(xs + i + 4), _mm_srai_epi32(_mm_slli_epi32(c1, 16), 16));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(ys + i), _mm_srai_epi32(c0, 16));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(ys + i + 4), _mm_srai_epi32(c1, 16));
+
+        const __m128i w = _mm_loadu_si128(reinterpret_cast<const __m128i*>(weights + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(wx + i), _mm_and_si128(w, weight_mask));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(wy + i), _mm_srli_epi16(w, detail::sampling_weight_bits));
+    }
+#elif defined(TC_IMG_NEON)
+    const uint16x8_t weight_mask = vdupq_n_u16(detail::sampling_weight_one - 1);
+    for (; i + 8 <= count; i += 8)
+    {
+        const int16x8x2_t c = vld2q_s16(coords + 2 * i);
+        vst1q_s32(xs + i, vmovl_s16(vget_low_s16(c.val[0])));
+        vst1q_s32(xs + i + 4, vmovl_s16(vget_high_s16(c.val[0])));
+        vst1q_s32(ys + i, vmovl_s16(vget_low_s16(c.val[1])));
+        vst1q_s32(ys + i + 4, vmovl_s16(vget_high_s16(c.val[1])));
+
+        const uint16x8_t w = vld1q_u16(weights + i);
+        vst1q_u16(wx + i, vandq_u16(w, weight_mask));
+        vst1q_u16(wy + i, vshrq_n_u16(w, detail::sampling_weight_bits));
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        xs[i] = coords[2 * i];
+        ys[i] = coords[2 * i + 1];
+        wx[i] = weights[i] & (detail::sampling_weight_one - 1);
+        wy[i] = weights[i] >> detail::sampling_weight_bits;
+    }
+}
+
+void remap_rows(const detail::sampling_source& src, const remap_plan& plan, std::uint8_t* dst, int y_begin, int y_end)
+{
+    int xs[block_size];
+    int ys[block_size];
+    std::uint16_t wx[block_size];
+    std::uint16_t wy[block_size];
+    const bool nearest = (plan.interp == interpolation::nearest);
+
+    for (int y = y_begin; y < y_end; ++y)
+    {
+        for (int x = 0; x < plan.width; x += block_size)
+        {
+            const int count = std::min(block_size, plan.width - x);
+            const std::size_t index = static_cast<std::size_t>(y) * plan.width + x;
+            unpack_plan_entries(plan.coords.data() + 2 * index, plan.weights.data() + index, count, xs, ys, wx, wy);
+
+            std::uint8_t* out = dst + index * src.channels;
+            if (nearest)
+                detail::sample_nearest(src, xs, ys, count, out);
+            else
+                detail::sample_bilinear(src, xs, ys, wx, wy, count, out);
+        }
+    }
+}
+
+}
+
+std::array<double, 6> rotation_matrix(double center_x, double center_y, double angle, double scale)
+{
+    const double radians = angle * std::numbers::pi / 180.0;
+    const double alpha = scale * std::cos(radians);
+    const double beta = scale * std::sin(radians);
+    return {alpha, beta, (1.0 - alpha) * center_x - beta * center_y, -beta, alpha, beta * center_x + (1.0 - alpha) * center_y};
+}
+
+void warp_affine(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    const std::array<double, 6>& matrix,
+    int target_width,
+    int target_height,
+    std::vector<std::uint8_t>& warped_image,
+    interpolation interp,
+    border_mode border,
+    const std::vector<std::uint8_t>& border_value,
+    executor& exec)
+{
+    const auto inverse = invert_affine(matrix);
+    const auto border_pixel = detail::expand_border_value(border_value, channels);
+    const detail::sampling_source src{image.data(), width, height, channels, border, border_pixel.data()};
+
+    warped_image.resize(static_cast<std::size_t>(std::max(target_width, 0)) * std::max(target_height, 0) * channels);
+    exec.parallel_for(target_height, [&](int y_begin, int y_end) { warp_affine_rows(src, inverse, target_width, interp, warped_image.data(), y_begin, y_end); }, 16);
+}
+
+std::vector<std::uint8_t> warp_affine(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    const std::array<double, 6>& matrix,
+    int target_width,
+    int target_height,
+    interpolation interp,
+    border_mode border,
+    const std::vector<std::uint8_t>& border_value,
+    executor& exec)
+{
+    std::vector<std::uint8_t> warped_image;
+    warp_affine(image, width, height, channels, matrix, target_width, target_height, warped_image, interp, border, border_value, exec);
+    return warped_image;
+}
+
+remap_plan make_perspective_remap_plan(
+    const std::array<double, 9>& matrix,
+    int target_width,
+    int target_height,
+    interpolation interp,
+    executor& exec)
+{
+    const auto h = invert_perspective(matrix);
+    const bool nearest = (interp == interpolation::nearest);
+
+    remap_plan plan;
+    plan.width = std::max(target_width, 0);
+    plan.height = std::max(target_height, 0);
+    plan.interp = interp;
+    plan.coords.resize(2 * static_cast<std::size_t>(plan.width) * plan.height);
+    plan.weights.resize(static_cast<std::size_t>(plan.width) * plan.height);
+
+    exec.parallel_for(plan.height, [&](int y_begin, int y_end) {
+        for (int y = y_begin; y < y_end; ++y)
+        {
+            // Homogeneous source coordinates advance by the first matrix column for each output pixel
+            double sx = h[1] * y + h[2];
+            double sy = h[4] * y + h[5];
+            double sw = h[7] * y + h[8];
+            const std::size_t row = static_cast<std::size_t>(y) * plan.width;
+            for (int x = 0; x < plan.width; ++x)
+            {
+                const double inv_w = (sw != 0.0) ? 1.0 / sw : std::numeric_limits<double>::infinity();
+                detail::store_remap_coordinate(sx * inv_w, sy * inv_w, nearest, plan.coords.data() + 2 * (row + x), plan.weights.data() + row + x);
+                sx += h[0];
+                sy += h[3];
+                sw += h[6];
+            }
+        }
+    }, 16);
+
+    return plan;
+}
+
+void remap(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    const remap_plan& plan,
+    std::vector<std::uint8_t>& remapped_image,
+    border_mode border,
+    const std::vector<std::uint8_t>& border_value,
+    executor& exec)
+{
+    const std::size_t pixels = static_cast<std::size_t>(std::max(plan.width, 0)) * std::max(plan.height, 0);
+    if (plan.width < 0 || plan.height < 0 || plan.coords.size() != 2 * pixels || plan.weights.size() != pixels)
+    {
+        throw std::runtime_error("Invalid remap plan: expected " + std::to_string(plan.width) + "x" + std::to_string(plan.height) + " entries, got " + std::to_string(plan.coords.size()) + " coordinates and " + std::to_string(plan.weights.size()) + " weights");
+    }
+
+    const auto border_pixel = detail::expand_border_value(border_value, channels);
+    const detail::sampling_source src{image.data(), width, height, channels, border, border_pixel.data()};
+
+    remapped_image.resize(static_cast<std::size_t>(plan.width) * plan.height * channels);
+    exec.parallel_for(plan.height, [&](int y_begin, int y_end) { remap_rows(src, plan, remapped_image.data(), y_begin, y_end); }, 16);
+}
+
+std::vector<std::uint8_t> remap(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    const remap_plan& plan,
+    border_mode border,
+    const std::vector<std::uint8_t>& border_value,
+    executor& exec)
+{
+    std::vector<std::uint8_t> remapped_image;
+    remap(image, width, height, channels, plan, remapped_image, border, border_value, exec);
+    return remapped_image;
+}
+
+void warp_perspective(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    const std::array<double, 9>& matrix,
+    int target_width,
+    int target_height,
+    std::vector<std::uint8_t>& warped_image,
+    interpolation interp,
+    border_mode border,
+    const std::vector<std::uint8_t>& border_value,
+    executor& exec)
+{
+    const auto plan = make_perspective_remap_plan(matrix, target_width, target_height, interp, exec);
+    remap(image, width, height, channels, plan, warped_image, border, border_value, exec);
+}
+
+std::vector<std::uint8_t> warp_perspective(
+    const std::vector<std::uint8_t>& image,
+    int width,
+    int height,
+    int channels,
+    const std::array<double, 9>& matrix,
+    int target_width,
+    int target_height,
+    interpolation interp,
+    border_mode border,
+    const std::vector<std::uint8_t>& border_value,
+    executor& exec)
+{
+    std::vector<std::uint8_t> warped_image;
+    warp_perspective(image, width, height, channels, matrix, target_width, target_height, warped_image, interp, border, border_value, exec);
+    return warped_image;
+}
+
+}
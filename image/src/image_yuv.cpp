@@ -0,0 +1,172 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <teiacare/image/image_yuv.hpp>
+
+#include "interleave.hpp"
+#include "parallel.hpp"
+#include "simd.hpp"
+#include "yuv_convert.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace tc::img
+{
+namespace
+{
+/*!
+ * \brief Upsample count pixels of a planar chroma row horizontally, dst[x] = src[x / 2].
+ */
+void upsample_chroma(const std::uint8_t* src, std::size_t count, std::uint8_t* dst)
+{
+    std::size_t i = 0;
+#if defined(TC_IMG_SSE2)
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i chroma = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i / 2));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_unpacklo_epi8(chroma, chroma));
+    }
+#elif defined(TC_IMG_NEON)
+    for (; i + 16 <= count; i += 16)
+    {
+        const uint8x8_t chroma = vld1_u8(src + i / 2);
+        const uint8x8x2_t pairs = vzip_u8(chroma, chroma);
+        vst1q_u8(dst + i, vcombine_u8(pairs.val[0], pairs.val[1]));
+    }
+#endif
+
+    for (; i < count; ++i)
+        dst[i] = src[i / 2];
+}
+
+/*!
+ * \brief Split an interleaved UV row and upsample count pixels of it horizontally, u[x] = uv[x / 2 * 2] and v[x] = uv[x / 2 * 2 + 1].
+ */
+void upsample_interleaved_chroma(const std::uint8_t* uv, std::size_t count, std::uint8_t* u, std::uint8_t* v)
+{
+    std::size_t i = 0;
+#if defined(TC_IMG_SSE2)
+    // 16 bytes hold the 8 UV pairs of 16 pixels: each 16-bit lane is spread to both of its bytes
+    const __m128i low_bytes = _mm_set1_epi16(0x00FF);
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i pairs = _mm_loadu_si128(reinterpret_cast<const __m128i*>(uv + i));
+        const __m128i cu = _mm_and_si128(pairs, low_bytes);
+        const __m128i cv = _mm_srli_epi16(pairs, 8);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(u + i), _mm_or_si128(cu, _mm_slli_epi16(cu, 8)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(v + i), _mm_or_si128(cv, _mm_slli_epi16(cv, 8)));
+    }
+#elif defined(TC_IMG_NEON)
+    for (; i + 16 <= count; i += 16)
+    {
+        const uint8x8x2_t chroma = vld2_u8(uv + i);
+        const uint8x8x2_t cu = vzip_u8(chroma.val[0], chroma.val[0]);
+        const uint8x8x2_t cv = vzip_u8(chroma.val[1], chroma.val[1]);
+        vst1q_u8(u + i, vcombine_u8(cu.val[0], cu.val[1]));
+        vst1q_u8(v + i, vcombine_u8(cv.val[0], cv.val[1]));
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        u[i] = uv[i / 2 * 2];
+        v[i] = uv[i / 2 * 2 + 1];
+    }
+}
+
+/*!
+ * \brief Convert a 4:2:0 image to interleaved RGB, rows being split across threads.
+ * \tparam Interleaved Whether the chroma is a single interleaved UV plane (NV12) or separate U and V planes (I420)
+ */
+template <bool Interleaved>
+void yuv420_to_rgb(const std::vector<std::uint8_t>& yuv, int width, int height, std::vector<std::uint8_t>& rgb, yuv_matrix matrix, yuv_range range, bool swapRB_channels, const char* format)
+{
+    if (yuv.size() != detail::yuv420_size(width, height))
+    {
+        throw std::runtime_error(std::string("Invalid ") + format + " data: expected " + std::to_string(detail::yuv420_size(width, height)) + " bytes for a " + std::to_string(width) + "x" + std::to_string(height) + " image, got " + std::to_string(yuv.size()));
+    }
+
+    const std::size_t w = static_cast<std::size_t>(std::max(width, 0));
+    const std::size_t h = static_cast<std::size_t>(std::max(height, 0));
+    rgb.resize(w * h * 3);
+    if (w == 0 || h == 0)
+        return;
+
+    const auto coefficients = detail::make_yuv_coefficients(matrix, range);
+    const std::size_t chroma_width = (w + 1) / 2;
+    const std::uint8_t* luma = yuv.data();
+    const std::uint8_t* u_plane = luma + w * h;
+    const std::uint8_t* v_plane = u_plane + chroma_width * ((h + 1) / 2);
+
+    detail::parallel_for(height, [&](int y_begin, int y_end) {
+        // Full resolution chroma rows, then the R, G and B planes of one row, interleaved in a last step
+        std::vector<std::uint8_t> buffer(5 * w);
+        std::uint8_t* u = buffer.data();
+        std::uint8_t* v = u + w;
+        std::uint8_t* planes = v + w;
+        std::uint8_t* r = planes + (swapRB_channels ? 2 : 0) * w;
+        std::uint8_t* g = planes + w;
+        std::uint8_t* b = planes + (swapRB_channels ? 0 : 2) * w;
+
+        int chroma_row = -1;
+        for (int y = y_begin; y < y_end; ++y)
+        {
+            // Both rows of a chroma pair share its upsampled values
+            if (y / 2 != chroma_row)
+            {
+                chroma_row = y / 2;
+                if constexpr (Interleaved)
+                {
+                    upsample_interleaved_chroma(u_plane + chroma_row * chroma_width * 2, w, u, v);
+                }
+                else
+                {
+                    upsample_chroma(u_plane + chroma_row * chroma_width, w, u);
+                    upsample_chroma(v_plane + chroma_row * chroma_width, w, v);
+                }
+            }
+
+            detail::convert_yuv_row(luma + y * w, u, v, w, coefficients, r, g, b);
+            detail::interleave_planes<3>(planes, w, 3, rgb.data() + y * w * 3, w);
+        }
+    }, std::max(1, (1 << 15) / width));
+}
+}
+
+void nv12_to_rgb(const std::vector<std::uint8_t>& nv12, int width, int height, std::vector<std::uint8_t>& rgb, yuv_matrix matrix, yuv_range range, bool swapRB_channels)
+{
+    yuv420_to_rgb<true>(nv12, width, height, rgb, matrix, range, swapRB_channels, "NV12");
+}
+
+std::vector<std::uint8_t> nv12_to_rgb(const std::vector<std::uint8_t>& nv12, int width, int height, yuv_matrix matrix, yuv_range range, bool swapRB_channels)
+{
+    std::vector<std::uint8_t> rgb;
+    yuv420_to_rgb<true>(nv12, width, height, rgb, matrix, range, swapRB_channels, "NV12");
+    return rgb;
+}
+
+void i420_to_rgb(const std::vector<std::uint8_t>& i420, int width, int height, std::vector<std::uint8_t>& rgb, yuv_matrix matrix, yuv_range range, bool swapRB_channels)
+{
+    yuv420_to_rgb<false>(i420, width, height, rgb, matrix, range, swapRB_channels, "I420");
+}
+
+std::vector<std::uint8_t> i420_to_rgb(const std::vector<std::uint8_t>& i420, int width, int height, yuv_matrix matrix, yuv_range range, bool swapRB_channels)
+{
+    std::vector<std::uint8_t> rgb;
+    yuv420_to_rgb<false>(i420, width, height, rgb, matrix, range, swapRB_channels, "I420");
+    return rgb;
+}
+
+}
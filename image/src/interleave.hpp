@@ -0,0 +1,144 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "simd.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace tc::img::detail
+{
+#if defined(TC_IMG_AVX2)
+/*!
+ * \brief Byte shuffle masks interleaving 16 pixels of 3 planes: mask 3 * v + k moves the bytes of plane k to output vector v.
+ */
+constexpr std::array<std::array<std::int8_t, 16>, 9> make_interleave3_masks()
+{
+    std::array<std::array<std::int8_t, 16>, 9> masks{};
+    for (int v = 0; v < 3; ++v)
+    {
+        for (int k = 0; k < 3; ++k)
+        {
+            for (int j = 0; j < 16; ++j)
+            {
+                const int e = 16 * v + j;
+                masks[3 * v + k][j] = e % 3 == k ? static_cast<std::int8_t>(e / 3) : std::int8_t{-128};
+            }
+        }
+    }
+    return masks;
+}
+
+alignas(16) inline constexpr auto interleave3_masks = make_interleave3_masks();
+#endif
+
+/*!
+ * \brief Interleave count pixels of byte planes, plane k starting at planes + k * plane_stride, into an image.
+ * \tparam Channels Compile time channel count for the vectorized 3 and 4 channel loops, 0 for the generic loop
+ */
+template <int Channels>
+void interleave_planes(const std::uint8_t* planes, std::size_t plane_stride, int channels, std::uint8_t* image, std::size_t count)
+{
+    if constexpr (Channels > 0)
+        channels = Channels;
+
+    std::size_t i = 0;
+#if defined(TC_IMG_SSE2)
+    if constexpr (Channels == 4)
+    {
+        for (; i + 16 <= count; i += 16)
+        {
+            const __m128i c0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes + i));
+            const __m128i c1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes + plane_stride + i));
+            const __m128i c2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes + 2 * plane_stride + i));
+            const __m128i c3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes + 3 * plane_stride + i));
+            const __m128i lo01 = _mm_unpacklo_epi8(c0, c1);
+            const __m128i hi01 = _mm_unpackhi_epi8(c0, c1);
+            const __m128i lo23 = _mm_unpacklo_epi8(c2, c3);
+            const __m128i hi23 = _mm_unpackhi_epi8(c2, c3);
+            __m128i* out = reinterpret_cast<__m128i*>(image + i * 4);
+            _mm_storeu_si128(out, _mm_unpacklo_epi16(lo01, lo23));
+            _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(lo01, lo23));
+            _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(hi01, hi23));
+            _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(hi01, hi23));
+        }
+    }
+#if defined(TC_IMG_AVX2)
+    if constexpr (Channels == 3)
+    {
+        for (; i + 16 <= count; i += 16)
+        {
+            const __m128i c0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes + i));
+            const __m128i c1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes + plane_stride + i));
+            const __m128i c2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes + 2 * plane_stride + i));
+            for (int v = 0; v < 3; ++v)
+            {
+                const __m128i b0 = _mm_shuffle_epi8(c0, _mm_load_si128(reinterpret_cast<const __m128i*>(interleave3_masks[3 * v].data())));
+                const __m128i b1 = _mm_shuffle_epi8(c1, _mm_load_si128(reinterpret_cast<const __m128i*>(interleave3_masks[3 * v + 1].data())));
+                const __m128i b2 = _mm_shuffle_epi8(c2, _mm_load_si128(reinterpret_cast<const __m128i*>(interleave3_masks[3 * v + 2].data())));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(image + i * 3 + 16 * v), _mm_or_si128(_mm_or_si128(b0, b1), b2));
+            }
+        }
+    }
+#else
+    if constexpr (Channels == 3)
+    {
+        // Without byte shuffles, pixels are interleaved as 4 bytes with a zero fourth channel and each pair is then packed into the low
+        // 6 bytes of a 64-bit lane. Stores of 8 bytes every 6 overlap, so the loop keeps at least one pixel for the scalar tail
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i first_pixel = _mm_set1_epi64x(0x0000000000FFFFFF);
+        const __m128i second_pixel = _mm_set1_epi64x(0x0000FFFFFF000000);
+        for (; i + 16 < count; i += 16)
+        {
+            const __m128i c0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes + i));
+            const __m128i c1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes + plane_stride + i));
+            const __m128i c2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes + 2 * plane_stride + i));
+            const __m128i lo01 = _mm_unpacklo_epi8(c0, c1);
+            const __m128i hi01 = _mm_unpackhi_epi8(c0, c1);
+            const __m128i lo2 = _mm_unpacklo_epi8(c2, zero);
+            const __m128i hi2 = _mm_unpackhi_epi8(c2, zero);
+            const __m128i pixels[4] = {_mm_unpacklo_epi16(lo01, lo2), _mm_unpackhi_epi16(lo01, lo2), _mm_unpacklo_epi16(hi01, hi2), _mm_unpackhi_epi16(hi01, hi2)};
+            std::uint8_t* out = image + i * 3;
+            for (const __m128i& quad : pixels)
+            {
+                const __m128i pairs = _mm_or_si128(_mm_and_si128(quad, first_pixel), _mm_and_si128(_mm_srli_epi64(quad, 8), second_pixel));
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(out), pairs);
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(out + 6), _mm_unpackhi_epi64(pairs, pairs));
+                out += 12;
+            }
+        }
+    }
+#endif
+#elif defined(TC_IMG_NEON)
+    if constexpr (Channels == 3)
+    {
+        for (; i + 16 <= count; i += 16)
+            vst3q_u8(image + i * 3, uint8x16x3_t{{vld1q_u8(planes + i), vld1q_u8(planes + plane_stride + i), vld1q_u8(planes + 2 * plane_stride + i)}});
+    }
+    if constexpr (Channels == 4)
+    {
+        for (; i + 16 <= count; i += 16)
+            vst4q_u8(image + i * 4, uint8x16x4_t{{vld1q_u8(planes + i), vld1q_u8(planes + plane_stride + i), vld1q_u8(planes + 2 * plane_stride + i), vld1q_u8(planes + 3 * plane_stride + i)}});
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        for (int k = 0; k < channels; ++k)
+            image[i * channels + k] = planes[k * plane_stride + i];
+    }
+}
+}
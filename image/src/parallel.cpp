@@ -0,0 +1,67 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "parallel.hpp"
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace tc::img::detail
+{
+void parallel_for(int count, const std::function<void(int begin, int end)>& task, int min_chunk_size)
+{
+    if (count <= 0)
+        return;
+
+    const int max_threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    const int chunks = std::clamp(count / std::max(min_chunk_size, 1), 1, max_threads);
+    if (chunks == 1)
+    {
+        task(0, count);
+        return;
+    }
+
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    const auto run_chunk = [&](int chunk) {
+        const int begin = static_cast<int>(static_cast<long long>(count) * chunk / chunks);
+        const int end = static_cast<int>(static_cast<long long>(count) * (chunk + 1) / chunks);
+        try
+        {
+            task(begin, end);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(error_mutex);
+            if (!error)
+                error = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(chunks - 1);
+    for (int chunk = 1; chunk < chunks; ++chunk)
+        workers.emplace_back(run_chunk, chunk);
+
+    run_chunk(0);
+    for (auto& worker : workers)
+        worker.join();
+
+    if (error)
+        std::rethrow_exception(error);
+}
+
+}
@@ -0,0 +1,31 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <functional>
+
+namespace tc::img::detail
+{
+/*!
+ * \brief Split the range [0, count) in contiguous chunks and run task(begin, end) on each of them concurrently.
+ * \param count Number of work items
+ * \param task Callable processing the work items in [begin, end)
+ * \param min_chunk_size Minimum number of work items assigned to a single thread, defaults to 1
+ *
+ * The calling thread processes the first chunk, the others run on short-lived worker threads.
+ * Work is executed inline when only one chunk is needed. The first exception thrown by a task is rethrown to the caller.
+ */
+void parallel_for(int count, const std::function<void(int begin, int end)>& task, int min_chunk_size = 1);
+}
@@ -0,0 +1,144 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "resize_plan.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace tc::img::detail
+{
+namespace
+{
+/*!
+ * \brief Fill the sampling tables mapping content pixel i to source pixel floor((i + offset) * scale).
+ */
+void make_sampling_tables(resize_plan& plan, const resize_plan_key& key, double scale_x, double scale_y, int offset_x, int offset_y)
+{
+    plan.src_x_offsets.resize(std::max(plan.content_width, 0));
+    for (int x = 0; x < plan.content_width; ++x)
+        plan.src_x_offsets[x] = std::min(static_cast<int>((x + offset_x) * scale_x), key.image_width - 1) * key.image_channels;
+
+    plan.src_rows.resize(std::max(plan.content_height, 0));
+    for (int y = 0; y < plan.content_height; ++y)
+        plan.src_rows[y] = std::min(static_cast<int>((y + offset_y) * scale_y), key.image_height - 1);
+}
+
+resize_plan make_letterbox_plan(const resize_plan_key& key)
+{
+    resize_plan plan;
+
+    // Calculate the aspect ratios
+    double aspect_ratio_image = static_cast<double>(key.image_width) / key.image_height;
+    double aspect_ratio_target = static_cast<double>(key.target_width) / key.target_height;
+
+    // Determine the scaling factors and new dimensions
+    if (aspect_ratio_image > aspect_ratio_target)
+    {
+        plan.content_width = key.target_width;
+        plan.content_height = static_cast<int>(key.target_width / aspect_ratio_image);
+    }
+    else
+    {
+        plan.content_height = key.target_height;
+        plan.content_width = static_cast<int>(key.target_height * aspect_ratio_image);
+    }
+
+    // Calculate padding
+    plan.content_x = (key.target_width - plan.content_width) / 2;
+    plan.content_y = (key.target_height - plan.content_height) / 2;
+
+    // Scale factors
+    double scale_x = static_cast<double>(key.image_width) / plan.content_width;
+    double scale_y = static_cast<double>(key.image_height) / plan.content_height;
+
+    make_sampling_tables(plan, key, scale_x, scale_y, 0, 0);
+    return plan;
+}
+
+resize_plan make_stretch_plan(const resize_plan_key& key)
+{
+    resize_plan plan;
+    plan.content_width = key.target_width;
+    plan.content_height = key.target_height;
+
+    double scale_x = static_cast<double>(key.image_width) / key.target_width;
+    double scale_y = static_cast<double>(key.image_height) / key.target_height;
+
+    make_sampling_tables(plan, key, scale_x, scale_y, 0, 0);
+    return plan;
+}
+
+resize_plan make_center_crop_plan(const resize_plan_key& key)
+{
+    resize_plan plan;
+
+    // Size of the virtual image whose shorter side equals resize_size
+    const double scale = static_cast<double>(key.resize_size) / std::min(key.image_width, key.image_height);
+    const int resized_width = std::max(1, static_cast<int>(std::lround(key.image_width * scale)));
+    const int resized_height = std::max(1, static_cast<int>(std::lround(key.image_height * scale)));
+
+    // Top-left corner of the centered crop window in the virtual resized image
+    const int crop_x = (resized_width - key.target_width) / 2;
+    const int crop_y = (resized_height - key.target_height) / 2;
+
+    // Only the part of the crop window overlapping the resized image is content, the rest is padding
+    plan.content_x = std::max(0, -crop_x);
+    plan.content_y = std::max(0, -crop_y);
+    plan.content_width = std::min(key.target_width, resized_width - crop_x) - plan.content_x;
+    plan.content_height = std::min(key.target_height, resized_height - crop_y) - plan.content_y;
+
+    double scale_x = static_cast<double>(key.image_width) / resized_width;
+    double scale_y = static_cast<double>(key.image_height) / resized_height;
+
+    make_sampling_tables(plan, key, scale_x, scale_y, crop_x + plan.content_x, crop_y + plan.content_y);
+    return plan;
+}
+
+}
+
+std::shared_ptr<const resize_plan> get_resize_plan(const resize_plan_key& key)
+{
+    constexpr std::size_t cache_capacity = 8;
+    thread_local std::vector<std::pair<resize_plan_key, std::shared_ptr<const resize_plan>>> cache;
+
+    auto it = std::find_if(cache.begin(), cache.end(), [&](const auto& entry) { return entry.first == key; });
+    if (it != cache.end())
+    {
+        // Move the hit to the front, so that the least recently used plan is the one evicted
+        std::rotate(cache.begin(), it, it + 1);
+        return cache.front().second;
+    }
+
+    std::shared_ptr<const resize_plan> plan;
+    switch (key.mode)
+    {
+    case resize_mode::letterbox:
+        plan = std::make_shared<const resize_plan>(make_letterbox_plan(key));
+        break;
+    case resize_mode::stretch:
+        plan = std::make_shared<const resize_plan>(make_stretch_plan(key));
+        break;
+    case resize_mode::center_crop:
+        plan = std::make_shared<const resize_plan>(make_center_crop_plan(key));
+        break;
+    }
+
+    if (cache.size() == cache_capacity)
+        cache.pop_back();
+    cache.insert(cache.begin(), {key, plan});
+    return plan;
+}
+
+}
@@ -0,0 +1,70 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+namespace tc::img::detail
+{
+/*!
+ * \brief Sampling strategy used to build a resize_plan.
+ */
+enum class resize_mode
+{
+    letterbox,
+    stretch,
+    center_crop
+};
+
+/*!
+ * \brief Inputs that fully determine a resize_plan, used as cache key.
+ */
+struct resize_plan_key
+{
+    resize_mode mode;
+    int image_width;
+    int image_height;
+    int image_channels;
+    int target_width;
+    int target_height;
+    int resize_size; // Shorter side size for resize_mode::center_crop, unused otherwise
+
+    bool operator==(const resize_plan_key& other) const = default;
+};
+
+/*!
+ * \brief Geometry of a resize: the output region covered by image content and the source sampling tables.
+ *
+ * Output pixels outside the content region are padding. Only the content region is ever sampled.
+ */
+struct resize_plan
+{
+    int content_x = 0;
+    int content_y = 0;
+    int content_width = 0;
+    int content_height = 0;
+    std::vector<int> src_x_offsets; // Byte offset of the source pixel sampled by each content column
+    std::vector<int> src_rows;      // Source row sampled by each content row
+};
+
+/*!
+ * \brief Get the plan for the given key from a small per-thread cache, building it on a miss.
+ *
+ * Repeated resizes of frames with the same geometry reuse the sampling tables instead of recomputing them.
+ */
+std::shared_ptr<const resize_plan> get_resize_plan(const resize_plan_key& key);
+
+}
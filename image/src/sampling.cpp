@@ -0,0 +1,247 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sampling.hpp"
+#include "border.hpp"
+#include "simd.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace tc::img::detail
+{
+namespace
+{
+/*!
+ * \brief Pointer to the pixel at (x, y), or to the border value when the pixel is outside a constant border.
+ */
+inline const std::uint8_t* border_pixel(const sampling_source& src, int x, int y)
+{
+    // An empty source has no pixel to extrapolate from, whatever the border mode
+    if (src.width <= 0 || src.height <= 0)
+        return src.border_value;
+
+    const int bx = border_interpolate(x, src.width, src.border);
+    const int by = border_interpolate(y, src.height, src.border);
+    if (bx < 0 || by < 0)
+        return src.border_value;
+
+    return src.data + (static_cast<std::size_t>(by) * src.width + bx) * src.channels;
+}
+
+template <int Channels>
+void sample_nearest_impl(const sampling_source& src, const int* xs, const int* ys, int count, std::uint8_t* dst)
+{
+    const int channels = Channels > 0 ? Channels : src.channels;
+    for (int i = 0; i < count; ++i, dst += channels)
+    {
+        const int x = xs[i];
+        const int y = ys[i];
+        const std::uint8_t* p = (static_cast<unsigned>(x) < static_cast<unsigned>(src.width) && static_cast<unsigned>(y) < static_cast<unsigned>(src.height))
+                                    ? src.data + (static_cast<std::size_t>(y) * src.width + x) * channels
+                                    : border_pixel(src, x, y);
+        for (int c = 0; c < channels; ++c)
+            dst[c] = p[c];
+    }
+}
+
+#if defined(TC_IMG_SSE2) || defined(TC_IMG_NEON)
+/*!
+ * \brief Bilinear interpolation of one 3 or 4 channel pixel whose 2x2 neighbourhood starts at p00.
+ *
+ * Reads 8 bytes from each of the two source rows, so with 3 channels the caller must guarantee that
+ * two more bytes follow the right neighbour. Results are bit-exact with the scalar path.
+ */
+template <int Channels>
+inline void bilinear_pixel_simd(const std::uint8_t* p00, std::size_t stride, int fx, int fy, std::uint8_t* dst)
+{
+    static_assert(Channels == 3 || Channels == 4);
+    constexpr int rounding = 1 << (2 * sampling_weight_bits - 1);
+    std::uint32_t packed;
+
+#if defined(TC_IMG_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i wx = _mm_set1_epi32((fx << 16) | (sampling_weight_one - fx));
+    const __m128i row0 = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p00)), zero);
+    const __m128i row1 = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p00 + stride)), zero);
+
+    // Pair each channel with its right neighbour, so that one madd gives the horizontal interpolation
+    const __m128i top = _mm_madd_epi16(_mm_unpacklo_epi16(row0, _mm_srli_si128(row0, 2 * Channels)), wx);
+    const __m128i bottom = _mm_madd_epi16(_mm_unpacklo_epi16(row1, _mm_srli_si128(row1, 2 * Channels)), wx);
+
+    // Both products and their sum stay below 2^24, so the vertical pass is exact in single precision
+    const __m128 sum = _mm_add_ps(
+        _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(top), _mm_set1_ps(static_cast<float>(sampling_weight_one - fy))), _mm_mul_ps(_mm_cvtepi32_ps(bottom), _mm_set1_ps(static_cast<float>(fy)))),
+        _mm_set1_ps(static_cast<float>(rounding)));
+    const __m128i result = _mm_srli_epi32(_mm_cvttps_epi32(sum), 2 * sampling_weight_bits);
+    const __m128i narrow = _mm_packs_epi32(result, result);
+    packed = static_cast<std::uint32_t>(_mm_cvtsi128_si32(_mm_packus_epi16(narrow, narrow)));
+#else
+    const uint16x8_t row0 = vmovl_u8(vld1_u8(p00));
+    const uint16x8_t row1 = vmovl_u8(vld1_u8(p00 + stride));
+    const uint32x4_t top = vmlal_n_u16(vmull_n_u16(vget_low_u16(row0), static_cast<std::uint16_t>(sampling_weight_one - fx)), vget_low_u16(vextq_u16(row0, row0, Channels)), static_cast<std::uint16_t>(fx));
+    const uint32x4_t bottom = vmlal_n_u16(vmull_n_u16(vget_low_u16(row1), static_cast<std::uint16_t>(sampling_weight_one - fx)), vget_low_u16(vextq_u16(row1, row1, Channels)), static_cast<std::uint16_t>(fx));
+    const uint32x4_t sum = vmlaq_n_u32(vmlaq_n_u32(vdupq_n_u32(rounding), top, static_cast<std::uint32_t>(sampling_weight_one - fy)), bottom, static_cast<std::uint32_t>(fy));
+    const uint16x4_t narrow = vshrn_n_u32(sum, 2 * sampling_weight_bits);
+    packed = vget_lane_u32(vreinterpret_u32_u8(vmovn_u16(vcombine_u16(narrow, narrow))), 0);
+#endif
+
+    std::memcpy(dst, &packed, Channels);
+}
+#endif
+
+template <int Channels>
+void sample_bilinear_impl(const sampling_source& src, const int* xs, const int* ys, const std::uint16_t* wx, const std::uint16_t* wy, int count, std::uint8_t* dst)
+{
+    const int channels = Channels > 0 ? Channels : src.channels;
+    const std::size_t stride = static_cast<std::size_t>(src.width) * channels;
+    constexpr int shift = 2 * sampling_weight_bits;
+    constexpr int rounding = 1 << (shift - 1);
+
+    // Upper bounds of the fast path, which needs the right and bottom neighbours: none for sources narrower or shorter than 2 pixels
+    const unsigned x_limit = static_cast<unsigned>(std::max(src.width - 1, 0));
+    const unsigned y_limit = static_cast<unsigned>(std::max(src.height - 1, 0));
+
+    for (int i = 0; i < count; ++i, dst += channels)
+    {
+        const int x = xs[i];
+        const int y = ys[i];
+        const std::uint8_t* p00;
+        const std::uint8_t* p01;
+        const std::uint8_t* p10;
+        const std::uint8_t* p11;
+        if (static_cast<unsigned>(x) < x_limit && static_cast<unsigned>(y) < y_limit)
+        {
+            // Fast path: the 2x2 neighbourhood is fully inside the image
+            p00 = src.data + y * stride + x * channels;
+#if defined(TC_IMG_SSE2) || defined(TC_IMG_NEON)
+            if constexpr (Channels == 3 || Channels == 4)
+            {
+                // With 3 channels the 8-byte loads need one more pixel to the right
+                if (Channels == 4 || x + 2 < src.width)
+                {
+                    bilinear_pixel_simd<Channels>(p00, stride, wx[i], wy[i], dst);
+                    continue;
+                }
+            }
+#endif
+            p01 = p00 + channels;
+            p10 = p00 + stride;
+            p11 = p10 + channels;
+        }
+        else
+        {
+            p00 = border_pixel(src, x, y);
+            p01 = border_pixel(src, x + 1, y);
+            p10 = border_pixel(src, x, y + 1);
+            p11 = border_pixel(src, x + 1, y + 1);
+        }
+
+        const int fx = wx[i];
+        const int fy = wy[i];
+        for (int c = 0; c < channels; ++c)
+        {
+            const int top = (p00[c] << sampling_weight_bits) + (p01[c] - p00[c]) * fx;
+            const int bottom = (p10[c] << sampling_weight_bits) + (p11[c] - p10[c]) * fx;
+            dst[c] = static_cast<std::uint8_t>(((top << sampling_weight_bits) + (bottom - top) * fy + rounding) >> shift);
+        }
+    }
+}
+
+}
+
+std::vector<std::uint8_t> expand_border_value(const std::vector<std::uint8_t>& border_value, int channels)
+{
+    if (border_value.size() == static_cast<std::size_t>(channels))
+        return border_value;
+
+    if (border_value.size() != 1)
+    {
+        throw std::runtime_error("Invalid border value: expected 1 or " + std::to_string(channels) + " components, got " + std::to_string(border_value.size()));
+    }
+
+    return std::vector<std::uint8_t>(channels, border_value[0]);
+}
+
+void split_coordinate(double coord, bool round_to_nearest, int& index, std::uint16_t& weight)
+{
+    if (round_to_nearest)
+    {
+        index = static_cast<int>(std::clamp(std::floor(coord + 0.5), -1e9, 1e9));
+        weight = 0;
+        return;
+    }
+
+    // Round to the weight grid first, so that coordinates computed as 2.9999999 sample pixel 3 exactly
+    const double scaled = std::round(std::clamp(coord, -1e9, 1e9) * sampling_weight_one);
+    const double floor_coord = std::floor(scaled / sampling_weight_one);
+    index = static_cast<int>(floor_coord);
+    weight = static_cast<std::uint16_t>(scaled - floor_coord * sampling_weight_one);
+}
+
+void store_remap_coordinate(double sx, double sy, bool round_to_nearest, std::int16_t* coord, std::uint16_t* weight)
+{
+    constexpr double coord_min = std::numeric_limits<std::int16_t>::min();
+    constexpr double coord_max = std::numeric_limits<std::int16_t>::max() - 1;
+    if (!std::isfinite(sx) || !std::isfinite(sy))
+    {
+        // Points mapped to infinity are far outside the source image
+        coord[0] = coord[1] = static_cast<std::int16_t>(coord_min);
+        *weight = 0;
+        return;
+    }
+
+    int ix, iy;
+    std::uint16_t wx, wy;
+    split_coordinate(std::clamp(sx, coord_min, coord_max), round_to_nearest, ix, wx);
+    split_coordinate(std::clamp(sy, coord_min, coord_max), round_to_nearest, iy, wy);
+    coord[0] = static_cast<std::int16_t>(std::min(ix, static_cast<int>(coord_max)));
+    coord[1] = static_cast<std::int16_t>(std::min(iy, static_cast<int>(coord_max)));
+    *weight = round_to_nearest ? 0 : static_cast<std::uint16_t>((wy << sampling_weight_bits) | wx);
+}
+
+void sample_nearest(const sampling_source& src, const int* xs, const int* ys, int count, std::uint8_t* dst)
+{
+    switch (src.channels)
+    {
+    case 1:
+        return sample_nearest_impl<1>(src, xs, ys, count, dst);
+    case 3:
+        return sample_nearest_impl<3>(src, xs, ys, count, dst);
+    case 4:
+        return sample_nearest_impl<4>(src, xs, ys, count, dst);
+    default:
+        return sample_nearest_impl<0>(src, xs, ys, count, dst);
+    }
+}
+
+void sample_bilinear(const sampling_source& src, const int* xs, const int* ys, const std::uint16_t* wx, const std::uint16_t* wy, int count, std::uint8_t* dst)
+{
+    switch (src.channels)
+    {
+    case 1:
+        return sample_bilinear_impl<1>(src, xs, ys, wx, wy, count, dst);
+    case 3:
+        return sample_bilinear_impl<3>(src, xs, ys, wx, wy, count, dst);
+    case 4:
+        return sample_bilinear_impl<4>(src, xs, ys, wx, wy, count, dst);
+    default:
+        return sample_bilinear_impl<0>(src, xs, ys, wx, wy, count, dst);
+    }
+}
+
+}
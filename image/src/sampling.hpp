@@ -0,0 +1,90 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <teiacare/image/image_border.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace tc::img::detail
+{
+constexpr int sampling_weight_bits = 8;
+constexpr int sampling_weight_one = 1 << sampling_weight_bits;
+
+/*!
+ * \brief Interleaved uint8 image read by the sampling kernels, together with its border handling.
+ *
+ * An empty source (width or height of 0) samples as the border value everywhere, for every border mode.
+ */
+struct sampling_source
+{
+    const std::uint8_t* data;
+    int width;
+    int height;
+    int channels;
+    border_mode border;
+    const std::uint8_t* border_value; // One value per channel, used with border_mode::constant
+};
+
+/*!
+ * \brief Expand a border value given as 1 or channels components to one value per channel.
+ * \throws std::runtime_error if border_value has neither 1 nor channels components
+ */
+std::vector<std::uint8_t> expand_border_value(const std::vector<std::uint8_t>& border_value, int channels);
+
+/*!
+ * \brief Split a source coordinate in integer part and 8-bit weight.
+ * \param coord Source coordinate
+ * \param round_to_nearest Round to the nearest pixel and ignore the weight, for nearest neighbour interpolation
+ * \param index Integer part of the coordinate
+ * \param weight Fractional part of the coordinate, in [0, sampling_weight_one)
+ */
+void split_coordinate(double coord, bool round_to_nearest, int& index, std::uint16_t& weight);
+
+/*!
+ * \brief Store one source coordinate as an entry of remap_plan maps, clamping it to the int16 range.
+ * \param sx Source x coordinate
+ * \param sy Source y coordinate
+ * \param round_to_nearest Round to the nearest pixel and store a zero weight, for nearest neighbour interpolation
+ * \param coord Output x, y integer coordinates; non-finite coordinates are stored far outside the image
+ * \param weight Output weights, packed as (wy << sampling_weight_bits) | wx
+ */
+void store_remap_coordinate(double sx, double sy, bool round_to_nearest, std::int16_t* coord, std::uint16_t* weight);
+
+/*!
+ * \brief Sample count pixels with nearest neighbour interpolation.
+ * \param src Source image
+ * \param xs Integer x coordinates of the samples
+ * \param ys Integer y coordinates of the samples
+ * \param count Number of samples
+ * \param dst Output interleaved pixels
+ */
+void sample_nearest(const sampling_source& src, const int* xs, const int* ys, int count, std::uint8_t* dst);
+
+/*!
+ * \brief Sample count pixels with bilinear interpolation.
+ * \param src Source image
+ * \param xs Integer part of the x coordinates of the samples
+ * \param ys Integer part of the y coordinates of the samples
+ * \param wx Fractional part of the x coordinates, in [0, sampling_weight_one)
+ * \param wy Fractional part of the y coordinates, in [0, sampling_weight_one)
+ * \param count Number of samples
+ * \param dst Output interleaved pixels
+ */
+void sample_bilinear(const sampling_source& src, const int* xs, const int* ys, const std::uint16_t* wx, const std::uint16_t* wy, int count, std::uint8_t* dst);
+
+}
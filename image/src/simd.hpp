@@ -0,0 +1,57 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+/*!
+ * \file simd.hpp
+ * \brief Private header selecting the SIMD instruction sets available at compile time.
+ *
+ * Kernels test the TC_IMG_* macros defined here and always keep a scalar path for the remaining elements
+ * (and for targets where none of the instruction sets is available).
+ */
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TC_IMG_SSE2 1
+#include <emmintrin.h>
+#endif
+
+// Byte shuffles, implied by AVX on MSVC which does not define __SSSE3__
+#if defined(__SSSE3__) || (defined(_MSC_VER) && defined(__AVX__))
+#define TC_IMG_SSSE3 1
+#include <tmmintrin.h>
+#endif
+
+// Only enabled when the compiler targets the host CPU (see TC_ENABLE_NATIVE_ARCH) or an equivalent -mavx2 -mfma setting,
+// MSVC does not define __FMA__ and implies it with /arch:AVX2
+#if (defined(__AVX2__) && defined(__FMA__)) || (defined(_MSC_VER) && defined(__AVX2__))
+#define TC_IMG_AVX2 1
+#include <immintrin.h>
+#endif
+
+// Half precision conversions, implied by AVX2 on MSVC which does not define __F16C__
+#if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+#define TC_IMG_F16C 1
+#include <immintrin.h>
+#endif
+
+#if defined(__AVX512BF16__) && defined(__AVX512VL__)
+#define TC_IMG_AVX512BF16 1
+#include <immintrin.h>
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#define TC_IMG_NEON 1
+#include <arm_neon.h>
+#endif
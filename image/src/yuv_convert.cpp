@@ -0,0 +1,172 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "yuv_convert.hpp"
+
+#include "simd.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace tc::img::detail
+{
+namespace
+{
+constexpr int yuv_round = 1 << (yuv_coefficient_bits - 1);
+
+/*!
+ * \brief Scale a fixed point sum back to a pixel value, saturating to [0, 255].
+ */
+inline std::uint8_t yuv_saturate(int value)
+{
+    return static_cast<std::uint8_t>(std::clamp((value + yuv_round) >> yuv_coefficient_bits, 0, 255));
+}
+
+#if defined(TC_IMG_AVX2) || defined(TC_IMG_SSE2)
+/*!
+ * \brief 32-bit lane holding lo in its low 16 bits and hi in its high 16 bits, for multiply-add with (a, b) pairs.
+ */
+inline int coefficient_pair(int lo, int hi)
+{
+    return static_cast<int>((static_cast<std::uint32_t>(hi) << 16) | static_cast<std::uint16_t>(lo));
+}
+#endif
+}
+
+yuv_coefficients make_yuv_coefficients(yuv_matrix matrix, yuv_range range)
+{
+    const double kr = matrix == yuv_matrix::bt709 ? 0.2126 : 0.299;
+    const double kb = matrix == yuv_matrix::bt709 ? 0.0722 : 0.114;
+    const double kg = 1.0 - kr - kb;
+
+    // Limited range values are stretched from [16, 235] for luma and from [16, 240] for chroma
+    const bool limited = range == yuv_range::limited;
+    const double y_scale = limited ? 255.0 / 219.0 : 1.0;
+    const double c_scale = limited ? 255.0 / 224.0 : 1.0;
+    const auto fixed = [](double value) { return static_cast<std::int16_t>(std::lround(value * (1 << yuv_coefficient_bits))); };
+    return yuv_coefficients{
+        static_cast<std::int16_t>(limited ? 16 : 0),
+        fixed(y_scale),
+        fixed(2.0 * (1.0 - kr) * c_scale),
+        fixed(-2.0 * kb * (1.0 - kb) / kg * c_scale),
+        fixed(-2.0 * kr * (1.0 - kr) / kg * c_scale),
+        fixed(2.0 * (1.0 - kb) * c_scale)};
+}
+
+std::size_t yuv420_size(int width, int height)
+{
+    const std::size_t w = static_cast<std::size_t>(std::max(width, 0));
+    const std::size_t h = static_cast<std::size_t>(std::max(height, 0));
+    return w * h + 2 * ((w + 1) / 2) * ((h + 1) / 2);
+}
+
+void convert_yuv_row(const std::uint8_t* y, const std::uint8_t* u, const std::uint8_t* v, std::size_t count, const yuv_coefficients& coefficients, std::uint8_t* r, std::uint8_t* g, std::uint8_t* b)
+{
+    const yuv_coefficients c = coefficients;
+    std::size_t i = 0;
+#if defined(TC_IMG_AVX2)
+    // Each luma value is paired with one chroma value (or with 1 for the rounding term) so that one multiply-add computes two products
+    const __m256i y_offset = _mm256_set1_epi16(c.y_offset);
+    const __m256i chroma_offset = _mm256_set1_epi16(128);
+    const __m256i ones = _mm256_set1_epi16(1);
+    const __m256i round = _mm256_set1_epi32(yuv_round);
+    const __m256i r_coefficients = _mm256_set1_epi32(coefficient_pair(c.y_scale, c.rv));
+    const __m256i g_coefficients = _mm256_set1_epi32(coefficient_pair(c.y_scale, c.gu));
+    const __m256i gv_coefficients = _mm256_set1_epi32(coefficient_pair(c.gv, yuv_round));
+    const __m256i b_coefficients = _mm256_set1_epi32(coefficient_pair(c.y_scale, c.bu));
+    const auto store = [](std::uint8_t* dst, __m256i lo, __m256i hi) {
+        // The in-lane pack restores the pixel order that the in-lane unpacks split
+        const __m256i values = _mm256_packs_epi32(_mm256_srai_epi32(lo, yuv_coefficient_bits), _mm256_srai_epi32(hi, yuv_coefficient_bits));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(_mm256_castsi256_si128(values), _mm256_extracti128_si256(values, 1)));
+    };
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m256i luma = _mm256_sub_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(y + i))), y_offset);
+        const __m256i cu = _mm256_sub_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(u + i))), chroma_offset);
+        const __m256i cv = _mm256_sub_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(v + i))), chroma_offset);
+        const __m256i yu_lo = _mm256_unpacklo_epi16(luma, cu);
+        const __m256i yu_hi = _mm256_unpackhi_epi16(luma, cu);
+        const __m256i yv_lo = _mm256_unpacklo_epi16(luma, cv);
+        const __m256i yv_hi = _mm256_unpackhi_epi16(luma, cv);
+        const __m256i v1_lo = _mm256_unpacklo_epi16(cv, ones);
+        const __m256i v1_hi = _mm256_unpackhi_epi16(cv, ones);
+        store(r + i, _mm256_add_epi32(_mm256_madd_epi16(yv_lo, r_coefficients), round), _mm256_add_epi32(_mm256_madd_epi16(yv_hi, r_coefficients), round));
+        store(g + i, _mm256_add_epi32(_mm256_madd_epi16(yu_lo, g_coefficients), _mm256_madd_epi16(v1_lo, gv_coefficients)), _mm256_add_epi32(_mm256_madd_epi16(yu_hi, g_coefficients), _mm256_madd_epi16(v1_hi, gv_coefficients)));
+        store(b + i, _mm256_add_epi32(_mm256_madd_epi16(yu_lo, b_coefficients), round), _mm256_add_epi32(_mm256_madd_epi16(yu_hi, b_coefficients), round));
+    }
+#elif defined(TC_IMG_SSE2)
+    // Each luma value is paired with one chroma value (or with 1 for the rounding term) so that one multiply-add computes two products
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i y_offset = _mm_set1_epi16(c.y_offset);
+    const __m128i chroma_offset = _mm_set1_epi16(128);
+    const __m128i ones = _mm_set1_epi16(1);
+    const __m128i round = _mm_set1_epi32(yuv_round);
+    const __m128i r_coefficients = _mm_set1_epi32(coefficient_pair(c.y_scale, c.rv));
+    const __m128i g_coefficients = _mm_set1_epi32(coefficient_pair(c.y_scale, c.gu));
+    const __m128i gv_coefficients = _mm_set1_epi32(coefficient_pair(c.gv, yuv_round));
+    const __m128i b_coefficients = _mm_set1_epi32(coefficient_pair(c.y_scale, c.bu));
+    const auto channel = [](__m128i lo, __m128i hi) { return _mm_packs_epi32(_mm_srai_epi32(lo, yuv_coefficient_bits), _mm_srai_epi32(hi, yuv_coefficient_bits)); };
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i y_bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(y + i));
+        const __m128i u_bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(u + i));
+        const __m128i v_bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(v + i));
+        __m128i rgb[3][2];
+        for (int half = 0; half < 2; ++half)
+        {
+            const __m128i luma = _mm_sub_epi16(half == 0 ? _mm_unpacklo_epi8(y_bytes, zero) : _mm_unpackhi_epi8(y_bytes, zero), y_offset);
+            const __m128i cu = _mm_sub_epi16(half == 0 ? _mm_unpacklo_epi8(u_bytes, zero) : _mm_unpackhi_epi8(u_bytes, zero), chroma_offset);
+            const __m128i cv = _mm_sub_epi16(half == 0 ? _mm_unpacklo_epi8(v_bytes, zero) : _mm_unpackhi_epi8(v_bytes, zero), chroma_offset);
+            const __m128i yu_lo = _mm_unpacklo_epi16(luma, cu);
+            const __m128i yu_hi = _mm_unpackhi_epi16(luma, cu);
+            const __m128i yv_lo = _mm_unpacklo_epi16(luma, cv);
+            const __m128i yv_hi = _mm_unpackhi_epi16(luma, cv);
+            const __m128i v1_lo = _mm_unpacklo_epi16(cv, ones);
+            const __m128i v1_hi = _mm_unpackhi_epi16(cv, ones);
+            rgb[0][half] = channel(_mm_add_epi32(_mm_madd_epi16(yv_lo, r_coefficients), round), _mm_add_epi32(_mm_madd_epi16(yv_hi, r_coefficients), round));
+            rgb[1][half] = channel(_mm_add_epi32(_mm_madd_epi16(yu_lo, g_coefficients), _mm_madd_epi16(v1_lo, gv_coefficients)), _mm_add_epi32(_mm_madd_epi16(yu_hi, g_coefficients), _mm_madd_epi16(v1_hi, gv_coefficients)));
+            rgb[2][half] = channel(_mm_add_epi32(_mm_madd_epi16(yu_lo, b_coefficients), round), _mm_add_epi32(_mm_madd_epi16(yu_hi, b_coefficients), round));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(r + i), _mm_packus_epi16(rgb[0][0], rgb[0][1]));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(g + i), _mm_packus_epi16(rgb[1][0], rgb[1][1]));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(b + i), _mm_packus_epi16(rgb[2][0], rgb[2][1]));
+    }
+#elif defined(TC_IMG_NEON)
+    const int16x8_t y_offset = vdupq_n_s16(c.y_offset);
+    const int16x8_t chroma_offset = vdupq_n_s16(128);
+    const auto channel = [](int32x4_t lo, int32x4_t hi) { return vqmovun_s16(vcombine_s16(vqrshrn_n_s32(lo, yuv_coefficient_bits), vqrshrn_n_s32(hi, yuv_coefficient_bits))); };
+    for (; i + 8 <= count; i += 8)
+    {
+        const int16x8_t luma = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vld1_u8(y + i))), y_offset);
+        const int16x8_t cu = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vld1_u8(u + i))), chroma_offset);
+        const int16x8_t cv = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vld1_u8(v + i))), chroma_offset);
+        const int32x4_t y_lo = vmull_n_s16(vget_low_s16(luma), c.y_scale);
+        const int32x4_t y_hi = vmull_n_s16(vget_high_s16(luma), c.y_scale);
+        vst1_u8(r + i, channel(vmlal_n_s16(y_lo, vget_low_s16(cv), c.rv), vmlal_n_s16(y_hi, vget_high_s16(cv), c.rv)));
+        vst1_u8(g + i, channel(vmlal_n_s16(vmlal_n_s16(y_lo, vget_low_s16(cu), c.gu), vget_low_s16(cv), c.gv), vmlal_n_s16(vmlal_n_s16(y_hi, vget_high_s16(cu), c.gu), vget_high_s16(cv), c.gv)));
+        vst1_u8(b + i, channel(vmlal_n_s16(y_lo, vget_low_s16(cu), c.bu), vmlal_n_s16(y_hi, vget_high_s16(cu), c.bu)));
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        const int luma = c.y_scale * (y[i] - c.y_offset);
+        const int cu = u[i] - 128;
+        const int cv = v[i] - 128;
+        r[i] = yuv_saturate(luma + c.rv * cv);
+        g[i] = yuv_saturate(luma + c.gu * cu + c.gv * cv);
+        b[i] = yuv_saturate(luma + c.bu * cu);
+    }
+}
+
+}
@@ -0,0 +1,56 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <teiacare/image/image_yuv.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace tc::img::detail
+{
+constexpr int yuv_coefficient_bits = 13;
+
+/*!
+ * \brief YUV to RGB conversion coefficients, fixed point with yuv_coefficient_bits fractional bits.
+ *
+ * With y = Y - y_offset, u = U - 128 and v = V - 128: R = y_scale * y + rv * v, G = y_scale * y + gu * u + gv * v, B = y_scale * y + bu * u.
+ */
+struct yuv_coefficients
+{
+    std::int16_t y_offset;
+    std::int16_t y_scale;
+    std::int16_t rv;
+    std::int16_t gu;
+    std::int16_t gv;
+    std::int16_t bu;
+};
+
+/*!
+ * \brief Coefficients of the given color matrix and range.
+ */
+yuv_coefficients make_yuv_coefficients(yuv_matrix matrix, yuv_range range);
+
+/*!
+ * \brief Number of bytes of a 4:2:0 image (NV12 or I420) of the given size, odd sizes rounding the chroma planes up.
+ */
+std::size_t yuv420_size(int width, int height);
+
+/*!
+ * \brief Convert count pixels with one chroma sample per pixel to RGB planes, rounding to nearest and saturating.
+ */
+void convert_yuv_row(const std::uint8_t* y, const std::uint8_t* u, const std::uint8_t* v, std::size_t count, const yuv_coefficients& coefficients, std::uint8_t* r, std::uint8_t* g, std::uint8_t* b);
+
+}
@@ -0,0 +1,41 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <teiacare/image/image_border.hpp>
+
+namespace tc::img::tests
+{
+// Coordinate read for p with the given border mode, -1 for the constant value
+inline int border_coordinate(int p, int size, tc::img::border_mode border)
+{
+    if (p >= 0 && p < size)
+        return p;
+    switch (border)
+    {
+    case tc::img::border_mode::constant:
+        return -1;
+    case tc::img::border_mode::replicate:
+        return p < 0 ? 0 : size - 1;
+    case tc::img::border_mode::reflect:
+        while (p < 0 || p >= size)
+            p = p < 0 ? -p : 2 * (size - 1) - p;
+        return p;
+    case tc::img::border_mode::wrap:
+        return ((p % size) + size) % size;
+    }
+    return -1;
+}
+}
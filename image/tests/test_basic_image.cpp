@@ -0,0 +1,159 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <teiacare/image/basic_image.hpp>
+#include <teiacare/image/image_draw.hpp>
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace tc::img::tests
+{
+class basic_image_test : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+    }
+    void TearDown() override
+    {
+    }
+
+    // Whether an image can be resized without giving its channel count
+    template <typename Image>
+    static constexpr bool resizable_without_channels = requires(Image image) { image.resize(2, 2); };
+};
+
+// Test tc::img::basic_image with a channel count fixed at compile time
+TEST_F(basic_image_test, fixed_channels)
+{
+    static_assert(tc::img::image_rgb::static_channels == 3);
+    static_assert(tc::img::image::static_channels == tc::img::dynamic_channels);
+
+    tc::img::image_rgb rgb(4, 2, 9);
+    EXPECT_EQ(rgb.channels(), 3);
+    EXPECT_EQ(rgb.stride(), 12u);
+    EXPECT_EQ(rgb.vector(), std::vector<std::uint8_t>(24, 9));
+    EXPECT_EQ(rgb.pixel(3, 1), rgb.data() + 21);
+
+    rgb.resize(2, 2);
+    EXPECT_EQ(rgb.size(), 12u);
+    EXPECT_THROW(rgb.resize(2, 2, 4), std::runtime_error);
+
+    const tc::img::image_view view = rgb;
+    EXPECT_EQ(view.channels(), 3);
+    EXPECT_EQ(view.data(), rgb.data());
+
+    EXPECT_THROW((tc::img::image_rgb{std::vector<std::uint8_t>(16), 2, 2, 4}), std::runtime_error);
+    EXPECT_THROW((tc::img::image_rgba{tc::img::image_view{rgb}}), std::runtime_error);
+}
+
+// Test the channel count can only be omitted when it is fixed at compile time
+TEST_F(basic_image_test, channels_required_when_dynamic)
+{
+    static_assert(std::is_constructible_v<tc::img::image_rgb, std::vector<std::uint8_t>, int, int>);
+    static_assert(!std::is_constructible_v<tc::img::image, std::vector<std::uint8_t>, int, int>);
+    static_assert(std::is_constructible_v<tc::img::image, std::vector<std::uint8_t>, int, int, int>);
+    static_assert(resizable_without_channels<tc::img::image_rgb>);
+    static_assert(!resizable_without_channels<tc::img::image>);
+
+    const tc::img::image_rgb rgb(std::vector<std::uint8_t>(12, 5), 2, 2);
+    EXPECT_EQ(rgb.channels(), 3);
+    EXPECT_THROW((tc::img::image_rgb{std::vector<std::uint8_t>(16), 2, 2}), std::runtime_error);
+}
+
+// Test tc::img::basic_image conversion between runtime and compile time channel counts
+TEST_F(basic_image_test, channel_conversion)
+{
+    std::vector<std::uint8_t> pixels(5 * 3 * 4);
+    for (std::size_t i = 0; i < pixels.size(); ++i)
+        pixels[i] = static_cast<std::uint8_t>(i);
+
+    tc::img::image dynamic{pixels, 5, 3, 4};
+    tc::img::image_rgba rgba{std::move(dynamic)};
+    EXPECT_TRUE(dynamic.empty());
+    EXPECT_EQ(rgba.width(), 5);
+    EXPECT_EQ(rgba.height(), 3);
+    EXPECT_EQ(rgba.vector(), pixels);
+
+    tc::img::image back{std::move(rgba)};
+    EXPECT_EQ(back.channels(), 4);
+    EXPECT_EQ(back.vector(), pixels);
+
+    EXPECT_THROW(tc::img::image_rgb{std::move(back)}, std::runtime_error);
+    EXPECT_EQ(tc::img::image_rgb{tc::img::image{}}.channels(), 3);
+}
+
+// Test tc::img::basic_image with non 8-bit elements
+TEST_F(basic_image_test, float_elements)
+{
+    tc::img::basic_image<float, 2> flow(3, 2, 0.5f);
+    EXPECT_EQ(flow.size(), 12u);
+    flow.pixel(2, 1)[1] = 1.5f;
+    EXPECT_EQ(flow.vector()[11], 1.5f);
+    EXPECT_EQ(flow.row(1), flow.data() + 6);
+
+    tc::img::basic_image<float> planes(2, 2, 5);
+    EXPECT_EQ(planes.channels(), 5);
+    EXPECT_EQ(planes.stride(), 10u);
+}
+
+// Test tc::img::visit_channels passes the common channel counts as compile time constants
+TEST_F(basic_image_test, visit_channels)
+{
+    const auto visited = [](int channels) {
+        return tc::img::visit_channels(channels, [](auto c) {
+            return decltype(c)::value;
+        });
+    };
+    EXPECT_EQ(visited(1), 1);
+    EXPECT_EQ(visited(2), tc::img::dynamic_channels);
+    EXPECT_EQ(visited(3), 3);
+    EXPECT_EQ(visited(4), 4);
+    EXPECT_EQ(visited(5), tc::img::dynamic_channels);
+}
+
+// Test tc::img::draw_line gives the same RGB pixels for every channel count
+TEST_F(basic_image_test, draw_channel_counts)
+{
+    tc::img::image_rgb rgb(16, 12);
+    tc::img::draw_line(rgb, 1, 2, 14, 9, tc::img::color::red(), 3);
+    tc::img::draw_rectangle(rgb, 3, 1, 8, 7, tc::img::color::blue(), 2);
+
+    for (int channels : {4, 5})
+    {
+        tc::img::image other(16, 12, channels, 77);
+        tc::img::draw_line(other, 1, 2, 14, 9, tc::img::color::red(), 3);
+        tc::img::draw_rectangle(other, 3, 1, 8, 7, tc::img::color::blue(), 2);
+        for (int y = 0; y < 12; ++y)
+        {
+            for (int x = 0; x < 16; ++x)
+            {
+                const std::uint8_t* pixel = other.pixel(x, y);
+                const std::uint8_t* expected = rgb.pixel(x, y);
+                const bool drawn = expected[0] != 0 || expected[2] != 0;
+                for (int c = 0; c < 3; ++c)
+                    EXPECT_EQ(pixel[c], drawn ? expected[c] : 77) << channels << " channels at " << x << "," << y;
+                for (int c = 3; c < channels; ++c)
+                    EXPECT_EQ(pixel[c], 77);
+            }
+        }
+    }
+}
+
+}
@@ -0,0 +1,147 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <teiacare/image/image_border.hpp>
+
+#include "border_reference.hpp"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace tc::img::tests
+{
+class image_border_test : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+    }
+    void TearDown() override
+    {
+    }
+
+    static std::vector<std::uint8_t> create_image(int width, int height, int channels)
+    {
+        std::vector<std::uint8_t> image(static_cast<std::size_t>(width) * height * channels);
+        for (std::size_t i = 0; i < image.size(); ++i)
+            image[i] = static_cast<std::uint8_t>(i * 7 + 1);
+        return image;
+    }
+
+    static constexpr tc::img::border_mode modes[] = {tc::img::border_mode::constant, tc::img::border_mode::replicate, tc::img::border_mode::reflect, tc::img::border_mode::wrap};
+};
+
+// Test copy_make_border against a per-pixel reference, with borders wider than the image
+TEST_F(image_border_test, copy_make_border_matches_reference)
+{
+    const std::vector<std::uint8_t> border_value = {10, 20, 30, 40};
+    for (int channels : {1, 3, 4})
+    {
+        const int width = 5;
+        const int height = 4;
+        const auto image = create_image(width, height, channels);
+        const std::vector<std::uint8_t> value(border_value.begin(), border_value.begin() + channels);
+        for (auto border : modes)
+        {
+            const int top = 2, bottom = 9, left = 12, right = 3;
+            const auto padded = tc::img::copy_make_border(image, width, height, channels, top, bottom, left, right, border, value);
+            const int padded_width = left + width + right;
+            ASSERT_EQ(padded.size(), static_cast<std::size_t>(padded_width) * (top + height + bottom) * channels);
+
+            for (int y = 0; y < top + height + bottom; ++y)
+            {
+                for (int x = 0; x < padded_width; ++x)
+                {
+                    const int sx = border_coordinate(x - left, width, border);
+                    const int sy = border_coordinate(y - top, height, border);
+                    for (int c = 0; c < channels; ++c)
+                    {
+                        const std::uint8_t expected = (sx < 0 || sy < 0) ? value[c] : image[(sy * width + sx) * channels + c];
+                        ASSERT_EQ(padded[(y * padded_width + x) * channels + c], expected) << x << "," << y << " channels " << channels << " border " << static_cast<int>(border);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Test padding only some sides, in place and without padding
+TEST_F(image_border_test, copy_make_border_sides_and_in_place)
+{
+    auto image = create_image(6, 3, 3);
+    EXPECT_EQ(tc::img::copy_make_border(image, 6, 3, 3, 0, 0, 0, 0, tc::img::border_mode::reflect), image);
+
+    const auto expected = tc::img::copy_make_border(image, 6, 3, 3, 1, 0, 0, 2, tc::img::border_mode::wrap);
+    ASSERT_EQ(expected.size(), 8u * 4u * 3u);
+    EXPECT_EQ(expected[0], image[2 * 6 * 3]);
+
+    tc::img::copy_make_border(image, 6, 3, 3, 1, 0, 0, 2, image, tc::img::border_mode::wrap);
+    EXPECT_EQ(image, expected);
+}
+
+// Test empty images and invalid arguments
+TEST_F(image_border_test, copy_make_border_invalid_arguments)
+{
+    const auto filled = tc::img::copy_make_border({}, 0, 0, 3, 1, 1, 1, 1, tc::img::border_mode::constant, {1, 2, 3});
+    EXPECT_EQ(filled, (std::vector<std::uint8_t>{1, 2, 3, 1, 2, 3, 1, 2, 3, 1, 2, 3}));
+
+    const auto image = create_image(4, 4, 1);
+    EXPECT_THROW(tc::img::copy_make_border({}, 0, 0, 3, 1, 1, 1, 1, tc::img::border_mode::reflect), std::runtime_error);
+    EXPECT_THROW(tc::img::copy_make_border(image, 4, 4, 1, -1, 0, 0, 0), std::runtime_error);
+    EXPECT_THROW(tc::img::copy_make_border(image, 4, 4, 1, 1, 1, 1, 1, tc::img::border_mode::constant, {1, 2}), std::runtime_error);
+}
+
+// Test border_accessor reading the same pixels as the padded image
+TEST_F(image_border_test, border_accessor_matches_copy_make_border)
+{
+    const int width = 7;
+    const int height = 5;
+    const int channels = 3;
+    const int pad = 6;
+    const auto image = create_image(width, height, channels);
+    for (auto border : modes)
+    {
+        const tc::img::border_accessor accessor(image, width, height, channels, border, {99});
+        const auto padded = tc::img::copy_make_border(image, width, height, channels, pad, pad, pad, pad, border, {99});
+        const int padded_width = width + 2 * pad;
+        EXPECT_EQ(accessor.width(), width);
+        EXPECT_EQ(accessor.border(), border);
+        EXPECT_EQ(accessor.border_pixel(), (std::vector<std::uint8_t>{99, 99, 99}));
+
+        std::vector<std::uint8_t> row(static_cast<std::size_t>(padded_width) * channels);
+        for (int y = -pad; y < height + pad; ++y)
+        {
+            const std::uint8_t* expected_row = padded.data() + static_cast<std::size_t>(y + pad) * padded_width * channels;
+            for (int x = -pad; x < width + pad; ++x)
+                EXPECT_EQ(std::memcmp(accessor.pixel(x, y), expected_row + (x + pad) * channels, channels), 0) << x << "," << y;
+
+            EXPECT_EQ(std::memcmp(accessor.row(y), expected_row + pad * channels, width * channels), 0) << y;
+            accessor.copy_row(y, pad, pad, row.data());
+            EXPECT_EQ(std::memcmp(row.data(), expected_row, row.size()), 0) << y;
+        }
+    }
+}
+
+// Test that border_accessor cannot view a temporary image
+TEST_F(image_border_test, border_accessor_rejects_temporary_image)
+{
+    static_assert(std::is_constructible_v<tc::img::border_accessor, const std::vector<std::uint8_t>&, int, int, int>);
+    static_assert(!std::is_constructible_v<tc::img::border_accessor, std::vector<std::uint8_t>&&, int, int, int>);
+    static_assert(!std::is_constructible_v<tc::img::border_accessor, std::vector<std::uint8_t>, int, int, int, tc::img::border_mode>);
+}
+
+}
@@ -0,0 +1,153 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <teiacare/image/image_convert.hpp>
+
+#include <gtest/gtest.h>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace tc::img::tests
+{
+class image_convert_test : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+    }
+    void TearDown() override
+    {
+    }
+
+    static std::vector<std::uint8_t> random_pixels(std::size_t size, unsigned int seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<int> dist(0, 255);
+        std::vector<std::uint8_t> pixels(size);
+        for (auto& v : pixels)
+            v = static_cast<std::uint8_t>(dist(rng));
+        return pixels;
+    }
+
+    // Red, green, blue and alpha of pixel i, alpha being 255 for formats without it
+    static std::array<int, 4> read_pixel(const std::vector<std::uint8_t>& data, tc::img::pixel_format format, std::size_t i)
+    {
+        const std::uint8_t* p = data.data() + i * tc::img::pixel_format_channels(format);
+        switch (format)
+        {
+        case tc::img::pixel_format::gray:
+            return {p[0], p[0], p[0], 255};
+        case tc::img::pixel_format::rgb:
+            return {p[0], p[1], p[2], 255};
+        case tc::img::pixel_format::bgr:
+            return {p[2], p[1], p[0], 255};
+        case tc::img::pixel_format::rgba:
+            return {p[0], p[1], p[2], p[3]};
+        case tc::img::pixel_format::bgra:
+            return {p[2], p[1], p[0], p[3]};
+        }
+        return {};
+    }
+
+    static constexpr std::array<tc::img::pixel_format, 5> formats = {
+        tc::img::pixel_format::gray,
+        tc::img::pixel_format::rgb,
+        tc::img::pixel_format::bgr,
+        tc::img::pixel_format::rgba,
+        tc::img::pixel_format::bgra};
+};
+
+// Test the number of channels of each format
+TEST_F(image_convert_test, pixel_format_channels)
+{
+    EXPECT_EQ(tc::img::pixel_format_channels(tc::img::pixel_format::gray), 1);
+    EXPECT_EQ(tc::img::pixel_format_channels(tc::img::pixel_format::rgb), 3);
+    EXPECT_EQ(tc::img::pixel_format_channels(tc::img::pixel_format::bgr), 3);
+    EXPECT_EQ(tc::img::pixel_format_channels(tc::img::pixel_format::rgba), 4);
+    EXPECT_EQ(tc::img::pixel_format_channels(tc::img::pixel_format::bgra), 4);
+}
+
+// Test every pair of formats against a per-pixel reference, with sizes covering the SIMD blocks and the scalar tails
+TEST_F(image_convert_test, all_format_pairs)
+{
+    for (std::size_t count : {1u, 7u, 16u, 53u, 1000u})
+    {
+        for (auto src_format : formats)
+        {
+            const auto src = random_pixels(count * tc::img::pixel_format_channels(src_format), static_cast<unsigned int>(count));
+            for (auto dst_format : formats)
+            {
+                const auto dst = tc::img::convert(src, src_format, dst_format);
+                ASSERT_EQ(dst.size(), count * tc::img::pixel_format_channels(dst_format));
+
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    const auto in = read_pixel(src, src_format, i);
+                    const auto out = read_pixel(dst, dst_format, i);
+                    if (dst_format == tc::img::pixel_format::gray && src_format != tc::img::pixel_format::gray)
+                    {
+                        const int expected = (4899 * in[0] + 9617 * in[1] + 1868 * in[2] + 8192) >> 14;
+                        ASSERT_EQ(out[0], expected) << "pixel " << i << " of " << count;
+                    }
+                    else
+                    {
+                        const bool keeps_alpha = tc::img::pixel_format_channels(src_format) == 4 && tc::img::pixel_format_channels(dst_format) == 4;
+                        ASSERT_EQ(out[0], in[0]) << "pixel " << i << " of " << count;
+                        ASSERT_EQ(out[1], in[1]) << "pixel " << i << " of " << count;
+                        ASSERT_EQ(out[2], in[2]) << "pixel " << i << " of " << count;
+                        ASSERT_EQ(out[3], keeps_alpha ? in[3] : 255) << "pixel " << i << " of " << count;
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Test the luminance of pure colors
+TEST_F(image_convert_test, gray_luminance)
+{
+    const std::vector<std::uint8_t> bgr = {0, 0, 0, 255, 255, 255, 0, 0, 255, 0, 255, 0, 255, 0, 0};
+    const auto gray = tc::img::convert(bgr, tc::img::pixel_format::bgr, tc::img::pixel_format::gray);
+    EXPECT_EQ(gray, (std::vector<std::uint8_t>{0, 255, 76, 150, 29}));
+}
+
+// Test a conversion spanning several parallel blocks, and converting a vector into itself
+TEST_F(image_convert_test, large_and_in_place)
+{
+    const std::size_t count = 100003;
+    auto pixels = random_pixels(count * 3, 5);
+    const auto expected = tc::img::convert(pixels, tc::img::pixel_format::rgb, tc::img::pixel_format::bgra);
+
+    tc::img::convert(pixels, tc::img::pixel_format::rgb, pixels, tc::img::pixel_format::bgra);
+    EXPECT_EQ(pixels, expected);
+    ASSERT_EQ(pixels.size(), count * 4);
+    EXPECT_EQ(pixels[count * 4 - 1], 255);
+
+    tc::img::convert(pixels, tc::img::pixel_format::bgra, pixels, tc::img::pixel_format::bgra);
+    EXPECT_EQ(pixels, expected);
+}
+
+// Test input sizes that are not a whole number of pixels
+TEST_F(image_convert_test, invalid_size)
+{
+    std::vector<std::uint8_t> dst;
+    EXPECT_THROW(tc::img::convert(std::vector<std::uint8_t>(10), tc::img::pixel_format::rgb, dst, tc::img::pixel_format::gray), std::runtime_error);
+    EXPECT_THROW(tc::img::convert(std::vector<std::uint8_t>(6), tc::img::pixel_format::rgba, tc::img::pixel_format::bgra), std::runtime_error);
+    EXPECT_TRUE(tc::img::convert({}, tc::img::pixel_format::rgb, tc::img::pixel_format::gray).empty());
+}
+
+}
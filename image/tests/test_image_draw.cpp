@@ -15,8 +15,10 @@
 #include <teiacare/image/image_color.hpp>
 #include <teiacare/image/image_draw.hpp>
 
+#include <cmath>
 #include <cstdint>
 #include <gtest/gtest.h>
+#include <stdexcept>
 #include <vector>
 
 namespace tc::img::tests
@@ -411,4 +413,111 @@ TEST_F(image_draw_test, multiple_drawing_operations)
     EXPECT_TRUE(is_pixel_color(img, 50, 25, 35, tc::img::color::blue()));  // Pixel
 }
 
+// Test the vector overloads trust the given size: larger buffers, empty buffers and empty sizes never throw
+TEST_F(image_draw_test, vector_overloads_trust_given_size)
+{
+    // Buffer holding one more row than the drawn 10x10 image
+    auto img = create_blank_image(10, 11);
+    EXPECT_NO_THROW(tc::img::draw_rectangle(img, 10, 10, 0, 0, 10, 10, tc::img::color::red(), 1));
+    EXPECT_NO_THROW(tc::img::draw_line(img, 10, 10, 0, 5, 9, 5, tc::img::color::green(), 1));
+    EXPECT_NO_THROW(tc::img::draw_polygon(img, 10, 10, {{0, 0}, {9, 9}}, tc::img::color::blue(), 1));
+    EXPECT_NO_THROW(tc::img::set_pixel_rgb(img, 10, 10, 9, 9, tc::img::color::white()));
+    EXPECT_TRUE(is_pixel_color(img, 10, 9, 0, tc::img::color::red()));
+    EXPECT_TRUE(is_pixel_color(img, 10, 2, 5, tc::img::color::green()));
+    EXPECT_TRUE(is_pixel_color(img, 10, 9, 9, tc::img::color::white()));
+    EXPECT_TRUE(is_pixel_color(img, 10, 5, 10, tc::img::color::black()));
+
+    std::vector<uint8_t> empty;
+    EXPECT_NO_THROW(tc::img::set_pixel_rgb(empty, 10, 10, 1, 1, tc::img::color::red()));
+    EXPECT_NO_THROW(tc::img::draw_rectangle(empty, 10, 10, 0, 0, 5, 5, tc::img::color::red(), 1));
+    EXPECT_NO_THROW(tc::img::draw_line(img, -1, 10, 0, 0, 5, 5, tc::img::color::red(), 1));
+    EXPECT_NO_THROW(tc::img::draw_polygon(img, 10, 0, {{0, 0}, {5, 5}}, tc::img::color::red(), 1));
+    EXPECT_TRUE(empty.empty());
+}
+
+// Test tc::img::overlay_mask against the rounded fixed point blend of each channel
+TEST_F(image_draw_test, overlay_mask_blend)
+{
+    // 37 pixels per row leave scalar tails after the vector loops
+    const int width = 37, height = 5;
+    std::vector<uint8_t> img(width * height * 3);
+    for (size_t i = 0; i < img.size(); ++i)
+        img[i] = static_cast<uint8_t>(i * 7);
+
+    std::vector<uint8_t> mask(width * height);
+    for (size_t i = 0; i < mask.size(); ++i)
+        mask[i] = static_cast<uint8_t>(i % 5); // Classes 3 and 4 have no palette entry
+
+    const std::vector<tc::img::color> palette = {tc::img::color::red(), tc::img::color(10, 200, 30, 128), tc::img::color::blue()};
+    const auto original = img;
+    tc::img::overlay_mask(img, width, height, 3, mask, width, height, palette, 0.6f);
+
+    for (int i = 0; i < width * height; ++i)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            int expected = original[i * 3 + c];
+            if (mask[i] < palette.size())
+            {
+                const auto& color = palette[mask[i]];
+                const int w = static_cast<int>(std::lround(0.6f * color.a));
+                const int value = c == 0 ? color.r : (c == 1 ? color.g : color.b);
+                expected = (expected * (255 - w) + value * w + 127) / 255;
+            }
+            ASSERT_EQ(img[i * 3 + c], expected) << "pixel " << i << ", channel " << c;
+        }
+    }
+}
+
+// Test tc::img::overlay_mask nearest upsampling of a low resolution mask
+TEST_F(image_draw_test, overlay_mask_upsampling)
+{
+    auto img = create_blank_image(8, 6);
+    const std::vector<uint8_t> mask = {0, 1, 2, 3};
+    const std::vector<tc::img::color> palette = {tc::img::color::red(), tc::img::color::green(), tc::img::color::blue(), tc::img::color::white()};
+    tc::img::overlay_mask(img, 8, 6, 3, mask, 2, 2, palette, 1.0f);
+
+    for (int y = 0; y < 6; ++y)
+    {
+        for (int x = 0; x < 8; ++x)
+        {
+            EXPECT_TRUE(is_pixel_color(img, 8, x, y, palette[(y / 3) * 2 + x / 4])) << "pixel " << x << ", " << y;
+        }
+    }
+}
+
+// Test tc::img::overlay_mask keeps the alpha channel of RGBA images and skips transparent classes
+TEST_F(image_draw_test, overlay_mask_rgba)
+{
+    std::vector<uint8_t> img(5 * 4 * 4, 100);
+    const std::vector<uint8_t> mask = {0, 1};
+    const std::vector<tc::img::color> palette = {tc::img::color(0, 0, 0, 0), tc::img::color::white()};
+    tc::img::overlay_mask(img, 5, 4, 4, mask, 2, 1, palette);
+
+    for (int y = 0; y < 4; ++y)
+    {
+        for (int x = 0; x < 5; ++x)
+        {
+            const uint8_t* pixel = img.data() + (y * 5 + x) * 4;
+            const uint8_t expected = x < 2 ? 100 : (100 * 127 + 255 * 128 + 127) / 255;
+            EXPECT_EQ(pixel[0], expected);
+            EXPECT_EQ(pixel[1], expected);
+            EXPECT_EQ(pixel[2], expected);
+            EXPECT_EQ(pixel[3], 100);
+        }
+    }
+}
+
+// Test tc::img::overlay_mask argument validation
+TEST_F(image_draw_test, overlay_mask_invalid_arguments)
+{
+    auto img = create_blank_image(4, 4);
+    const std::vector<uint8_t> mask(16, 0);
+    const std::vector<tc::img::color> palette = {tc::img::color::red()};
+    EXPECT_THROW(tc::img::overlay_mask(img, 4, 4, 1, mask, 4, 4, palette), std::runtime_error);
+    EXPECT_THROW(tc::img::overlay_mask(img, 4, 5, 3, mask, 4, 4, palette), std::runtime_error);
+    EXPECT_THROW(tc::img::overlay_mask(img, 4, 4, 3, mask, 4, 3, palette), std::runtime_error);
+    EXPECT_THROW(tc::img::overlay_mask(img, 4, 4, 3, mask, 4, 4, palette, 1.5f), std::runtime_error);
+}
+
 }
@@ -0,0 +1,182 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <teiacare/image/image_filter.hpp>
+
+#include "border_reference.hpp"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace tc::img::tests
+{
+class image_filter_test : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+    }
+    void TearDown() override
+    {
+    }
+
+    static std::vector<std::uint8_t> random_image(int width, int height, int channels, unsigned int seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<int> dist(0, 255);
+        std::vector<std::uint8_t> image(static_cast<std::size_t>(width) * height * channels);
+        for (auto& v : image)
+            v = static_cast<std::uint8_t>(dist(rng));
+        return image;
+    }
+
+    static int pixel(const std::vector<std::uint8_t>& image, int width, int height, int channels, int x, int y, int c, tc::img::border_mode border, int value)
+    {
+        const int sx = border_coordinate(x, width, border);
+        const int sy = border_coordinate(y, height, border);
+        return (sx < 0 || sy < 0) ? value : image[(static_cast<std::size_t>(sy) * width + sx) * channels + c];
+    }
+
+    // Window mean rounded to nearest, from a direct sum over the window
+    static std::vector<std::uint8_t> reference_box_blur(const std::vector<std::uint8_t>& image, int width, int height, int channels, int radius, tc::img::border_mode border, int value)
+    {
+        const int area = (2 * radius + 1) * (2 * radius + 1);
+        std::vector<std::uint8_t> result(image.size());
+        for (int y = 0; y < height; ++y)
+            for (int x = 0; x < width; ++x)
+                for (int c = 0; c < channels; ++c)
+                {
+                    int sum = 0;
+                    for (int dy = -radius; dy <= radius; ++dy)
+                        for (int dx = -radius; dx <= radius; ++dx)
+                            sum += pixel(image, width, height, channels, x + dx, y + dy, c, border, value);
+                    result[(static_cast<std::size_t>(y) * width + x) * channels + c] = static_cast<std::uint8_t>((2 * sum + area) / (2 * area));
+                }
+        return result;
+    }
+
+    // Separable Gaussian in double precision
+    static std::vector<double> reference_gaussian_blur(const std::vector<std::uint8_t>& image, int width, int height, int channels, float sigma, int radius, tc::img::border_mode border)
+    {
+        std::vector<double> weights(2 * radius + 1);
+        double total = 0.0;
+        for (int k = -radius; k <= radius; ++k)
+        {
+            weights[k + radius] = std::exp(-k * k / (2.0 * sigma * sigma));
+            total += weights[k + radius];
+        }
+        for (auto& w : weights)
+            w /= total;
+
+        std::vector<double> result(image.size());
+        for (int y = 0; y < height; ++y)
+            for (int x = 0; x < width; ++x)
+                for (int c = 0; c < channels; ++c)
+                {
+                    double sum = 0.0;
+                    for (int dy = -radius; dy <= radius; ++dy)
+                        for (int dx = -radius; dx <= radius; ++dx)
+                            sum += weights[dy + radius] * weights[dx + radius] * pixel(image, width, height, channels, x + dx, y + dy, c, border, 0);
+                    result[(static_cast<std::size_t>(y) * width + x) * channels + c] = sum;
+                }
+        return result;
+    }
+};
+
+// Test box_blur against a direct window sum for every border mode
+TEST_F(image_filter_test, box_blur_matches_reference)
+{
+    const int width = 37;
+    const int height = 45;
+    for (int channels : {1, 3, 4, 5})
+    {
+        const auto image = random_image(width, height, channels, static_cast<unsigned int>(channels));
+        for (auto border : {tc::img::border_mode::constant, tc::img::border_mode::replicate, tc::img::border_mode::reflect, tc::img::border_mode::wrap})
+        {
+            for (int radius : {1, 4, 40})
+            {
+                const auto expected = reference_box_blur(image, width, height, channels, radius, border, 77);
+                const auto blurred = tc::img::box_blur(image, width, height, channels, radius, border, {77});
+                EXPECT_EQ(blurred, expected) << "channels " << channels << " radius " << radius << " border " << static_cast<int>(border);
+            }
+        }
+    }
+}
+
+// Test box_blur with a zero radius and in place
+TEST_F(image_filter_test, box_blur_identity_and_in_place)
+{
+    auto image = random_image(20, 11, 3, 9);
+    EXPECT_EQ(tc::img::box_blur(image, 20, 11, 3, 0), image);
+
+    const auto expected = tc::img::box_blur(image, 20, 11, 3, 2);
+    tc::img::box_blur(image, 20, 11, 3, 2, image);
+    EXPECT_EQ(image, expected);
+}
+
+// Test gaussian_blur against a double precision reference
+TEST_F(image_filter_test, gaussian_blur_matches_reference)
+{
+    const int width = 41;
+    const int height = 23;
+    for (int channels : {1, 3, 4})
+    {
+        const auto image = random_image(width, height, channels, static_cast<unsigned int>(channels + 10));
+        for (auto border : {tc::img::border_mode::replicate, tc::img::border_mode::reflect, tc::img::border_mode::wrap})
+        {
+            for (float sigma : {0.8f, 2.0f})
+            {
+                const int radius = static_cast<int>(std::ceil(3.0f * sigma));
+                const auto expected = reference_gaussian_blur(image, width, height, channels, sigma, radius, border);
+                std::vector<std::uint8_t> blurred;
+                tc::img::gaussian_blur(image, width, height, channels, sigma, blurred, 0, border);
+                ASSERT_EQ(blurred.size(), expected.size());
+                for (std::size_t i = 0; i < blurred.size(); ++i)
+                    ASSERT_NEAR(blurred[i], expected[i], 1.0) << "index " << i << " channels " << channels << " sigma " << sigma;
+            }
+        }
+    }
+}
+
+// Test gaussian_blur keeping flat images unchanged, including the constant border value
+TEST_F(image_filter_test, gaussian_blur_flat_image)
+{
+    const std::vector<std::uint8_t> image(64 * 9 * 3, 200);
+    for (auto v : tc::img::gaussian_blur(image, 64, 9, 3, 1.5f, 0, tc::img::border_mode::constant, {200}))
+        EXPECT_EQ(v, 200);
+    for (auto v : tc::img::gaussian_blur(image, 64, 9, 3, 5.0f, 4))
+        EXPECT_EQ(v, 200);
+
+    // Black constant border darkens the edges only
+    const auto darkened = tc::img::gaussian_blur(image, 64, 9, 3, 1.0f, 0, tc::img::border_mode::constant, {0});
+    EXPECT_LT(darkened[0], 200);
+    EXPECT_EQ(darkened[(4 * 64 + 32) * 3], 200);
+}
+
+// Test invalid arguments
+TEST_F(image_filter_test, invalid_arguments)
+{
+    const std::vector<std::uint8_t> image(10 * 10 * 3, 0);
+    EXPECT_THROW(tc::img::box_blur(image, 10, 10, 3, -1), std::runtime_error);
+    EXPECT_THROW(tc::img::box_blur(image, 10, 10, 3, 2000), std::runtime_error);
+    EXPECT_THROW(tc::img::box_blur(image, 10, 10, 3, 1, tc::img::border_mode::constant, {1, 2}), std::runtime_error);
+    EXPECT_THROW(tc::img::gaussian_blur(image, 10, 10, 3, 0.0f), std::runtime_error);
+    EXPECT_THROW(tc::img::gaussian_blur(image, 10, 10, 3, 1.0f, -2), std::runtime_error);
+    EXPECT_TRUE(tc::img::gaussian_blur({}, 0, 0, 3, 1.0f).empty());
+}
+
+}
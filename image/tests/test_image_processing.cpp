@@ -13,10 +13,18 @@
 // limitations under the License.
 
 #include <teiacare/image/image_processing.hpp>
+#include <teiacare/image/image_resize.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstdint>
+#include <functional>
 #include <gtest/gtest.h>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <tuple>
 #include <vector>
 
 namespace tc::img::tests
@@ -55,6 +63,13 @@ protected:
     {
         return std::vector<std::uint8_t>(width * height * channels, value);
     }
+
+    // Helper function to copy the elements of a tensor for comparisons with vectors
+    template <typename T>
+    std::vector<T> to_vector(const tc::img::tensor<T>& blob)
+    {
+        return std::vector<T>(blob.begin(), blob.end());
+    }
 };
 
 // Test tc::img::create_blob void version with default parameters
@@ -345,4 +360,659 @@ TEST_F(image_processing_test, create_blob_mean_vector_size_handling)
     });
 }
 
+// Test create_blob with per-channel standard deviation normalization
+TEST_F(image_processing_test, create_blob_std_normalization)
+{
+    auto image = createTestImage(5, 3, 3);
+    const std::vector<float> mean = {0.485f, 0.456f, 0.406f};
+    const std::vector<float> std_dev = {0.229f, 0.224f, 0.225f};
+    auto blob = tc::img::create_blob(image, 5, 3, 3, 1.0f / 255.0f, mean, true, std_dev);
+    ASSERT_EQ(blob.size(), 5u * 3 * 3);
+
+    for (int c = 0; c < 3; ++c)
+    {
+        for (int i = 0; i < 15; ++i)
+        {
+            const float expected = (image[i * 3 + (2 - c)] / 255.0f - mean[c]) / std_dev[c];
+            EXPECT_NEAR(blob[c * 15 + i], expected, 1e-5f);
+        }
+    }
+
+    // Missing components default to a unit standard deviation
+    auto partial = tc::img::create_blob(image, 5, 3, 3, 1.0f, {0.0f, 0.0f, 0.0f}, false, {2.0f});
+    EXPECT_FLOAT_EQ(partial[0], image[0] / 2.0f);
+    EXPECT_FLOAT_EQ(partial[15], static_cast<float>(image[1]));
+}
+
+// Test create_blob against a reference for sizes exercising the vectorized loops and their scalar tails
+TEST_F(image_processing_test, create_blob_matches_reference)
+{
+    for (int channels : {1, 2, 3, 4, 5})
+    {
+        for (auto [width, height] : std::vector<std::array<int, 2>>{{1, 1}, {3, 2}, {17, 5}, {33, 31}, {640, 3}})
+        {
+            auto image = createTestImage(width, height, channels);
+            const std::vector<float> mean = {10.0f, 20.0f, 30.0f, 40.0f, 50.0f};
+            const std::vector<float> std_dev = {2.0f, 4.0f, 8.0f, 16.0f, 32.0f};
+            const bool swap = channels >= 3;
+
+            std::vector<float> blob(7, 0.0f);
+            tc::img::create_blob(image, width, height, channels, blob, 0.5f, mean, swap, std_dev);
+            auto blob_double = tc::img::create_blob(image, width, height, channels, 0.5, {10.0, 20.0, 30.0, 40.0, 50.0}, swap, {2.0, 4.0, 8.0, 16.0, 32.0});
+            ASSERT_EQ(blob.size(), image.size());
+            ASSERT_EQ(blob_double.size(), image.size());
+
+            const int plane = width * height;
+            for (int c = 0; c < channels; ++c)
+            {
+                const int src_channel = (swap && c < 3) ? 2 - c : c;
+                for (int i = 0; i < plane; ++i)
+                {
+                    const float expected = (image[i * channels + src_channel] * 0.5f - mean[c]) / std_dev[c];
+                    EXPECT_NEAR(blob[c * plane + i], expected, 1e-5f) << width << "x" << height << "x" << channels;
+                    EXPECT_NEAR(blob_double[c * plane + i], expected, 1e-5) << width << "x" << height << "x" << channels;
+                }
+            }
+        }
+    }
+}
+
+// Test create_blob invalid arguments
+TEST_F(image_processing_test, create_blob_invalid_arguments)
+{
+    auto image = createTestImage(4, 4, 3);
+    std::vector<float> blob;
+    EXPECT_THROW(tc::img::create_blob(image, 4, 4, 3, blob, 1.0f, {0.0f, 0.0f, 0.0f}, false, {1.0f, 0.0f, 1.0f}), std::runtime_error);
+
+    auto gray = createTestImage(4, 4, 1);
+    EXPECT_THROW(tc::img::create_blob(gray, 4, 4, 1, blob, 1.0f, {0.0f}, true), std::runtime_error);
+}
+
+// Test float16 and bfloat16 rounding of representative values
+TEST_F(image_processing_test, half_float_conversion)
+{
+    EXPECT_EQ(tc::img::float16(1.0f).bits, 0x3C00);
+    EXPECT_EQ(tc::img::float16(-2.0f).bits, 0xC000);
+    EXPECT_EQ(tc::img::float16(65504.0f).bits, 0x7BFF);
+    EXPECT_EQ(tc::img::float16(65520.0f).bits, 0x7C00);
+    EXPECT_EQ(tc::img::float16(std::ldexp(1.0f, -24)).bits, 0x0001);
+    EXPECT_EQ(tc::img::float16(std::ldexp(1.0f, -25)).bits, 0x0000);
+    EXPECT_EQ(tc::img::float16(std::ldexp(3.0f, -25)).bits, 0x0002);
+    EXPECT_EQ(tc::img::float16(1.0f + std::ldexp(1.0f, -11)).bits, 0x3C00);
+    EXPECT_EQ(tc::img::float16(1.0f + std::ldexp(3.0f, -11)).bits, 0x3C02);
+    EXPECT_EQ(tc::img::float16(std::numeric_limits<float>::infinity()).bits, 0x7C00);
+    EXPECT_TRUE(std::isnan(static_cast<float>(tc::img::float16(std::numeric_limits<float>::quiet_NaN()))));
+    EXPECT_EQ(static_cast<float>(tc::img::float16::from_bits(0x3555)), 0.333251953125f);
+    EXPECT_EQ(static_cast<float>(tc::img::float16::from_bits(0x8001)), -std::ldexp(1.0f, -24));
+
+    EXPECT_EQ(tc::img::bfloat16(1.0f).bits, 0x3F80);
+    EXPECT_EQ(tc::img::bfloat16(1.0f + std::ldexp(1.0f, -8)).bits, 0x3F80);
+    EXPECT_EQ(tc::img::bfloat16(1.0f + std::ldexp(3.0f, -8)).bits, 0x3F82);
+    EXPECT_EQ(tc::img::bfloat16(-3.0e38f).bits, 0xFF62);
+    EXPECT_TRUE(std::isnan(static_cast<float>(tc::img::bfloat16(std::numeric_limits<float>::quiet_NaN()))));
+    EXPECT_EQ(static_cast<float>(tc::img::bfloat16::from_bits(0x4049)), 3.140625f);
+
+    // Every half value converts to float and back unchanged
+    for (int bits = 0; bits < 0x10000; ++bits)
+    {
+        const auto value = tc::img::float16::from_bits(static_cast<std::uint16_t>(bits));
+        if (!std::isnan(static_cast<float>(value)))
+        {
+            EXPECT_EQ(tc::img::float16(static_cast<float>(value)), value);
+        }
+    }
+}
+
+// Test 16-bit floating point blobs against rounding each value of the float blob
+TEST_F(image_processing_test, create_blob_half_float)
+{
+    // Ties between subnormal halves, ties between normal halves, and regular normalized values
+    const std::vector<std::tuple<float, std::vector<float>, std::vector<float>>> settings = {
+        {std::ldexp(1.0f, -25), {0.0f}, {}},
+        {std::ldexp(1.0f, -11), {-1.0f}, {}},
+        {std::ldexp(1.0f, -8), {-1.0f}, {}},
+        {1.0f / 255.0f, {0.485f, 0.456f, 0.406f}, {0.229f, 0.224f, 0.225f}},
+        {300.0f, {0.0f}, {}},
+    };
+
+    for (const auto& [scale, mean, std_dev] : settings)
+    {
+        for (int channels : {1, 3, 4})
+        {
+            const auto image = createTestImage(67, 5, channels);
+            const bool swap = channels >= 3;
+            const auto expected = tc::img::create_blob(image, 67, 5, channels, scale, mean, swap, std_dev);
+
+            const auto half = tc::img::create_blob<tc::img::float16>(image, 67, 5, channels, scale, mean, swap, std_dev);
+            std::vector<tc::img::bfloat16> brain(3, tc::img::bfloat16(1.0f));
+            tc::img::create_blob(image, 67, 5, channels, brain, scale, mean, swap, std_dev);
+
+            ASSERT_EQ(half.size(), expected.size());
+            ASSERT_EQ(brain.size(), expected.size());
+            for (std::size_t i = 0; i < expected.size(); ++i)
+            {
+                ASSERT_EQ(half[i], tc::img::float16(expected[i])) << "scale " << scale << ", channels " << channels << ", index " << i;
+                ASSERT_EQ(brain[i], tc::img::bfloat16(expected[i])) << "scale " << scale << ", channels " << channels << ", index " << i;
+            }
+        }
+    }
+
+    std::vector<tc::img::float16> blob;
+    EXPECT_THROW(tc::img::create_blob(std::vector<std::uint8_t>(16, 0), 4, 4, 1, blob, 1.0f, {0.0f}, true), std::runtime_error);
+}
+
+// Test create_quantized_blob against quantizing the float blob of create_blob
+TEST_F(image_processing_test, create_quantized_blob_matches_quantized_create_blob)
+{
+    const std::vector<float> mean = {0.485f, 0.456f, 0.406f};
+    const std::vector<float> std_dev = {0.229f, 0.224f, 0.225f};
+    for (int channels : {1, 3, 4, 5})
+    {
+        const auto image = createTestImage(23, 7, channels);
+        const bool swap = channels >= 3;
+        const auto expected = tc::img::create_blob(image, 23, 7, channels, 1.0f / 255.0f, mean, swap, std_dev);
+        const std::size_t plane_size = 23 * 7;
+
+        const std::vector<float> quant_scale = {0.0186f, 0.0175f, 0.0174f, 0.02f, 0.05f};
+        const std::vector<int> zero_point = {-3, 0, 5, 1, -128};
+        const std::vector<float> channel_scale(quant_scale.begin(), quant_scale.begin() + channels);
+        const std::vector<int> channel_zero_point(zero_point.begin(), zero_point.begin() + channels);
+        auto per_channel = tc::img::create_quantized_blob<std::int8_t>(image, 23, 7, channels, channel_scale, channel_zero_point, 1.0f / 255.0f, mean, swap, std_dev);
+
+        std::vector<std::uint8_t> per_tensor(2, 7);
+        tc::img::create_quantized_blob(image, 23, 7, channels, per_tensor, {0.0185f}, {114}, 1.0f / 255.0f, mean, swap, std_dev);
+
+        ASSERT_EQ(per_channel.size(), expected.size());
+        ASSERT_EQ(per_tensor.size(), expected.size());
+        for (std::size_t i = 0; i < expected.size(); ++i)
+        {
+            const std::size_t c = i / plane_size;
+            const float signed_value = std::nearbyint(expected[i] / quant_scale[c]) + zero_point[c];
+            const float unsigned_value = std::nearbyint(expected[i] / 0.0185f) + 114;
+            ASSERT_EQ(per_channel[i], static_cast<std::int8_t>(std::clamp(signed_value, -128.0f, 127.0f))) << "channels " << channels << ", index " << i;
+            ASSERT_EQ(per_tensor[i], static_cast<std::uint8_t>(std::clamp(unsigned_value, 0.0f, 255.0f))) << "channels " << channels << ", index " << i;
+        }
+    }
+}
+
+// Test create_quantized_blob rounding half to even and saturating
+TEST_F(image_processing_test, create_quantized_blob_rounding_and_saturation)
+{
+    const std::vector<std::uint8_t> image = {0, 1, 2, 3, 5, 100, 200, 255};
+
+    // pixel / 2 lands on halves for odd pixels
+    auto rounded = tc::img::create_quantized_blob<std::uint8_t>(image, 8, 1, 1, {2.0f}, {0}, 1.0f, {0.0f});
+    EXPECT_EQ(to_vector(rounded), (std::vector<std::uint8_t>{0, 0, 1, 2, 2, 50, 100, 128}));
+
+    auto saturated = tc::img::create_quantized_blob<std::int8_t>(image, 8, 1, 1, {1.0f}, {-128}, 1.0f, {0.0f});
+    EXPECT_EQ(to_vector(saturated), (std::vector<std::int8_t>{-128, -127, -126, -125, -123, -28, 72, 127}));
+
+    auto negative = tc::img::create_quantized_blob<std::uint8_t>(image, 8, 1, 1, {0.5f}, {10}, 1.0f, {100.0f});
+    EXPECT_EQ(to_vector(negative), (std::vector<std::uint8_t>{0, 0, 0, 0, 0, 10, 210, 255}));
+}
+
+// Test create_quantized_blob invalid arguments
+TEST_F(image_processing_test, create_quantized_blob_invalid_arguments)
+{
+    const auto image = createTestImage(4, 4, 3);
+    std::vector<std::int8_t> blob;
+    EXPECT_THROW(tc::img::create_quantized_blob(image, 4, 4, 3, blob, {0.1f, 0.1f}, {0}), std::runtime_error);
+    EXPECT_THROW(tc::img::create_quantized_blob(image, 4, 4, 3, blob, {0.1f}, {0, 0}), std::runtime_error);
+    EXPECT_THROW(tc::img::create_quantized_blob(image, 4, 4, 3, blob, {0.0f}, {0}), std::runtime_error);
+    EXPECT_THROW(tc::img::create_quantized_blob(image, 4, 4, 3, blob, {std::numeric_limits<float>::infinity()}, {0}), std::runtime_error);
+    EXPECT_THROW(tc::img::create_quantized_blob(image, 4, 4, 3, blob, {0.1f}, {128}), std::runtime_error);
+
+    std::vector<std::uint8_t> unsigned_blob;
+    EXPECT_THROW(tc::img::create_quantized_blob(image, 4, 4, 3, unsigned_blob, {0.1f}, {-1}), std::runtime_error);
+    EXPECT_NO_THROW(tc::img::create_quantized_blob(image, 4, 4, 3, unsigned_blob, {0.1f}, {255}));
+}
+
+// Test NHWC blobs hold the values of the NCHW blob with interleaved channels, for every channel order and element type
+TEST_F(image_processing_test, create_blob_nhwc_layout)
+{
+    const std::vector<float> mean = {0.485f, 0.456f, 0.406f, 0.5f, 0.1f};
+    const std::vector<float> std_dev = {0.229f, 0.224f, 0.225f, 0.25f, 2.0f};
+    for (int channels : {1, 2, 3, 4, 5})
+    {
+        for (bool swap : {false, true})
+        {
+            if (swap && channels < 3)
+                continue;
+
+            // 31 x 3 pixels leave scalar tails after the vector loops
+            const auto image = createTestImage(31, 3, channels);
+            const std::size_t pixel_count = 31 * 3;
+            const auto planar = tc::img::create_blob(image, 31, 3, channels, 1.0f / 255.0f, mean, swap, std_dev);
+            const auto interleaved = tc::img::create_blob(image, 31, 3, channels, 1.0f / 255.0f, mean, swap, std_dev, tc::img::blob_layout::nhwc);
+            const auto planar_double = tc::img::create_blob(image, 31, 3, channels, 0.5, {1.0, 2.0, 3.0}, swap, {}, tc::img::blob_layout::nchw);
+            const auto interleaved_double = tc::img::create_blob(image, 31, 3, channels, 0.5, {1.0, 2.0, 3.0}, swap, {}, tc::img::blob_layout::nhwc);
+            const auto half = tc::img::create_blob<tc::img::float16>(image, 31, 3, channels, 1.0f / 255.0f, mean, swap, std_dev, tc::img::blob_layout::nhwc);
+            const auto quantized = tc::img::create_quantized_blob<std::int8_t>(image, 31, 3, channels, {0.02f}, {3}, 1.0f / 255.0f, mean, swap, std_dev);
+            const auto quantized_nhwc = tc::img::create_quantized_blob<std::int8_t>(image, 31, 3, channels, {0.02f}, {3}, 1.0f / 255.0f, mean, swap, std_dev, tc::img::blob_layout::nhwc);
+
+            ASSERT_EQ(interleaved.size(), planar.size());
+            ASSERT_EQ(half.size(), planar.size());
+            ASSERT_EQ(quantized_nhwc.size(), planar.size());
+            for (std::size_t i = 0; i < pixel_count; ++i)
+            {
+                for (int c = 0; c < channels; ++c)
+                {
+                    const std::size_t nchw = c * pixel_count + i;
+                    const std::size_t nhwc = i * channels + c;
+                    ASSERT_EQ(interleaved[nhwc], planar[nchw]) << "channels " << channels << ", swap " << swap << ", pixel " << i << ", channel " << c;
+                    ASSERT_EQ(interleaved_double[nhwc], planar_double[nchw]);
+                    ASSERT_EQ(half[nhwc], tc::img::float16(planar[nchw]));
+                    ASSERT_EQ(quantized_nhwc[nhwc], quantized[nchw]);
+                }
+            }
+        }
+    }
+}
+
+// Test blob functions return 64-byte aligned tensors with their shape
+TEST_F(image_processing_test, blob_tensor_shapes)
+{
+    const auto image = createTestImage(7, 5, 3);
+    const auto nchw = tc::img::create_blob<float>(image, 7, 5, 3);
+    EXPECT_EQ(nchw.shape(), (std::vector<std::size_t>{3, 5, 7}));
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(nchw.data()) % 64, 0u);
+
+    const auto nhwc = tc::img::create_blob<tc::img::bfloat16>(image, 7, 5, 3, 1.0f / 255.0f, {0.0f}, false, {}, tc::img::blob_layout::nhwc);
+    EXPECT_EQ(nhwc.shape(), (std::vector<std::size_t>{5, 7, 3}));
+
+    const auto quantized = tc::img::create_quantized_blob<std::uint8_t>(image, 7, 5, 3, {0.01f}, {0});
+    EXPECT_EQ(quantized.shape(), (std::vector<std::size_t>{3, 5, 7}));
+
+    const auto letterboxed = tc::img::letterbox_blob(image, 7, 5, 3, 8, 6);
+    EXPECT_EQ(letterboxed.shape(), (std::vector<std::size_t>{3, 6, 8}));
+
+    const std::vector<std::tuple<std::vector<std::uint8_t>, int, int, int>> images = {{image, 7, 5, 3}, {image, 7, 5, 3}};
+    const auto batch = tc::img::create_blob_batch(images);
+    EXPECT_EQ(batch.shape(), (std::vector<std::size_t>{2, 3, 5, 7}));
+    EXPECT_TRUE(std::equal(nchw.begin(), nchw.end(), batch.begin() + nchw.size()));
+
+    const auto crops = tc::img::crop_resize_batch(image, 7, 5, 3, {{0, 0, 4, 4}, {1, 1, 3, 3}, {2, 0, 5, 5}}, 4, 2);
+    EXPECT_EQ(crops.shape(), (std::vector<std::size_t>{3, 3, 2, 4}));
+}
+
+// Test letterbox_blob against image_resize_aspect_ratio followed by create_blob
+TEST_F(image_processing_test, letterbox_blob_matches_resize_and_create_blob)
+{
+    const std::vector<float> mean = {0.485f, 0.456f, 0.406f, 0.5f};
+    const std::vector<float> std_dev = {0.229f, 0.224f, 0.225f, 0.25f};
+    const std::vector<std::uint8_t> pad_components = {100, 110, 120, 130};
+    for (int channels : {1, 3, 4})
+    {
+        for (auto [width, height, target_width, target_height] : std::vector<std::array<int, 4>>{{64, 48, 32, 32}, {30, 70, 40, 24}, {17, 17, 50, 33}})
+        {
+            auto image = createTestImage(width, height, channels);
+            const bool swap = channels >= 3;
+            const tc::img::letterbox_pad pad{std::span<const std::uint8_t>(pad_components.data(), channels)};
+
+            auto resized = tc::img::image_resize_aspect_ratio(image, width, height, channels, target_width, target_height, pad);
+            auto expected = tc::img::create_blob(resized, target_width, target_height, channels, 1.0f / 255.0f, mean, swap, std_dev);
+
+            std::vector<float> blob(3, 1.0f);
+            tc::img::letterbox_blob(image, width, height, channels, target_width, target_height, blob, 1.0f / 255.0f, mean, swap, std_dev, pad);
+            EXPECT_EQ(blob, to_vector(expected)) << width << "x" << height << "x" << channels << " -> " << target_width << "x" << target_height;
+            EXPECT_EQ(tc::img::letterbox_blob(image, width, height, channels, target_width, target_height, 1.0f / 255.0f, mean, swap, std_dev, pad), expected);
+        }
+    }
+}
+
+// Test letterbox_blob padding written in normalized space
+TEST_F(image_processing_test, letterbox_blob_normalized_padding)
+{
+    auto image = create_uniform_image(4, 2, 3, 255);
+    auto blob = tc::img::letterbox_blob(image, 4, 2, 3, 4, 4, 1.0f, {10.0f, 20.0f, 30.0f}, true, {1.0f, 2.0f, 5.0f}, {1, 2, 3});
+    ASSERT_EQ(blob.size(), 4u * 4 * 3);
+
+    // Rows 0 and 3 are padding: output channel c reads pad component 2 - c because of swapRB_channels
+    EXPECT_FLOAT_EQ(blob[0], (3.0f - 10.0f) / 1.0f);
+    EXPECT_FLOAT_EQ(blob[16], (2.0f - 20.0f) / 2.0f);
+    EXPECT_FLOAT_EQ(blob[32 + 15], (1.0f - 30.0f) / 5.0f);
+    EXPECT_FLOAT_EQ(blob[4], 255.0f - 10.0f);
+    EXPECT_FLOAT_EQ(blob[32 + 4], (255.0f - 30.0f) / 5.0f);
+
+    EXPECT_THROW(tc::img::letterbox_blob(image, 4, 2, 3, 4, 4, 1.0f, {0.0f}, false, {}, {1, 2}), std::runtime_error);
+}
+
+// Test nv12_letterbox_blob against nv12_to_rgb followed by letterbox_blob
+TEST_F(image_processing_test, nv12_letterbox_blob_matches_rgb_path)
+{
+    const std::vector<float> mean = {0.485f, 0.456f, 0.406f};
+    const std::vector<float> std_dev = {0.229f, 0.224f, 0.225f};
+    const tc::img::letterbox_pad pad = {100, 110, 120};
+    for (auto [width, height, target_width, target_height] : std::vector<std::array<int, 4>>{{64, 48, 32, 32}, {31, 71, 40, 24}, {17, 17, 50, 33}})
+    {
+        std::vector<std::uint8_t> nv12(width * height + 2 * ((width + 1) / 2) * ((height + 1) / 2));
+        for (std::size_t i = 0; i < nv12.size(); ++i)
+            nv12[i] = static_cast<std::uint8_t>((i * 37 + i / 11) % 256);
+        for (bool swap : {false, true})
+        {
+            auto rgb = tc::img::nv12_to_rgb(nv12, width, height, tc::img::yuv_matrix::bt709, tc::img::yuv_range::full);
+            auto expected = tc::img::letterbox_blob(rgb, width, height, 3, target_width, target_height, 1.0f / 255.0f, mean, swap, std_dev, pad);
+
+            std::vector<float> blob(5, 1.0f);
+            tc::img::nv12_letterbox_blob(nv12, width, height, target_width, target_height, blob, 1.0f / 255.0f, mean, swap, std_dev, pad, tc::img::yuv_matrix::bt709, tc::img::yuv_range::full);
+            EXPECT_EQ(blob, to_vector(expected)) << width << "x" << height << " -> " << target_width << "x" << target_height;
+            EXPECT_EQ(tc::img::nv12_letterbox_blob(nv12, width, height, target_width, target_height, 1.0f / 255.0f, mean, swap, std_dev, pad, tc::img::yuv_matrix::bt709, tc::img::yuv_range::full), expected);
+        }
+    }
+
+    EXPECT_THROW(tc::img::nv12_letterbox_blob(std::vector<std::uint8_t>(10), 4, 4, 8, 8), std::runtime_error);
+}
+
+// Test create_blob_batch against create_blob applied to each image
+TEST_F(image_processing_test, create_blob_batch_matches_create_blob)
+{
+    const std::vector<float> mean = {0.485f, 0.456f, 0.406f};
+    const std::vector<float> std_dev = {0.229f, 0.224f, 0.225f};
+    std::vector<std::tuple<std::vector<std::uint8_t>, int, int, int>> images;
+    for (int n = 0; n < 5; ++n)
+    {
+        auto image = createTestImage(37, 19, 3);
+        for (auto& value : image)
+            value = static_cast<std::uint8_t>(value + 13 * n);
+        images.emplace_back(image, 37, 19, 3);
+    }
+
+    std::vector<float> batch(11, 0.0f);
+    tc::img::create_blob_batch(images, batch, 1.0f / 255.0f, mean, true, std_dev);
+    ASSERT_EQ(batch.size(), 5u * 3 * 37 * 19);
+
+    const std::size_t image_size = 3 * 37 * 19;
+    for (int n = 0; n < 5; ++n)
+    {
+        auto expected = tc::img::create_blob(std::get<0>(images[n]), 37, 19, 3, 1.0f / 255.0f, mean, true, std_dev);
+        EXPECT_TRUE(std::equal(expected.begin(), expected.end(), batch.begin() + n * image_size)) << "image " << n;
+    }
+
+    tc::img::sequential_executor sequential;
+    EXPECT_EQ(to_vector(tc::img::create_blob_batch(images, 1.0f / 255.0f, mean, true, std_dev, sequential)), batch);
+}
+
+// Test create_blob_batch running on a user supplied executor
+TEST_F(image_processing_test, create_blob_batch_custom_executor)
+{
+    // Executor running every item as its own chunk, in reverse order
+    class reverse_executor : public tc::img::executor
+    {
+    public:
+        void parallel_for(int count, const std::function<void(int, int)>& task, int) override
+        {
+            for (int i = count - 1; i >= 0; --i)
+                task(i, i + 1);
+            ++calls;
+        }
+        int calls = 0;
+    };
+
+    std::vector<std::tuple<std::vector<std::uint8_t>, int, int, int>> images = {{createTestImage(6, 4, 1), 6, 4, 1}, {createTestImage(6, 4, 1), 6, 4, 1}};
+    reverse_executor exec;
+    auto batch = tc::img::create_blob_batch(images, 1.0f, {0.0f}, false, {}, exec);
+    EXPECT_EQ(exec.calls, 1);
+    ASSERT_EQ(batch.size(), 2u * 24);
+    for (int i = 0; i < 24; ++i)
+    {
+        EXPECT_EQ(batch[i], std::get<0>(images[0])[i]);
+        EXPECT_EQ(batch[24 + i], std::get<0>(images[1])[i]);
+    }
+}
+
+// Test create_blob_batch validation
+TEST_F(image_processing_test, create_blob_batch_invalid_arguments)
+{
+    std::vector<std::tuple<std::vector<std::uint8_t>, int, int, int>> images = {{createTestImage(4, 4, 3), 4, 4, 3}, {createTestImage(4, 5, 3), 4, 5, 3}};
+    std::vector<float> batch;
+    EXPECT_THROW(tc::img::create_blob_batch(images, batch), std::runtime_error);
+
+    std::get<0>(images[1]).resize(10);
+    std::get<2>(images[1]) = 4;
+    EXPECT_THROW(tc::img::create_blob_batch(images, batch), std::runtime_error);
+
+    std::vector<std::tuple<std::vector<std::uint8_t>, int, int, int>> empty;
+    batch.assign(3, 1.0f);
+    tc::img::create_blob_batch(empty, batch);
+    EXPECT_TRUE(batch.empty());
+}
+
+// Test crop_resize_batch layout: one NCHW slot per box
+TEST_F(image_processing_test, crop_resize_batch_layout)
+{
+    // 4x2 image, left half R=10 G=20 B=30, right half R=40 G=50 B=60
+    std::vector<std::uint8_t> image(4 * 2 * 3);
+    for (int y = 0; y < 2; ++y)
+    {
+        for (int x = 0; x < 4; ++x)
+        {
+            const std::uint8_t base = x < 2 ? 10 : 40;
+            image[(y * 4 + x) * 3 + 0] = base;
+            image[(y * 4 + x) * 3 + 1] = base + 10;
+            image[(y * 4 + x) * 3 + 2] = base + 20;
+        }
+    }
+
+    const std::vector<std::array<int, 4>> boxes = {{0, 0, 2, 2}, {2, 0, 2, 2}};
+    auto batch = tc::img::crop_resize_batch(image, 4, 2, 3, boxes, 3, 3, 1.0f);
+
+    ASSERT_EQ(batch.size(), 2 * 3 * 3 * 3);
+    for (int n = 0; n < 2; ++n)
+    {
+        const float base = n == 0 ? 10.0f : 40.0f;
+        for (int c = 0; c < 3; ++c)
+        {
+            for (int i = 0; i < 9; ++i)
+            {
+                EXPECT_NEAR(batch[(n * 3 + c) * 9 + i], base + 10.0f * c, 1e-4f) << "n=" << n << " c=" << c << " i=" << i;
+            }
+        }
+    }
+}
+
+// Test crop_resize_batch normalization and channel swap match create_blob on an identity crop
+TEST_F(image_processing_test, crop_resize_batch_matches_create_blob)
+{
+    auto image = createTestImage(5, 4, 3);
+    const std::vector<float> mean = {0.1f, 0.2f, 0.3f};
+
+    const std::vector<float> std_dev = {0.25f, 0.5f, 2.0f};
+
+    auto expected = tc::img::create_blob(image, 5, 4, 3, 0.5f, mean, true);
+    auto batch = tc::img::crop_resize_batch(image, 5, 4, 3, {{0, 0, 5, 4}}, 5, 4, 0.5f, mean, true);
+
+    ASSERT_EQ(batch.size(), expected.size());
+    for (size_t i = 0; i < batch.size(); ++i)
+    {
+        EXPECT_NEAR(batch[i], expected[i], 1e-4f) << "Mismatch at index: " << i;
+    }
+
+    tc::img::sequential_executor sequential;
+    auto expected_std = tc::img::create_blob(image, 5, 4, 3, 0.5f, mean, true, std_dev);
+    std::vector<float> batch_std;
+    tc::img::crop_resize_batch(image, 5, 4, 3, {{0, 0, 5, 4}}, 5, 4, batch_std, 0.5f, mean, true, std_dev, sequential);
+
+    ASSERT_EQ(batch_std.size(), expected_std.size());
+    for (size_t i = 0; i < batch_std.size(); ++i)
+    {
+        EXPECT_NEAR(batch_std[i], expected_std[i], 1e-4f) << "Mismatch at index: " << i;
+    }
+}
+
+// Test crop_resize_batch bilinear interpolation on a horizontal gradient
+TEST_F(image_processing_test, crop_resize_batch_bilinear_upscale)
+{
+    // Single channel 2x1 image: 0, 100
+    std::vector<std::uint8_t> image = {0, 100};
+    auto batch = tc::img::crop_resize_batch(image, 2, 1, 1, {{0, 0, 2, 1}}, 4, 1, 1.0f, {0.0f});
+
+    ASSERT_EQ(batch.size(), 4);
+    EXPECT_NEAR(batch[0], 0.0f, 1e-4f);
+    EXPECT_NEAR(batch[1], 25.0f, 1e-4f);
+    EXPECT_NEAR(batch[2], 75.0f, 1e-4f);
+    EXPECT_NEAR(batch[3], 100.0f, 1e-4f);
+}
+
+// Test crop_resize_batch with boxes crossing the image border and buffer reuse
+TEST_F(image_processing_test, crop_resize_batch_out_of_bounds_and_reuse)
+{
+    auto image = create_uniform_image(6, 6, 3, 90);
+    std::vector<float> batch(3, -1.0f);
+
+    const std::vector<std::array<int, 4>> boxes = {{-4, -4, 8, 8}, {3, 3, 10, 10}, {1, 1, 1, 1}};
+    tc::img::crop_resize_batch(image, 6, 6, 3, boxes, 7, 5, batch, 1.0f / 90.0f);
+
+    ASSERT_EQ(batch.size(), 3 * 3 * 7 * 5);
+    for (auto value : batch)
+    {
+        EXPECT_NEAR(value, 1.0f, 1e-5f);
+    }
+}
+
+// Test crop_resize_batch argument validation
+TEST_F(image_processing_test, crop_resize_batch_invalid_arguments)
+{
+    auto image = create_uniform_image(4, 4, 3, 0);
+    EXPECT_THROW(tc::img::crop_resize_batch(image, 4, 4, 3, {{0, 0, 0, 2}}, 2, 2), std::runtime_error);
+
+    auto gray = create_uniform_image(4, 4, 1, 0);
+    EXPECT_THROW(tc::img::crop_resize_batch(gray, 4, 4, 1, {{0, 0, 2, 2}}, 2, 2, 1.0f, {0.0f}, true), std::runtime_error);
+    EXPECT_THROW(tc::img::crop_resize_batch(image, 4, 4, 3, {{0, 0, 2, 2}}, -1, 2), std::runtime_error);
+    EXPECT_THROW(tc::img::crop_resize_batch(image, 4, 4, 3, {{0, 0, 2, 2}}, 2, -1), std::runtime_error);
+    EXPECT_THROW(tc::img::crop_resize_batch(image, 4, 4, 3, {{0, 0, 2, 2}}, 2, 2, 1.0f, {0.0f}, false, {1.0f, 0.0f, 1.0f}), std::runtime_error);
+
+    EXPECT_TRUE(tc::img::crop_resize_batch(image, 4, 4, 3, {}, 2, 2).empty());
+}
+
+// Test blob_to_image inverts create_blob for every channel count, channel order and layout
+TEST_F(image_processing_test, blob_to_image_round_trip)
+{
+    const std::vector<float> mean = {0.485f, 0.456f, 0.406f, 0.5f, 0.1f};
+    const std::vector<float> std_dev = {0.229f, 0.224f, 0.225f, 0.25f, 2.0f};
+    for (int channels : {1, 2, 3, 4, 5})
+    {
+        for (bool swap : {false, true})
+        {
+            if (swap && channels < 3)
+                continue;
+
+            for (auto layout : {tc::img::blob_layout::nchw, tc::img::blob_layout::nhwc})
+            {
+                // 37 x 9 pixels span several conversion blocks and leave scalar tails
+                const auto image = createTestImage(37, 9, channels);
+                const auto blob = tc::img::create_blob(image, 37, 9, channels, 1.0f / 255.0f, mean, swap, std_dev, layout);
+                EXPECT_EQ(tc::img::blob_to_image(blob, 37, 9, channels, 1.0f / 255.0f, mean, swap, std_dev, layout), image) << "channels " << channels << ", swap " << swap;
+
+                std::vector<std::uint8_t> result(3, 0);
+                tc::img::blob_to_image(to_vector(blob), 37, 9, channels, result, 1.0f / 255.0f, mean, swap, std_dev, layout);
+                EXPECT_EQ(result, image);
+            }
+        }
+    }
+}
+
+// Test blob_to_image on 16-bit floating point blobs against their values widened to float
+TEST_F(image_processing_test, blob_to_image_half_float)
+{
+    const std::vector<float> mean = {0.485f, 0.456f, 0.406f};
+    const std::vector<float> std_dev = {0.229f, 0.224f, 0.225f};
+    const auto image = createTestImage(37, 9, 3);
+    for (auto layout : {tc::img::blob_layout::nchw, tc::img::blob_layout::nhwc})
+    {
+        const auto half = tc::img::create_blob<tc::img::float16>(image, 37, 9, 3, 1.0f / 255.0f, mean, true, std_dev, layout);
+        const auto bhalf = tc::img::create_blob<tc::img::bfloat16>(image, 37, 9, 3, 1.0f / 255.0f, mean, true, std_dev, layout);
+        const std::vector<float> half_values(half.begin(), half.end());
+        const std::vector<float> bhalf_values(bhalf.begin(), bhalf.end());
+
+        EXPECT_EQ(tc::img::blob_to_image(half, 37, 9, 3, 1.0f / 255.0f, mean, true, std_dev, layout), tc::img::blob_to_image(half_values, 37, 9, 3, 1.0f / 255.0f, mean, true, std_dev, layout));
+        EXPECT_EQ(tc::img::blob_to_image(bhalf, 37, 9, 3, 1.0f / 255.0f, mean, true, std_dev, layout), tc::img::blob_to_image(bhalf_values, 37, 9, 3, 1.0f / 255.0f, mean, true, std_dev, layout));
+
+        // Half precision keeps enough bits to recover every pixel
+        EXPECT_EQ(tc::img::blob_to_image(half, 37, 9, 3, 1.0f / 255.0f, mean, true, std_dev, layout), image);
+    }
+
+    // Special values, subnormals included, widen exactly
+    std::vector<tc::img::float16> bits(1 << 16, tc::img::float16(0.0f));
+    for (int i = 0; i < (1 << 16); ++i)
+        bits[i] = tc::img::float16::from_bits(static_cast<std::uint16_t>(i));
+    const auto pixels = tc::img::blob_to_image(bits, 256, 256, 1, 1.0f / 65536.0f);
+    for (int i = 0; i < (1 << 16); ++i)
+    {
+        const float value = static_cast<float>(bits[i]) * 65536.0f;
+        const std::uint8_t expected = value > 0.0f ? static_cast<std::uint8_t>(std::nearbyint(std::min(value, 255.0f))) : 0;
+        ASSERT_EQ(pixels[i], expected) << "bits " << i;
+    }
+}
+
+// Test blob_to_image rounding half to even, saturating and mapping NaN to 0
+TEST_F(image_processing_test, blob_to_image_rounding_and_saturation)
+{
+    const float inf = std::numeric_limits<float>::infinity();
+    const std::vector<float> values = {-1.0f, std::numeric_limits<float>::quiet_NaN(), inf, -inf, 0.5f, 1.5f, 2.5f, 127.6f, 254.5f, 255.4f, 300.0f, 1e30f, 3e9f};
+    const std::vector<std::uint8_t> expected = {0, 0, 255, 0, 0, 2, 2, 128, 254, 255, 255, 255, 255};
+
+    // Repeated twice to cover both the vector loops and the scalar tail
+    std::vector<float> blob(values);
+    blob.insert(blob.end(), values.begin(), values.end());
+    const auto image = tc::img::blob_to_image(blob, 26, 1, 1, 1.0f, {0.0f});
+    for (std::size_t i = 0; i < image.size(); ++i)
+    {
+        EXPECT_EQ(image[i], expected[i % values.size()]) << "value " << values[i % values.size()];
+    }
+}
+
+// Test blob_to_image_batch against create_blob_batch, in both layouts
+TEST_F(image_processing_test, blob_to_image_batch_round_trip)
+{
+    const std::vector<float> mean = {0.485f, 0.456f, 0.406f};
+    const std::vector<float> std_dev = {0.229f, 0.224f, 0.225f};
+    std::vector<std::tuple<std::vector<std::uint8_t>, int, int, int>> images;
+    for (int n = 0; n < 3; ++n)
+    {
+        auto image = createTestImage(21, 11, 3);
+        for (auto& value : image)
+            value = static_cast<std::uint8_t>(value + 40 * n);
+        images.emplace_back(image, 21, 11, 3);
+    }
+
+    const auto batch = tc::img::create_blob_batch(images, 1.0f / 255.0f, mean, true, std_dev);
+    const auto result = tc::img::blob_to_image_batch(batch, 21, 11, 3, 1.0f / 255.0f, mean, true, std_dev);
+    ASSERT_EQ(result.size(), images.size());
+    for (std::size_t n = 0; n < images.size(); ++n)
+    {
+        EXPECT_EQ(result[n], std::get<0>(images[n])) << "image " << n;
+    }
+
+    std::vector<float> nhwc;
+    for (const auto& [image, width, height, channels] : images)
+    {
+        const auto blob = tc::img::create_blob(image, width, height, channels, 1.0f, {0.0f}, false, {}, tc::img::blob_layout::nhwc);
+        nhwc.insert(nhwc.end(), blob.begin(), blob.end());
+    }
+
+    tc::img::sequential_executor sequential;
+    std::vector<std::vector<std::uint8_t>> reused(5);
+    tc::img::blob_to_image_batch(nhwc, 21, 11, 3, reused, 1.0f, {0.0f}, false, {}, tc::img::blob_layout::nhwc, sequential);
+    ASSERT_EQ(reused.size(), images.size());
+    for (std::size_t n = 0; n < images.size(); ++n)
+    {
+        EXPECT_EQ(reused[n], std::get<0>(images[n])) << "image " << n;
+    }
+}
+
+// Test blob_to_image argument validation
+TEST_F(image_processing_test, blob_to_image_invalid_arguments)
+{
+    const std::vector<float> blob(4 * 3 * 3, 0.5f);
+    std::vector<std::uint8_t> image;
+    EXPECT_THROW(tc::img::blob_to_image(blob, 4, 4, 3, image), std::runtime_error);
+    EXPECT_THROW(tc::img::blob_to_image(blob, 4, 3, 3, image, 0.0f), std::runtime_error);
+    EXPECT_THROW(tc::img::blob_to_image(blob, 4, 3, 3, image, 1.0f, {0.0f}, false, {1.0f, 0.0f}), std::runtime_error);
+    EXPECT_THROW(tc::img::blob_to_image(blob, 12, 3, 1, image, 1.0f, {0.0f}, true), std::runtime_error);
+
+    std::vector<std::vector<std::uint8_t>> images;
+    EXPECT_THROW(tc::img::blob_to_image_batch(blob, 5, 5, 1, images), std::runtime_error);
+    EXPECT_TRUE(tc::img::blob_to_image_batch(std::vector<float>{}, 4, 4, 3).empty());
+}
+
 }
@@ -0,0 +1,213 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <teiacare/image/image_pyramid.hpp>
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+namespace tc::img::tests
+{
+class image_pyramid_test : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+    }
+    void TearDown() override
+    {
+    }
+
+    // Helper function to create a pseudo-random test image
+    std::vector<std::uint8_t> createNoiseImage(int width, int height, int channels)
+    {
+        std::vector<std::uint8_t> image(width * height * channels);
+        std::uint32_t state = 12345;
+        for (auto& value : image)
+        {
+            state = state * 1664525u + 1013904223u;
+            value = static_cast<std::uint8_t>(state >> 24);
+        }
+        return image;
+    }
+
+    // Reference 2x2 box average with rounding
+    std::vector<std::uint8_t> referenceHalf(const std::vector<std::uint8_t>& image, int width, int height, int channels)
+    {
+        const int w = width / 2, h = height / 2;
+        std::vector<std::uint8_t> out(w * h * channels);
+        for (int y = 0; y < h; ++y)
+        {
+            for (int x = 0; x < w; ++x)
+            {
+                for (int c = 0; c < channels; ++c)
+                {
+                    const auto at = [&](int xx, int yy) { return static_cast<int>(image[(yy * width + xx) * channels + c]); };
+                    const int sum = at(2 * x, 2 * y) + at(2 * x + 1, 2 * y) + at(2 * x, 2 * y + 1) + at(2 * x + 1, 2 * y + 1);
+                    out[(y * w + x) * channels + c] = static_cast<std::uint8_t>((sum + 2) / 4);
+                }
+            }
+        }
+        return out;
+    }
+};
+
+// Test level dimensions and contiguous offsets
+TEST_F(image_pyramid_test, levels_layout)
+{
+    auto image = createNoiseImage(64, 32, 3);
+    auto pyramid = tc::img::build_image_pyramid(image, 64, 32, 3, 4);
+
+    ASSERT_EQ(pyramid.levels.size(), 4);
+    EXPECT_EQ(pyramid.channels, 3);
+
+    std::size_t expected_offset = 0;
+    int expected_width = 64, expected_height = 32;
+    for (std::size_t i = 0; i < pyramid.levels.size(); ++i)
+    {
+        EXPECT_EQ(pyramid.levels[i].offset, expected_offset);
+        EXPECT_EQ(pyramid.levels[i].width, expected_width);
+        EXPECT_EQ(pyramid.levels[i].height, expected_height);
+        expected_offset += pyramid.level_size(i);
+        expected_width /= 2;
+        expected_height /= 2;
+    }
+    EXPECT_EQ(pyramid.data.size(), expected_offset);
+}
+
+// Test that level 0 is an exact copy of the source image
+TEST_F(image_pyramid_test, level_zero_is_source)
+{
+    auto image = createNoiseImage(10, 6, 3);
+    auto pyramid = tc::img::build_image_pyramid(image, 10, 6, 3, 2);
+
+    std::vector<std::uint8_t> level0(pyramid.level_data(0), pyramid.level_data(0) + pyramid.level_size(0));
+    EXPECT_EQ(level0, image);
+}
+
+// Test exact 2:1 averaging for the supported channel counts (SIMD and scalar tail paths)
+TEST_F(image_pyramid_test, exact_half_downscale)
+{
+    for (int channels : {1, 2, 3, 4})
+    {
+        const int width = 68, height = 36;
+        auto image = createNoiseImage(width, height, channels);
+        auto pyramid = tc::img::build_image_pyramid(image, width, height, channels, 3, 0.5);
+        ASSERT_EQ(pyramid.levels.size(), 3);
+
+        auto expected1 = referenceHalf(image, width, height, channels);
+        std::vector<std::uint8_t> level1(pyramid.level_data(1), pyramid.level_data(1) + pyramid.level_size(1));
+        EXPECT_EQ(level1, expected1) << "channels: " << channels;
+
+        // Level 2 must be derived from level 1
+        auto expected2 = referenceHalf(expected1, width / 2, height / 2, channels);
+        std::vector<std::uint8_t> level2(pyramid.level_data(2), pyramid.level_data(2) + pyramid.level_size(2));
+        EXPECT_EQ(level2, expected2) << "channels: " << channels;
+    }
+}
+
+// Test generic scale factor keeps uniform images uniform
+TEST_F(image_pyramid_test, generic_scale_factor_uniform_image)
+{
+    std::vector<std::uint8_t> image(100 * 80 * 3, 77);
+    auto pyramid = tc::img::build_image_pyramid(image, 100, 80, 3, 5, 0.8);
+
+    ASSERT_EQ(pyramid.levels.size(), 5);
+    EXPECT_EQ(pyramid.levels[1].width, 80);
+    EXPECT_EQ(pyramid.levels[1].height, 64);
+    for (auto value : pyramid.data)
+    {
+        EXPECT_EQ(value, 77);
+    }
+}
+
+// Test generic scale factor on a horizontal gradient stays monotonic and within range
+TEST_F(image_pyramid_test, generic_scale_factor_gradient)
+{
+    const int width = 120, height = 4;
+    std::vector<std::uint8_t> image(width * height);
+    for (int y = 0; y < height; ++y)
+        for (int x = 0; x < width; ++x)
+            image[y * width + x] = static_cast<std::uint8_t>(2 * x);
+
+    auto pyramid = tc::img::build_image_pyramid(image, width, height, 1, 2, 0.75);
+    ASSERT_EQ(pyramid.levels.size(), 2);
+
+    const auto& level = pyramid.levels[1];
+    const std::uint8_t* data = pyramid.level_data(1);
+    for (int x = 1; x < level.width; ++x)
+    {
+        EXPECT_GE(data[x], data[x - 1]);
+    }
+    EXPECT_LE(data[0], 4);
+    EXPECT_GE(data[level.width - 1], 234);
+}
+
+// Test that generation stops once a level would be empty
+TEST_F(image_pyramid_test, stops_before_empty_level)
+{
+    auto image = createNoiseImage(8, 4, 1);
+    auto pyramid = tc::img::build_image_pyramid(image, 8, 4, 1, 10);
+
+    ASSERT_EQ(pyramid.levels.size(), 3);
+    EXPECT_EQ(pyramid.levels.back().width, 2);
+    EXPECT_EQ(pyramid.levels.back().height, 1);
+}
+
+// Test in-place version reuses the output pyramid and matches the return version
+TEST_F(image_pyramid_test, in_place_consistency)
+{
+    auto image = createNoiseImage(48, 36, 3);
+    tc::img::image_pyramid pyramid;
+    tc::img::build_image_pyramid(createNoiseImage(200, 200, 4), 200, 200, 4, 6, 0.5, pyramid);
+    tc::img::build_image_pyramid(image, 48, 36, 3, 3, 0.7, pyramid);
+
+    auto expected = tc::img::build_image_pyramid(image, 48, 36, 3, 3, 0.7);
+    EXPECT_EQ(pyramid.channels, 3);
+    EXPECT_EQ(pyramid.levels.size(), expected.levels.size());
+    EXPECT_EQ(pyramid.data, expected.data);
+}
+
+// Test invalid arguments
+TEST_F(image_pyramid_test, invalid_arguments)
+{
+    auto image = createNoiseImage(8, 8, 3);
+    EXPECT_THROW(tc::img::build_image_pyramid(image, 8, 8, 3, 0), std::runtime_error);
+    EXPECT_THROW(tc::img::build_image_pyramid(image, 8, 8, 3, 2, 0.0), std::runtime_error);
+    EXPECT_THROW(tc::img::build_image_pyramid(image, 8, 8, 3, 2, 1.0), std::runtime_error);
+    EXPECT_THROW(tc::img::build_image_pyramid(image, 8, 8, 3, 1).level_data(1), std::out_of_range);
+}
+
+// Test image data not matching the declared size is rejected
+TEST_F(image_pyramid_test, mismatched_image_size)
+{
+    auto image = createNoiseImage(8, 8, 3);
+    tc::img::image_pyramid pyramid;
+    EXPECT_THROW(tc::img::build_image_pyramid(image, 16, 16, 3, 3), std::runtime_error);
+    EXPECT_THROW(tc::img::build_image_pyramid(image, 8, 8, 4, 3, 0.5, pyramid), std::runtime_error);
+    EXPECT_THROW(tc::img::build_image_pyramid(image, 4, 4, 3, 3), std::runtime_error);
+}
+
+// Test an image without pixels is rejected
+TEST_F(image_pyramid_test, empty_image)
+{
+    const std::vector<std::uint8_t> image;
+    EXPECT_THROW(tc::img::build_image_pyramid(image, 0, 0, 3, 3), std::runtime_error);
+    EXPECT_THROW(tc::img::build_image_pyramid(image, 8, 0, 3, 3), std::runtime_error);
+    EXPECT_THROW(tc::img::build_image_pyramid(image, 0, 8, 1, 1), std::runtime_error);
+}
+
+}
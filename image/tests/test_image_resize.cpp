@@ -21,6 +21,9 @@
 #include <cstdint>
 #include <filesystem>
 #include <gtest/gtest.h>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
 #include <vector>
 
 namespace tc::img::tests
@@ -263,6 +266,237 @@ TEST_F(image_resize_test, large_target_dimensions)
     EXPECT_EQ(output_image.size(), target_width * target_height * channels);
 }
 
+// Test per-channel pad value fills only the letterbox bands
+TEST_F(image_resize_test, per_channel_pad_value)
+{
+    // 4x2 image letterboxed into 4x4: one pad row above and below the content
+    auto input_image = createTestImage(4, 2, 3, 200);
+    const tc::img::letterbox_pad pad_value = {114, 115, 116};
+
+    auto output_image = tc::img::image_resize_aspect_ratio(input_image, 4, 2, 3, 4, 4, pad_value);
+    ASSERT_EQ(output_image.size(), 4 * 4 * 3);
+
+    for (int y = 0; y < 4; ++y)
+    {
+        for (int x = 0; x < 4; ++x)
+        {
+            for (int c = 0; c < 3; ++c)
+            {
+                const auto value = output_image[(y * 4 + x) * 3 + c];
+                const bool is_pad = (y == 0 || y == 3);
+                EXPECT_EQ(value, is_pad ? pad_value[c] : 200) << "at (" << x << ", " << y << ", " << c << ")";
+            }
+        }
+    }
+}
+
+// Test a named pad value selects the returning overload and is left untouched
+TEST_F(image_resize_test, named_pad_value_is_not_output)
+{
+    auto input_image = createTestImage(4, 2, 3, 200);
+    tc::img::letterbox_pad pad_value = {114, 115, 116};
+
+    const auto output_image = tc::img::image_resize_aspect_ratio(input_image, 4, 2, 3, 4, 4, pad_value);
+    EXPECT_EQ(output_image.size(), 4 * 4 * 3);
+    EXPECT_EQ(std::vector<std::uint8_t>(pad_value.begin(), pad_value.end()), (std::vector<std::uint8_t>{114, 115, 116}));
+
+    // A pad vector only ever binds to the output parameter, never to the pad value
+    static_assert(!std::is_convertible_v<const std::vector<std::uint8_t>&, tc::img::letterbox_pad>);
+}
+
+// Test left and right padding bands with a single broadcast pad value
+TEST_F(image_resize_test, single_pad_value_vertical_bands)
+{
+    // 2x4 image letterboxed into 4x4: one pad column on each side
+    auto input_image = createTestImage(2, 4, 1, 10);
+
+    auto output_image = tc::img::image_resize_aspect_ratio(input_image, 2, 4, 1, 4, 4, {255});
+    ASSERT_EQ(output_image.size(), 4 * 4);
+
+    for (int y = 0; y < 4; ++y)
+    {
+        EXPECT_EQ(output_image[y * 4 + 0], 255);
+        EXPECT_EQ(output_image[y * 4 + 1], 10);
+        EXPECT_EQ(output_image[y * 4 + 2], 10);
+        EXPECT_EQ(output_image[y * 4 + 3], 255);
+    }
+}
+
+// Test that a reused output buffer does not keep stale pixels in the padding
+TEST_F(image_resize_test, reused_buffer_padding_is_overwritten)
+{
+    auto input_image = createTestImage(4, 2, 3, 50);
+
+    // Dirty buffer with a different size than the expected output
+    std::vector<std::uint8_t> output_image(7, 99);
+    tc::img::image_resize_aspect_ratio(input_image, 4, 2, 3, 4, 4, output_image, {114, 114, 114});
+
+    ASSERT_EQ(output_image.size(), 4 * 4 * 3);
+    auto expected = tc::img::image_resize_aspect_ratio(input_image, 4, 2, 3, 4, 4, tc::img::letterbox_pad{114});
+    EXPECT_EQ(output_image, expected);
+    EXPECT_EQ(std::count(output_image.begin(), output_image.end(), 99), 0);
+}
+
+// Test that a pad value with a wrong number of components is rejected
+TEST_F(image_resize_test, invalid_pad_value_throws)
+{
+    auto input_image = createTestImage(4, 2, 3, 50);
+    std::vector<std::uint8_t> output_image;
+
+    EXPECT_THROW(tc::img::image_resize_aspect_ratio(input_image, 4, 2, 3, 4, 4, output_image, {1, 2}), std::runtime_error);
+    EXPECT_THROW(tc::img::image_resize_aspect_ratio(input_image, 4, 2, 3, 4, 4, tc::img::letterbox_pad{1, 2, 3, 4}), std::runtime_error);
+}
+
+// Test stretch resize ignores the aspect ratio and fills the whole target
+TEST_F(image_resize_test, stretch_resize)
+{
+    // 2x1 image: R=10 and R=200 pixels
+    std::vector<std::uint8_t> input_image = {10, 20, 30, 200, 210, 220};
+
+    auto output_image = tc::img::image_resize_stretch(input_image, 2, 1, 3, 4, 3);
+    ASSERT_EQ(output_image.size(), 4 * 3 * 3);
+
+    for (int y = 0; y < 3; ++y)
+    {
+        for (int x = 0; x < 4; ++x)
+        {
+            const std::uint8_t expected = x < 2 ? 10 : 200;
+            EXPECT_EQ(output_image[(y * 4 + x) * 3], expected) << "at (" << x << ", " << y << ")";
+        }
+    }
+
+    std::vector<std::uint8_t> output_void(1, 99);
+    tc::img::image_resize_stretch(input_image, 2, 1, 3, 4, 3, output_void);
+    EXPECT_EQ(output_void, output_image);
+}
+
+// Test center crop matches a full resize followed by a crop, without computing the discarded pixels
+TEST_F(image_resize_test, center_crop_matches_resize_then_crop)
+{
+    const int width = 40, height = 30, channels = 3;
+    auto input_image = createGradientImage(width, height, channels);
+
+    // Shorter side 30 -> 16: virtual resized image is 21x16, crop 12x12 starts at (4, 2)
+    const int resized_width = 21, resized_height = 16, crop = 12;
+    auto resized = tc::img::image_resize_stretch(input_image, width, height, channels, resized_width, resized_height);
+    auto cropped = tc::img::image_resize_center_crop(input_image, width, height, channels, 16, crop, crop);
+
+    ASSERT_EQ(cropped.size(), crop * crop * channels);
+    const int crop_x = (resized_width - crop) / 2, crop_y = (resized_height - crop) / 2;
+    for (int y = 0; y < crop; ++y)
+    {
+        for (int x = 0; x < crop * channels; ++x)
+        {
+            const auto expected = resized[((y + crop_y) * resized_width + crop_x) * channels + x];
+            EXPECT_EQ(cropped[y * crop * channels + x], expected) << "at (" << x << ", " << y << ")";
+        }
+    }
+}
+
+// Test center crop larger than the resized image pads the missing area
+TEST_F(image_resize_test, center_crop_larger_than_resized_image)
+{
+    // 4x2 image resized to 4x2 (shorter side 2), cropped to 4x4: one pad row above and below
+    auto input_image = createTestImage(4, 2, 1, 80);
+    std::vector<std::uint8_t> output_image;
+    tc::img::image_resize_center_crop(input_image, 4, 2, 1, 2, 4, 4, output_image, {7});
+
+    const std::vector<std::uint8_t> expected = {
+        7, 7, 7, 7,
+        80, 80, 80, 80,
+        80, 80, 80, 80,
+        7, 7, 7, 7};
+    EXPECT_EQ(output_image, expected);
+    EXPECT_THROW(tc::img::image_resize_center_crop(input_image, 4, 2, 1, 0, 4, 4), std::runtime_error);
+}
+
+// Test stretch and center crop resize reject a source image without pixels
+TEST_F(image_resize_test, stretch_and_center_crop_empty_source)
+{
+    const std::vector<std::uint8_t> empty_image;
+    std::vector<std::uint8_t> output_image;
+    EXPECT_THROW(tc::img::image_resize_stretch(empty_image, 0, 0, 3, 4, 4), std::runtime_error);
+    EXPECT_THROW(tc::img::image_resize_stretch(empty_image, 4, 0, 3, 4, 4, output_image), std::runtime_error);
+    EXPECT_THROW(tc::img::image_resize_stretch(empty_image, -1, 4, 3, 4, 4), std::runtime_error);
+
+    EXPECT_THROW(tc::img::image_resize_center_crop(empty_image, 0, 0, 3, 8, 4, 4), std::runtime_error);
+    EXPECT_THROW(tc::img::image_resize_center_crop(empty_image, 0, 4, 3, 8, 4, 4, output_image), std::runtime_error);
+    EXPECT_THROW(tc::img::image_resize_center_crop(empty_image, 4, -1, 3, 8, 4, 4), std::runtime_error);
+}
+
+// Test that cached plans stay consistent when many geometries are interleaved
+TEST_F(image_resize_test, plan_cache_interleaved_geometries)
+{
+    auto input_image = createGradientImage(16, 12, 3);
+    std::vector<std::vector<std::uint8_t>> first_pass;
+    for (int size = 2; size < 20; ++size)
+        first_pass.push_back(tc::img::image_resize_aspect_ratio(input_image, 16, 12, 3, size, size + 1));
+
+    for (int size = 19; size >= 2; --size)
+        EXPECT_EQ(tc::img::image_resize_aspect_ratio(input_image, 16, 12, 3, size, size + 1), first_pass[size - 2]) << "size: " << size;
+}
+
+// Test batch resize matches per-image resize for frames of different sizes
+TEST_F(image_resize_test, batch_resize_matches_single_resize)
+{
+    std::vector<std::tuple<std::vector<std::uint8_t>, int, int, int>> images = {
+        {createGradientImage(32, 24, 3), 32, 24, 3},
+        {createGradientImage(20, 40, 3), 20, 40, 3},
+        {createGradientImage(32, 24, 3), 32, 24, 3},
+        {createTestImage(7, 7, 3, 42), 7, 7, 3}};
+
+    const int target_width = 16, target_height = 12;
+    const tc::img::letterbox_pad pad_value = {114, 114, 114};
+    auto batch = tc::img::image_resize_aspect_ratio_batch(images, target_width, target_height, pad_value);
+
+    const std::size_t image_bytes = target_width * target_height * 3;
+    ASSERT_EQ(batch.size(), images.size() * image_bytes);
+    for (std::size_t n = 0; n < images.size(); ++n)
+    {
+        const auto& [image, width, height, channels] = images[n];
+        auto expected = tc::img::image_resize_aspect_ratio(image, width, height, channels, target_width, target_height, pad_value);
+        std::vector<std::uint8_t> actual(batch.begin() + n * image_bytes, batch.begin() + (n + 1) * image_bytes);
+        EXPECT_EQ(actual, expected) << "image: " << n;
+    }
+
+    std::vector<std::uint8_t> batch_void(3, 1);
+    tc::img::image_resize_aspect_ratio_batch(images, target_width, target_height, batch_void, pad_value);
+    EXPECT_EQ(batch_void, batch);
+}
+
+// Test batch resize validation and empty batches
+TEST_F(image_resize_test, batch_resize_invalid_and_empty)
+{
+    std::vector<std::tuple<std::vector<std::uint8_t>, int, int, int>> images = {
+        {createTestImage(4, 4, 3), 4, 4, 3},
+        {createTestImage(4, 4, 1), 4, 4, 1}};
+    EXPECT_THROW(tc::img::image_resize_aspect_ratio_batch(images, 2, 2), std::runtime_error);
+
+    std::vector<std::uint8_t> batch(10, 1);
+    tc::img::image_resize_aspect_ratio_batch({}, 2, 2, batch);
+    EXPECT_TRUE(batch.empty());
+}
+
+// Test every channel count samples the same pixels as a single channel resize of each plane
+TEST_F(image_resize_test, channel_counts_match_per_plane_resize)
+{
+    for (int channels = 1; channels <= 5; ++channels)
+    {
+        const auto image = createGradientImage(23, 11, channels);
+        const auto resized = tc::img::image_resize_aspect_ratio(image, 23, 11, channels, 16, 12, tc::img::letterbox_pad{std::vector<std::uint8_t>(channels, 7)});
+        for (int c = 0; c < channels; ++c)
+        {
+            std::vector<std::uint8_t> plane(23 * 11);
+            for (std::size_t i = 0; i < plane.size(); ++i)
+                plane[i] = image[i * channels + c];
+
+            const auto resized_plane = tc::img::image_resize_aspect_ratio(plane, 23, 11, 1, 16, 12, {7});
+            for (std::size_t i = 0; i < resized_plane.size(); ++i)
+                ASSERT_EQ(resized[i * channels + c], resized_plane[i]) << "channels " << channels << ", channel " << c << ", pixel " << i;
+        }
+    }
+}
+
 // === Real Image Resize Tests ===
 
 // Test resizing real landscape image with void version
@@ -0,0 +1,146 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <teiacare/image/image_rotate.hpp>
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace tc::img::tests
+{
+class image_rotate_test : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+    }
+    void TearDown() override
+    {
+    }
+
+    // Helper function to create a test image where every byte depends on its position
+    std::vector<std::uint8_t> createPatternImage(int width, int height, int channels)
+    {
+        std::vector<std::uint8_t> image(width * height * channels);
+        for (std::size_t i = 0; i < image.size(); ++i)
+            image[i] = static_cast<std::uint8_t>((i * 7 + i / 253) % 256);
+        return image;
+    }
+
+    // Helper function building the expected output by moving each pixel to the location given by map(x, y)
+    std::vector<std::uint8_t> referenceTransform(const std::vector<std::uint8_t>& image, int width, int height, int channels, int output_width, const std::function<std::array<int, 2>(int, int)>& map)
+    {
+        std::vector<std::uint8_t> output(image.size());
+        for (int y = 0; y < height; ++y)
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                const auto [ox, oy] = map(x, y);
+                for (int c = 0; c < channels; ++c)
+                    output[(oy * output_width + ox) * channels + c] = image[(y * width + x) * channels + c];
+            }
+        }
+        return output;
+    }
+
+    // Image sizes covering partial SIMD blocks and several cache tiles
+    const std::vector<std::array<int, 2>> sizes = {{1, 1}, {7, 3}, {16, 8}, {33, 17}, {130, 71}, {64, 64}, {100, 100}};
+};
+
+// Test horizontal and vertical flips against a reference implementation
+TEST_F(image_rotate_test, flips)
+{
+    for (int channels : {1, 2, 3, 4})
+    {
+        for (auto [width, height] : sizes)
+        {
+            auto image = createPatternImage(width, height, channels);
+            auto expected_h = referenceTransform(image, width, height, channels, width, [&](int x, int y) { return std::array<int, 2>{width - 1 - x, y}; });
+            auto expected_v = referenceTransform(image, width, height, channels, width, [&](int x, int y) { return std::array<int, 2>{x, height - 1 - y}; });
+            EXPECT_EQ(tc::img::flip_horizontal(image, width, height, channels), expected_h) << width << "x" << height << "x" << channels;
+            EXPECT_EQ(tc::img::flip_vertical(image, width, height, channels), expected_v) << width << "x" << height << "x" << channels;
+        }
+    }
+}
+
+// Test rotations and transposition against a reference implementation
+TEST_F(image_rotate_test, rotations_and_transpose)
+{
+    for (int channels : {1, 2, 3, 4})
+    {
+        for (auto [width, height] : sizes)
+        {
+            auto image = createPatternImage(width, height, channels);
+            auto expected_90 = referenceTransform(image, width, height, channels, height, [&](int x, int y) { return std::array<int, 2>{height - 1 - y, x}; });
+            auto expected_180 = referenceTransform(image, width, height, channels, width, [&](int x, int y) { return std::array<int, 2>{width - 1 - x, height - 1 - y}; });
+            auto expected_270 = referenceTransform(image, width, height, channels, height, [&](int x, int y) { return std::array<int, 2>{y, width - 1 - x}; });
+            auto expected_t = referenceTransform(image, width, height, channels, height, [&](int x, int y) { return std::array<int, 2>{y, x}; });
+            EXPECT_EQ(tc::img::rotate90(image, width, height, channels), expected_90) << width << "x" << height << "x" << channels;
+            EXPECT_EQ(tc::img::rotate180(image, width, height, channels), expected_180) << width << "x" << height << "x" << channels;
+            EXPECT_EQ(tc::img::rotate270(image, width, height, channels), expected_270) << width << "x" << height << "x" << channels;
+            EXPECT_EQ(tc::img::transpose(image, width, height, channels), expected_t) << width << "x" << height << "x" << channels;
+        }
+    }
+}
+
+// Test in-place operation, passing the input vector as output
+TEST_F(image_rotate_test, in_place)
+{
+    for (int channels : {1, 3, 4})
+    {
+        for (auto [width, height] : sizes)
+        {
+            const auto image = createPatternImage(width, height, channels);
+            const std::array<std::function<void(const std::vector<std::uint8_t>&, int, int, int, std::vector<std::uint8_t>&)>, 6> operations = {
+                [](const auto& in, int w, int h, int c, auto& out) { tc::img::flip_horizontal(in, w, h, c, out); },
+                [](const auto& in, int w, int h, int c, auto& out) { tc::img::flip_vertical(in, w, h, c, out); },
+                [](const auto& in, int w, int h, int c, auto& out) { tc::img::rotate90(in, w, h, c, out); },
+                [](const auto& in, int w, int h, int c, auto& out) { tc::img::rotate180(in, w, h, c, out); },
+                [](const auto& in, int w, int h, int c, auto& out) { tc::img::rotate270(in, w, h, c, out); },
+                [](const auto& in, int w, int h, int c, auto& out) { tc::img::transpose(in, w, h, c, out); }};
+
+            for (std::size_t op = 0; op < operations.size(); ++op)
+            {
+                std::vector<std::uint8_t> expected;
+                operations[op](image, width, height, channels, expected);
+
+                auto data = image;
+                operations[op](data, width, height, channels, data);
+                EXPECT_EQ(data, expected) << "operation " << op << ", " << width << "x" << height << "x" << channels;
+            }
+        }
+    }
+}
+
+// Test that composed transformations give back the original image
+TEST_F(image_rotate_test, round_trips)
+{
+    const int width = 97, height = 41;
+    auto image = createPatternImage(width, height, 3);
+    EXPECT_EQ(tc::img::rotate270(tc::img::rotate90(image, width, height, 3), height, width, 3), image);
+    EXPECT_EQ(tc::img::transpose(tc::img::transpose(image, width, height, 3), height, width, 3), image);
+    EXPECT_EQ(tc::img::rotate180(tc::img::rotate180(image, width, height, 3), width, height, 3), image);
+    EXPECT_EQ(tc::img::flip_vertical(tc::img::flip_horizontal(image, width, height, 3), width, height, 3), tc::img::rotate180(image, width, height, 3));
+
+    // Output buffers are resized to the expected size
+    std::vector<std::uint8_t> rotated(3, 0);
+    tc::img::rotate90(image, width, height, 3, rotated);
+    EXPECT_EQ(rotated.size(), image.size());
+    EXPECT_TRUE(tc::img::transpose(std::vector<std::uint8_t>{}, 0, 0, 3).empty());
+}
+
+}
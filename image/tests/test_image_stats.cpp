@@ -0,0 +1,156 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <teiacare/image/image_stats.hpp>
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace tc::img::tests
+{
+class image_stats_test : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+    }
+    void TearDown() override
+    {
+    }
+
+    static std::vector<std::uint8_t> random_image(std::size_t size, unsigned int seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<int> dist(20, 230);
+        std::vector<std::uint8_t> image(size);
+        for (auto& v : image)
+            v = static_cast<std::uint8_t>(dist(rng));
+        return image;
+    }
+};
+
+// Test the statistics of a small image computed by hand
+TEST_F(image_stats_test, known_values)
+{
+    const std::vector<std::uint8_t> image = {10, 200, 20, 200, 30, 100};
+    const auto stats = tc::img::image_stats(image, 2);
+    ASSERT_EQ(stats.size(), 2u);
+
+    EXPECT_EQ(stats[0].count, 3u);
+    EXPECT_EQ(stats[0].sum, 60u);
+    EXPECT_EQ(stats[0].sum_squares, 1400u);
+    EXPECT_EQ(stats[0].min, 10);
+    EXPECT_EQ(stats[0].max, 30);
+    EXPECT_DOUBLE_EQ(stats[0].mean(), 20.0);
+    EXPECT_NEAR(stats[0].variance(), 200.0 / 3.0, 1e-9);
+    EXPECT_EQ(stats[0].histogram[20], 1u);
+
+    EXPECT_EQ(stats[1].min, 100);
+    EXPECT_EQ(stats[1].max, 200);
+    EXPECT_EQ(stats[1].histogram[200], 2u);
+    EXPECT_EQ(stats[1].histogram[100], 1u);
+}
+
+// Test against a per-value reference, on images spanning several parallel blocks
+TEST_F(image_stats_test, matches_reference)
+{
+    for (int channels : {1, 2, 3, 4, 5})
+    {
+        const std::size_t pixels = 300007;
+        const auto image = random_image(pixels * channels, static_cast<unsigned int>(channels));
+        std::vector<tc::img::channel_stats> stats(1);
+        tc::img::image_stats(image, channels, stats);
+        ASSERT_EQ(stats.size(), static_cast<std::size_t>(channels));
+
+        for (int c = 0; c < channels; ++c)
+        {
+            std::vector<std::uint64_t> histogram(256, 0);
+            std::uint64_t sum = 0;
+            std::uint64_t sum_squares = 0;
+            std::uint8_t min = 255;
+            std::uint8_t max = 0;
+            for (std::size_t i = c; i < image.size(); i += channels)
+            {
+                const std::uint8_t v = image[i];
+                ++histogram[v];
+                sum += v;
+                sum_squares += static_cast<std::uint64_t>(v) * v;
+                min = std::min(min, v);
+                max = std::max(max, v);
+            }
+
+            EXPECT_EQ(stats[c].count, pixels);
+            EXPECT_EQ(stats[c].sum, sum);
+            EXPECT_EQ(stats[c].sum_squares, sum_squares);
+            EXPECT_EQ(stats[c].min, min);
+            EXPECT_EQ(stats[c].max, max);
+            EXPECT_TRUE(std::equal(histogram.begin(), histogram.end(), stats[c].histogram.begin())) << "channel " << c << " of " << channels;
+        }
+    }
+}
+
+// Test accumulating the statistics of several images
+TEST_F(image_stats_test, accumulate)
+{
+    const auto first = random_image(3000, 1);
+    auto second = random_image(1500, 2);
+    second[0] = 0;
+    second[1] = 255;
+
+    auto stats = tc::img::image_stats(first, 3);
+    const auto second_stats = tc::img::image_stats(second, 3);
+    for (int c = 0; c < 3; ++c)
+        stats[c] += second_stats[c];
+
+    auto both = first;
+    both.insert(both.end(), second.begin(), second.end());
+    const auto expected = tc::img::image_stats(both, 3);
+    for (int c = 0; c < 3; ++c)
+    {
+        EXPECT_EQ(stats[c].count, expected[c].count);
+        EXPECT_EQ(stats[c].sum, expected[c].sum);
+        EXPECT_EQ(stats[c].sum_squares, expected[c].sum_squares);
+        EXPECT_EQ(stats[c].min, expected[c].min);
+        EXPECT_EQ(stats[c].max, expected[c].max);
+        EXPECT_EQ(stats[c].histogram, expected[c].histogram);
+        EXPECT_NEAR(stats[c].std_dev(), expected[c].std_dev(), 1e-9);
+    }
+    EXPECT_EQ(stats[0].min, 0);
+    EXPECT_EQ(stats[1].max, 255);
+
+    tc::img::channel_stats empty;
+    empty += stats[2];
+    EXPECT_EQ(empty.min, stats[2].min);
+    EXPECT_EQ(empty.max, stats[2].max);
+}
+
+// Test empty images and invalid arguments
+TEST_F(image_stats_test, empty_and_invalid)
+{
+    const auto stats = tc::img::image_stats({}, 3);
+    ASSERT_EQ(stats.size(), 3u);
+    EXPECT_EQ(stats[0].count, 0u);
+    EXPECT_EQ(stats[0].mean(), 0.0);
+    EXPECT_EQ(stats[0].std_dev(), 0.0);
+
+    EXPECT_THROW(tc::img::image_stats(std::vector<std::uint8_t>(10), 3), std::runtime_error);
+    EXPECT_THROW(tc::img::image_stats(std::vector<std::uint8_t>(10), 0), std::runtime_error);
+}
+
+}
@@ -0,0 +1,150 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <teiacare/image/image_undistort.hpp>
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+namespace tc::img::tests
+{
+class image_undistort_test : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+    }
+    void TearDown() override
+    {
+    }
+
+    // Helper function to create a gradient test image
+    std::vector<std::uint8_t> createGradientImage(int width, int height, int channels)
+    {
+        std::vector<std::uint8_t> image(width * height * channels);
+        for (int y = 0; y < height; ++y)
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                for (int c = 0; c < channels; ++c)
+                {
+                    image[(y * width + x) * channels + c] = static_cast<std::uint8_t>((3 * x + 5 * y + c * 50) % 256);
+                }
+            }
+        }
+        return image;
+    }
+
+    // Helper function to decode the source coordinate stored in a plan for the output pixel (x, y)
+    std::array<double, 2> planCoordinate(const tc::img::remap_plan& plan, int x, int y)
+    {
+        const std::size_t index = static_cast<std::size_t>(y) * plan.width + x;
+        const std::uint16_t weight = plan.weights[index];
+        return {plan.coords[2 * index] + (weight & 0xFF) / 256.0, plan.coords[2 * index + 1] + (weight >> 8) / 256.0};
+    }
+
+    const tc::img::camera_intrinsics camera{400.0, 380.0, 160.5, 120.25};
+};
+
+// Test that a camera without distortion gives the identity remap
+TEST_F(image_undistort_test, no_distortion_is_identity)
+{
+    const int width = 40, height = 30;
+    const tc::img::camera_intrinsics small_camera{50.0, 50.0, 20.0, 15.0};
+    auto plan = tc::img::make_undistort_remap_plan(small_camera, tc::img::brown_conrady_distortion{}, small_camera, width, height);
+    for (int channels : {1, 3, 4})
+    {
+        auto image = createGradientImage(width, height, channels);
+        EXPECT_EQ(tc::img::remap(image, width, height, channels, plan), image) << "channels: " << channels;
+    }
+}
+
+// Test Brown-Conrady plan coordinates against the lens model
+TEST_F(image_undistort_test, brown_conrady_coordinates)
+{
+    const tc::img::brown_conrady_distortion distortion{-0.28, 0.07, 0.001, -0.0005, 0.0};
+    auto plan = tc::img::make_undistort_remap_plan(camera, distortion, camera, 320, 240);
+    ASSERT_EQ(plan.width, 320);
+    ASSERT_EQ(plan.height, 240);
+
+    for (auto [x, y] : std::vector<std::array<int, 2>>{{0, 0}, {160, 120}, {319, 0}, {37, 201}, {319, 239}})
+    {
+        const double nx = (x - camera.cx) / camera.fx, ny = (y - camera.cy) / camera.fy;
+        const double r2 = nx * nx + ny * ny;
+        const double radial = 1.0 + distortion.k1 * r2 + distortion.k2 * r2 * r2;
+        const double dx = nx * radial + 2.0 * distortion.p1 * nx * ny + distortion.p2 * (r2 + 2.0 * nx * nx);
+        const double dy = ny * radial + distortion.p1 * (r2 + 2.0 * ny * ny) + 2.0 * distortion.p2 * nx * ny;
+
+        const auto coordinate = planCoordinate(plan, x, y);
+        EXPECT_NEAR(coordinate[0], camera.fx * dx + camera.cx, 1.0 / 256) << "x: " << x << ", y: " << y;
+        EXPECT_NEAR(coordinate[1], camera.fy * dy + camera.cy, 1.0 / 256) << "x: " << x << ", y: " << y;
+    }
+}
+
+// Test fisheye plan coordinates against the equidistant lens model
+TEST_F(image_undistort_test, fisheye_coordinates)
+{
+    const tc::img::fisheye_distortion distortion{0.05, -0.01, 0.002, 0.0};
+    const tc::img::camera_intrinsics new_camera{200.0, 190.0, 160.0, 120.0};
+    auto plan = tc::img::make_undistort_remap_plan(camera, distortion, new_camera, 320, 240, tc::img::interpolation::bilinear);
+
+    for (auto [x, y] : std::vector<std::array<int, 2>>{{160, 120}, {0, 0}, {300, 17}, {90, 230}})
+    {
+        const double nx = (x - new_camera.cx) / new_camera.fx, ny = (y - new_camera.cy) / new_camera.fy;
+        const double r = std::sqrt(nx * nx + ny * ny);
+        const double theta = std::atan(r);
+        const double t2 = theta * theta;
+        const double theta_d = theta * (1.0 + distortion.k1 * t2 + distortion.k2 * t2 * t2 + distortion.k3 * t2 * t2 * t2);
+        const double scale = r > 0.0 ? theta_d / r : 1.0;
+
+        const auto coordinate = planCoordinate(plan, x, y);
+        EXPECT_NEAR(coordinate[0], camera.fx * nx * scale + camera.cx, 1.0 / 256) << "x: " << x << ", y: " << y;
+        EXPECT_NEAR(coordinate[1], camera.fy * ny * scale + camera.cy, 1.0 / 256) << "x: " << x << ", y: " << y;
+    }
+}
+
+// Test undistortion with nearest interpolation and a constant border
+TEST_F(image_undistort_test, nearest_and_border)
+{
+    const int width = 64, height = 48;
+    const tc::img::camera_intrinsics small_camera{60.0, 60.0, 32.0, 24.0};
+    const tc::img::camera_intrinsics wide_camera{20.0, 20.0, 32.0, 24.0};
+    auto plan = tc::img::make_undistort_remap_plan(small_camera, tc::img::fisheye_distortion{}, wide_camera, width, height, tc::img::interpolation::nearest);
+    EXPECT_EQ(plan.interp, tc::img::interpolation::nearest);
+
+    auto image = createGradientImage(width, height, 3);
+    auto undistorted = tc::img::remap(image, width, height, 3, plan, tc::img::border_mode::constant, {1, 2, 3});
+    ASSERT_EQ(undistorted.size(), image.size());
+
+    // The principal point maps onto itself, while corners of the wide view fall outside the source image
+    for (int c = 0; c < 3; ++c)
+    {
+        EXPECT_EQ(undistorted[(24 * width + 32) * 3 + c], image[(24 * width + 32) * 3 + c]);
+        EXPECT_EQ(undistorted[c], c + 1);
+    }
+}
+
+// Test invalid camera intrinsics
+TEST_F(image_undistort_test, invalid_intrinsics)
+{
+    const tc::img::camera_intrinsics invalid{0.0, 100.0, 10.0, 10.0};
+    EXPECT_THROW(tc::img::make_undistort_remap_plan(invalid, tc::img::brown_conrady_distortion{}, camera, 8, 8), std::runtime_error);
+    EXPECT_THROW(tc::img::make_undistort_remap_plan(camera, tc::img::fisheye_distortion{}, invalid, 8, 8), std::runtime_error);
+}
+
+}
@@ -0,0 +1,234 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <teiacare/image/basic_image.hpp>
+#include <teiacare/image/image_draw.hpp>
+#include <teiacare/image/image_processing.hpp>
+#include <teiacare/image/image_resize.hpp>
+#include <teiacare/image/image_view.hpp>
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace tc::img::tests
+{
+class image_view_test : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+    }
+    void TearDown() override
+    {
+    }
+
+    static std::vector<std::uint8_t> create_pixels(int width, int height, int channels)
+    {
+        std::vector<std::uint8_t> pixels(static_cast<std::size_t>(width) * height * channels);
+        for (std::size_t i = 0; i < pixels.size(); ++i)
+            pixels[i] = static_cast<std::uint8_t>(i * 7 + 1);
+        return pixels;
+    }
+
+    // Copy of the region of a packed image, as the reference for the functions taking a strided view of it
+    static std::vector<std::uint8_t> crop_pixels(const std::vector<std::uint8_t>& pixels, int width, int channels, int x, int y, int crop_width, int crop_height)
+    {
+        std::vector<std::uint8_t> crop;
+        for (int row = y; row < y + crop_height; ++row)
+        {
+            const auto first = pixels.begin() + (static_cast<std::size_t>(row) * width + x) * channels;
+            crop.insert(crop.end(), first, first + static_cast<std::size_t>(crop_width) * channels);
+        }
+        return crop;
+    }
+};
+
+// Test tc::img::image_view geometry of packed and padded buffers
+TEST_F(image_view_test, view_geometry)
+{
+    const auto pixels = create_pixels(5, 4, 3);
+    const tc::img::image_view packed{pixels, 5, 4, 3};
+    EXPECT_EQ(packed.stride(), 15u);
+    EXPECT_EQ(packed.row_size(), 15u);
+    EXPECT_TRUE(packed.is_contiguous());
+    EXPECT_EQ(packed.row(2), pixels.data() + 30);
+    EXPECT_EQ(packed.pixel(1, 2), pixels.data() + 33);
+
+    const tc::img::image_view padded{pixels.data(), 4, 4, 3, 15};
+    EXPECT_EQ(padded.stride(), 15u);
+    EXPECT_EQ(padded.row_size(), 12u);
+    EXPECT_FALSE(padded.is_contiguous());
+    EXPECT_EQ(padded.pixel(3, 1), pixels.data() + 24);
+}
+
+// Test tc::img::image_view subviews share the pixels and the stride of their parent
+TEST_F(image_view_test, subview)
+{
+    auto pixels = create_pixels(6, 5, 3);
+    const tc::img::image_span span{pixels, 6, 5, 3};
+    const auto crop = span.subview(2, 1, 3, 2);
+    EXPECT_EQ(crop.width(), 3);
+    EXPECT_EQ(crop.height(), 2);
+    EXPECT_EQ(crop.stride(), 18u);
+    EXPECT_EQ(crop.data(), pixels.data() + 18 + 6);
+
+    crop.pixel(0, 0)[0] = 42;
+    EXPECT_EQ(pixels[24], 42);
+
+    const tc::img::image_view view = crop;
+    EXPECT_EQ(view.pixel(2, 1), pixels.data() + 36 + 12);
+    EXPECT_EQ(view.subview(1, 1, 2, 1).data(), pixels.data() + 36 + 9);
+}
+
+// Test tc::img::image_view invalid arguments
+TEST_F(image_view_test, invalid_view)
+{
+    const auto pixels = create_pixels(4, 4, 3);
+    EXPECT_THROW((tc::img::image_view{pixels, 4, 4, 4}), std::runtime_error);
+    EXPECT_THROW((tc::img::image_view{pixels.data(), 4, 4, 3, 8}), std::runtime_error);
+    EXPECT_THROW((tc::img::image_view{pixels.data(), -1, 4, 3}), std::runtime_error);
+    EXPECT_THROW((tc::img::image_view{pixels.data(), 4, 4, 0}), std::runtime_error);
+    EXPECT_THROW((tc::img::image_view{nullptr, 4, 4, 3}), std::runtime_error);
+
+    const tc::img::image_view view{pixels, 4, 4, 3};
+    EXPECT_THROW(view.subview(2, 2, 3, 1), std::runtime_error);
+    EXPECT_THROW(view.subview(-1, 0, 1, 1), std::runtime_error);
+    EXPECT_NO_THROW(view.subview(4, 4, 0, 0));
+}
+
+// Test tc::img::image ownership and copy of strided views
+TEST_F(image_view_test, owning_image)
+{
+    const tc::img::image blank(3, 2, 4, 9);
+    EXPECT_EQ(blank.size(), 24u);
+    EXPECT_EQ(blank.vector(), std::vector<std::uint8_t>(24, 9));
+
+    const auto pixels = create_pixels(6, 5, 3);
+    const tc::img::image_view view{pixels, 6, 5, 3};
+    const tc::img::image crop{view.subview(1, 2, 4, 3)};
+    EXPECT_EQ(crop.width(), 4);
+    EXPECT_EQ(crop.height(), 3);
+    EXPECT_EQ(crop.stride(), 12u);
+    EXPECT_EQ(crop.vector(), crop_pixels(pixels, 6, 3, 1, 2, 4, 3));
+
+    tc::img::image owned{pixels, 6, 5, 3};
+    EXPECT_EQ(owned, tc::img::image{view});
+    EXPECT_EQ(owned.release(), pixels);
+    EXPECT_TRUE(owned.empty());
+    EXPECT_EQ(owned.width(), 0);
+
+    EXPECT_THROW((tc::img::image{pixels, 6, 5, 4}), std::runtime_error);
+    EXPECT_THROW((tc::img::image{-1, 5, 3}), std::runtime_error);
+}
+
+// Test tc::img::image_resize_aspect_ratio on a crop matches the resize of the copied crop
+TEST_F(image_view_test, resize_crop)
+{
+    const auto pixels = create_pixels(32, 24, 3);
+    const tc::img::image_view crop = tc::img::image_view{pixels, 32, 24, 3}.subview(5, 3, 20, 12);
+    const auto expected = tc::img::image_resize_aspect_ratio(crop_pixels(pixels, 32, 3, 5, 3, 20, 12), 20, 12, 3, 16, 16, {114, 115, 116});
+
+    const auto resized = tc::img::image_resize_aspect_ratio(crop, 16, 16, {114, 115, 116});
+    EXPECT_EQ(resized.width(), 16);
+    EXPECT_EQ(resized.height(), 16);
+    EXPECT_EQ(resized.vector(), expected);
+}
+
+// Test tc::img::image_resize_aspect_ratio writes only the target region of a strided output
+TEST_F(image_view_test, resize_into_span)
+{
+    const auto pixels = create_pixels(9, 7, 4);
+    const auto expected = tc::img::image_resize_aspect_ratio(pixels, 9, 7, 4, 8, 6);
+
+    std::vector<std::uint8_t> canvas(12 * 10 * 4, 7);
+    tc::img::image_span canvas_span{canvas, 12, 10, 4};
+    tc::img::image_resize_aspect_ratio(tc::img::image_view{pixels, 9, 7, 4}, canvas_span.subview(2, 3, 8, 6));
+
+    EXPECT_EQ(crop_pixels(canvas, 12, 4, 2, 3, 8, 6), expected);
+    std::size_t untouched = 0;
+    for (std::uint8_t value : canvas)
+        untouched += value == 7;
+    EXPECT_GE(untouched, canvas.size() - expected.size());
+    EXPECT_EQ(canvas[0], 7);
+    EXPECT_EQ(canvas.back(), 7);
+
+    std::vector<std::uint8_t> gray(8 * 6);
+    EXPECT_THROW(tc::img::image_resize_aspect_ratio(tc::img::image_view{pixels, 9, 7, 4}, tc::img::image_span{gray, 8, 6, 1}), std::runtime_error);
+}
+
+// Test tc::img::create_blob on a crop matches the blob of the copied crop for every element type and layout
+TEST_F(image_view_test, create_blob_crop)
+{
+    for (int channels : {1, 3, 4, 5})
+    {
+        const auto pixels = create_pixels(40, 9, channels);
+        const tc::img::image_view crop = tc::img::image_view{pixels, 40, 9, channels}.subview(3, 2, 33, 6);
+        const auto packed = crop_pixels(pixels, 40, channels, 3, 2, 33, 6);
+        const bool swap = channels >= 3;
+        for (auto layout : {tc::img::blob_layout::nchw, tc::img::blob_layout::nhwc})
+        {
+            const std::vector<float> mean{0.1f, 0.2f, 0.3f};
+            EXPECT_EQ(tc::img::create_blob<float>(crop, 1.0f / 255.0f, mean, swap, {}, layout), tc::img::create_blob<float>(packed, 33, 6, channels, 1.0f / 255.0f, mean, swap, {}, layout));
+            EXPECT_EQ(tc::img::create_blob<double>(crop, 0.5, {1.0}, swap, {}, layout), tc::img::create_blob<double>(packed, 33, 6, channels, 0.5, {1.0}, swap, {}, layout));
+            EXPECT_EQ(tc::img::create_blob<tc::img::float16>(crop, 1.0f / 255.0f, mean, swap, {}, layout), tc::img::create_blob<tc::img::float16>(packed, 33, 6, channels, 1.0f / 255.0f, mean, swap, {}, layout));
+
+            std::vector<float> blob;
+            tc::img::create_blob(crop, blob, 1.0f, {}, false, {}, layout);
+            const auto expected = tc::img::create_blob<float>(packed, 33, 6, channels, 1.0f, {}, false, {}, layout);
+            EXPECT_TRUE(std::equal(blob.begin(), blob.end(), expected.begin(), expected.end()));
+        }
+    }
+}
+
+// Test tc::img::draw_rectangle on a crop draws in crop coordinates and clips to the crop
+TEST_F(image_view_test, draw_crop)
+{
+    tc::img::image canvas(10, 8, 4);
+    const auto red = tc::img::color::red();
+    tc::img::draw_rectangle(canvas.span().subview(2, 2, 4, 3), -1, 0, 6, 3, red);
+
+    for (int y = 0; y < 8; ++y)
+    {
+        for (int x = 0; x < 10; ++x)
+        {
+            const bool inside = x >= 2 && x < 6 && y >= 2 && y < 5;
+            const bool border = inside && (y == 2 || y == 4);
+            const std::uint8_t* pixel = canvas.row(y) + x * 4;
+            EXPECT_EQ(pixel[0], border ? 255 : 0) << x << "," << y;
+            EXPECT_EQ(pixel[3], 0) << x << "," << y;
+        }
+    }
+
+    tc::img::image gray(4, 4, 1);
+    EXPECT_THROW(tc::img::draw_line(gray, 0, 0, 3, 3, red), std::runtime_error);
+}
+
+// Test tc::img::overlay_mask on a crop matches the overlay of the copied crop
+TEST_F(image_view_test, overlay_mask_crop)
+{
+    auto pixels = create_pixels(20, 10, 3);
+    auto packed = crop_pixels(pixels, 20, 3, 4, 1, 13, 7);
+    const std::vector<std::uint8_t> mask{0, 1, 2, 1, 0, 2};
+    const std::vector<tc::img::color> palette{tc::img::color::red(), tc::img::color::green(), tc::img::color::blue()};
+
+    tc::img::overlay_mask(packed, 13, 7, 3, mask, 3, 2, palette, 0.6f);
+    tc::img::overlay_mask(tc::img::image_span{pixels, 20, 10, 3}.subview(4, 1, 13, 7), mask, 3, 2, palette, 0.6f);
+    EXPECT_EQ(crop_pixels(pixels, 20, 3, 4, 1, 13, 7), packed);
+    EXPECT_EQ(pixels[0], 1);
+}
+
+}
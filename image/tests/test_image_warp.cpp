@@ -0,0 +1,369 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <teiacare/image/image_warp.hpp>
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+namespace tc::img::tests
+{
+class image_warp_test : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+    }
+    void TearDown() override
+    {
+    }
+
+    // Helper function to create a gradient test image
+    std::vector<std::uint8_t> createGradientImage(int width, int height, int channels)
+    {
+        std::vector<std::uint8_t> image(width * height * channels);
+        for (int y = 0; y < height; ++y)
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                for (int c = 0; c < channels; ++c)
+                {
+                    image[(y * width + x) * channels + c] = static_cast<std::uint8_t>((3 * x + 5 * y + c * 50) % 256);
+                }
+            }
+        }
+        return image;
+    }
+
+    static constexpr std::array<double, 6> identity = {1.0, 0.0, 0.0, 0.0, 1.0, 0.0};
+};
+
+// Test identity transform with both interpolation methods
+TEST_F(image_warp_test, identity_transform)
+{
+    for (int channels : {1, 3, 4})
+    {
+        auto image = createGradientImage(37, 21, channels);
+        auto bilinear = tc::img::warp_affine(image, 37, 21, channels, identity, 37, 21);
+        auto nearest = tc::img::warp_affine(image, 37, 21, channels, identity, 37, 21, tc::img::interpolation::nearest);
+        EXPECT_EQ(bilinear, image) << "channels: " << channels;
+        EXPECT_EQ(nearest, image) << "channels: " << channels;
+    }
+}
+
+// Test integer translation with a constant per-channel border value
+TEST_F(image_warp_test, translation_constant_border)
+{
+    auto image = createGradientImage(8, 6, 3);
+    const std::array<double, 6> translation = {1.0, 0.0, 2.0, 0.0, 1.0, 1.0};
+    auto warped = tc::img::warp_affine(image, 8, 6, 3, translation, 8, 6, tc::img::interpolation::bilinear, tc::img::border_mode::constant, {1, 2, 3});
+
+    ASSERT_EQ(warped.size(), image.size());
+    for (int y = 0; y < 6; ++y)
+    {
+        for (int x = 0; x < 8; ++x)
+        {
+            for (int c = 0; c < 3; ++c)
+            {
+                const auto value = warped[(y * 8 + x) * 3 + c];
+                if (x < 2 || y < 1)
+                    EXPECT_EQ(value, c + 1) << "at (" << x << ", " << y << ")";
+                else
+                    EXPECT_EQ(value, image[((y - 1) * 8 + (x - 2)) * 3 + c]) << "at (" << x << ", " << y << ")";
+            }
+        }
+    }
+}
+
+// Test replicate border repeats the edge pixels
+TEST_F(image_warp_test, translation_replicate_border)
+{
+    auto image = createGradientImage(5, 5, 1);
+    const std::array<double, 6> translation = {1.0, 0.0, -3.0, 0.0, 1.0, 0.0};
+    auto warped = tc::img::warp_affine(image, 5, 5, 1, translation, 5, 5, tc::img::interpolation::nearest, tc::img::border_mode::replicate);
+
+    for (int y = 0; y < 5; ++y)
+    {
+        EXPECT_EQ(warped[y * 5 + 0], image[y * 5 + 3]);
+        EXPECT_EQ(warped[y * 5 + 1], image[y * 5 + 4]);
+        for (int x = 2; x < 5; ++x)
+            EXPECT_EQ(warped[y * 5 + x], image[y * 5 + 4]);
+    }
+}
+
+// Test 90 degrees rotation around the image center
+TEST_F(image_warp_test, rotation_90_degrees)
+{
+    const int size = 9;
+    auto image = createGradientImage(size, size, 3);
+    const double center = (size - 1) / 2.0;
+    auto matrix = tc::img::rotation_matrix(center, center, 90.0);
+    auto warped = tc::img::warp_affine(image, size, size, 3, matrix, size, size);
+
+    // Counter-clockwise rotation: destination (x, y) reads source (size - 1 - y, x)
+    for (int y = 0; y < size; ++y)
+    {
+        for (int x = 0; x < size; ++x)
+        {
+            for (int c = 0; c < 3; ++c)
+            {
+                EXPECT_EQ(warped[(y * size + x) * 3 + c], image[(x * size + (size - 1 - y)) * 3 + c]) << "at (" << x << ", " << y << ")";
+            }
+        }
+    }
+}
+
+// Test sub-pixel bilinear interpolation
+TEST_F(image_warp_test, half_pixel_shift)
+{
+    std::vector<std::uint8_t> image = {0, 100, 200, 0, 100, 200};
+    const std::array<double, 6> translation = {1.0, 0.0, -0.5, 0.0, 1.0, 0.0};
+    auto warped = tc::img::warp_affine(image, 3, 2, 1, translation, 2, 2, tc::img::interpolation::bilinear, tc::img::border_mode::replicate);
+
+    const std::vector<std::uint8_t> expected = {50, 150, 50, 150};
+    EXPECT_EQ(warped, expected);
+}
+
+// Test generic affine transform against a floating point reference
+TEST_F(image_warp_test, matches_floating_point_reference)
+{
+    const int width = 300, height = 200;
+    auto image = createGradientImage(width, height, 3);
+    auto matrix = tc::img::rotation_matrix(140.0, 90.0, 17.0, 0.8);
+    matrix[2] += 3.25;
+
+    std::vector<std::uint8_t> warped(5, 0);
+    tc::img::warp_affine(image, width, height, 3, matrix, width, height, warped, tc::img::interpolation::bilinear, tc::img::border_mode::reflect);
+    ASSERT_EQ(warped.size(), image.size());
+
+    const double det = matrix[0] * matrix[4] - matrix[1] * matrix[3];
+    const std::array<double, 6> inv = {
+        matrix[4] / det, -matrix[1] / det, (matrix[1] * matrix[5] - matrix[4] * matrix[2]) / det,
+        -matrix[3] / det, matrix[0] / det, (matrix[3] * matrix[2] - matrix[0] * matrix[5]) / det};
+
+    int mismatches = 0;
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            const double sx = inv[0] * x + inv[1] * y + inv[2];
+            const double sy = inv[3] * x + inv[4] * y + inv[5];
+            const int x0 = static_cast<int>(std::floor(sx)), y0 = static_cast<int>(std::floor(sy));
+            if (x0 < 0 || y0 < 0 || x0 + 1 >= width || y0 + 1 >= height)
+                continue;
+
+            const double fx = sx - x0, fy = sy - y0;
+            for (int c = 0; c < 3; ++c)
+            {
+                const auto at = [&](int xx, int yy) { return static_cast<double>(image[(yy * width + xx) * 3 + c]); };
+                const double expected = (at(x0, y0) * (1 - fx) + at(x0 + 1, y0) * fx) * (1 - fy) + (at(x0, y0 + 1) * (1 - fx) + at(x0 + 1, y0 + 1) * fx) * fy;
+                const double diff = std::abs(expected - warped[(y * width + x) * 3 + c]);
+                // Gradient steps of 5 per pixel bound the error of the 8-bit weights, apart from wrap-around discontinuities
+                if (diff > 3.0)
+                    ++mismatches;
+            }
+        }
+    }
+    EXPECT_LT(mismatches, width * height * 3 / 50);
+}
+
+// Test reflect and wrap borders on a single row
+TEST_F(image_warp_test, reflect_and_wrap_borders)
+{
+    std::vector<std::uint8_t> image = {10, 20, 30, 40};
+    const std::array<double, 6> translation = {1.0, 0.0, 3.0, 0.0, 1.0, 0.0};
+
+    auto reflected = tc::img::warp_affine(image, 4, 1, 1, translation, 10, 1, tc::img::interpolation::nearest, tc::img::border_mode::reflect);
+    const std::vector<std::uint8_t> expected_reflect = {40, 30, 20, 10, 20, 30, 40, 30, 20, 10};
+    EXPECT_EQ(reflected, expected_reflect);
+
+    auto wrapped = tc::img::warp_affine(image, 4, 1, 1, translation, 10, 1, tc::img::interpolation::nearest, tc::img::border_mode::wrap);
+    const std::vector<std::uint8_t> expected_wrap = {20, 30, 40, 10, 20, 30, 40, 10, 20, 30};
+    EXPECT_EQ(wrapped, expected_wrap);
+}
+
+// Test an empty source image samples as the border value with every interpolation and border mode
+TEST_F(image_warp_test, empty_source_is_all_border)
+{
+    const std::vector<std::uint8_t> empty;
+    const std::vector<std::uint8_t> expected(4 * 4 * 3, 7);
+    for (auto interp : {tc::img::interpolation::nearest, tc::img::interpolation::bilinear})
+    {
+        for (auto border : {tc::img::border_mode::constant, tc::img::border_mode::replicate, tc::img::border_mode::reflect, tc::img::border_mode::wrap})
+        {
+            EXPECT_EQ(tc::img::warp_affine(empty, 0, 0, 3, identity, 4, 4, interp, border, {7}), expected) << static_cast<int>(interp) << " " << static_cast<int>(border);
+        }
+    }
+}
+
+// Test invalid arguments
+TEST_F(image_warp_test, invalid_arguments)
+{
+    auto image = createGradientImage(4, 4, 3);
+    const std::array<double, 6> singular = {1.0, 2.0, 0.0, 2.0, 4.0, 0.0};
+    EXPECT_THROW(tc::img::warp_affine(image, 4, 4, 3, singular, 4, 4), std::runtime_error);
+    EXPECT_THROW(tc::img::warp_affine(image, 4, 4, 3, identity, 4, 4, tc::img::interpolation::bilinear, tc::img::border_mode::constant, {1, 2}), std::runtime_error);
+}
+
+// Test perspective warp with the identity homography
+TEST_F(image_warp_test, perspective_identity)
+{
+    const std::array<double, 9> identity3 = {1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
+    for (int channels : {1, 2, 3, 4})
+    {
+        auto image = createGradientImage(41, 23, channels);
+        auto bilinear = tc::img::warp_perspective(image, 41, 23, channels, identity3, 41, 23);
+        auto nearest = tc::img::warp_perspective(image, 41, 23, channels, identity3, 41, 23, tc::img::interpolation::nearest);
+        EXPECT_EQ(bilinear, image) << "channels: " << channels;
+        EXPECT_EQ(nearest, image) << "channels: " << channels;
+    }
+}
+
+// Test that an affine homography gives the same result as warp_affine
+TEST_F(image_warp_test, perspective_matches_affine)
+{
+    const int width = 120, height = 80;
+    auto image = createGradientImage(width, height, 3);
+    const std::array<double, 6> affine = {1.0, 0.0, 7.0, 0.0, 1.0, -4.0};
+    const std::array<double, 9> homography = {1.0, 0.0, 7.0, 0.0, 1.0, -4.0, 0.0, 0.0, 1.0};
+
+    auto expected = tc::img::warp_affine(image, width, height, 3, affine, width, height, tc::img::interpolation::bilinear, tc::img::border_mode::replicate);
+    auto warped = tc::img::warp_perspective(image, width, height, 3, homography, width, height, tc::img::interpolation::bilinear, tc::img::border_mode::replicate);
+    EXPECT_EQ(warped, expected);
+}
+
+// Test that a remap plan can be reused across frames and matches warp_perspective
+TEST_F(image_warp_test, remap_plan_reuse)
+{
+    const int width = 64, height = 48;
+    const std::array<double, 9> homography = {0.9, 0.1, 3.0, -0.05, 1.1, 2.0, 0.0005, 0.0008, 1.0};
+    auto plan = tc::img::make_perspective_remap_plan(homography, 50, 40);
+    EXPECT_EQ(plan.width, 50);
+    EXPECT_EQ(plan.height, 40);
+    EXPECT_EQ(plan.coords.size(), 2u * 50 * 40);
+    EXPECT_EQ(plan.weights.size(), 50u * 40);
+
+    for (int channels : {1, 3, 4})
+    {
+        auto image = createGradientImage(width, height, channels);
+        std::vector<std::uint8_t> remapped;
+        tc::img::remap(image, width, height, channels, plan, remapped, tc::img::border_mode::constant, {9});
+        auto expected = tc::img::warp_perspective(image, width, height, channels, homography, 50, 40, tc::img::interpolation::bilinear, tc::img::border_mode::constant, {9});
+        EXPECT_EQ(remapped, expected) << "channels: " << channels;
+        EXPECT_EQ(tc::img::remap(image, width, height, channels, plan, tc::img::border_mode::constant, {9}), expected) << "channels: " << channels;
+    }
+}
+
+// Test remap rejects a plan whose maps do not match its size and samples an empty source as border
+TEST_F(image_warp_test, remap_invalid_plan_and_empty_source)
+{
+    const std::array<double, 9> homography = {1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
+    auto image = createGradientImage(8, 8, 3);
+
+    auto plan = tc::img::make_perspective_remap_plan(homography, 5, 3);
+    plan.width = 6;
+    EXPECT_THROW(tc::img::remap(image, 8, 8, 3, plan), std::runtime_error);
+
+    plan = tc::img::make_perspective_remap_plan(homography, 5, 3);
+    plan.weights.pop_back();
+    EXPECT_THROW(tc::img::remap(image, 8, 8, 3, plan), std::runtime_error);
+
+    plan = tc::img::make_perspective_remap_plan(homography, 5, 3);
+    EXPECT_EQ(tc::img::remap({}, 0, 0, 3, plan, tc::img::border_mode::replicate, {4}), std::vector<std::uint8_t>(5 * 3 * 3, 4));
+}
+
+// Test the warps give the same result when run inline by a sequential executor
+TEST_F(image_warp_test, sequential_executor)
+{
+    const int width = 64, height = 48;
+    auto image = createGradientImage(width, height, 3);
+    const auto affine = tc::img::rotation_matrix(32.0, 24.0, 30.0, 0.8);
+    const std::array<double, 9> homography = {0.9, 0.1, 3.0, -0.05, 1.1, 2.0, 0.0005, 0.0008, 1.0};
+
+    tc::img::sequential_executor sequential;
+    EXPECT_EQ(tc::img::warp_affine(image, width, height, 3, affine, 50, 40, tc::img::interpolation::bilinear, tc::img::border_mode::constant, {0}, sequential),
+              tc::img::warp_affine(image, width, height, 3, affine, 50, 40));
+    EXPECT_EQ(tc::img::warp_perspective(image, width, height, 3, homography, 50, 40, tc::img::interpolation::bilinear, tc::img::border_mode::constant, {0}, sequential),
+              tc::img::warp_perspective(image, width, height, 3, homography, 50, 40));
+}
+
+// Test perspective warp against a floating point reference
+TEST_F(image_warp_test, perspective_matches_floating_point_reference)
+{
+    const int width = 300, height = 200;
+    auto image = createGradientImage(width, height, 3);
+    const std::array<double, 9> homography = {1.1, 0.2, -15.0, 0.05, 0.95, 10.0, 0.0004, -0.0006, 1.0};
+    auto warped = tc::img::warp_perspective(image, width, height, 3, homography, width, height);
+    ASSERT_EQ(warped.size(), image.size());
+
+    // Inverse homography through the adjugate matrix
+    const auto& m = homography;
+    const std::array<double, 9> inv = {
+        m[4] * m[8] - m[5] * m[7], m[2] * m[7] - m[1] * m[8], m[1] * m[5] - m[2] * m[4],
+        m[5] * m[6] - m[3] * m[8], m[0] * m[8] - m[2] * m[6], m[2] * m[3] - m[0] * m[5],
+        m[3] * m[7] - m[4] * m[6], m[1] * m[6] - m[0] * m[7], m[0] * m[4] - m[1] * m[3]};
+
+    int mismatches = 0;
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            const double w = inv[6] * x + inv[7] * y + inv[8];
+            const double sx = (inv[0] * x + inv[1] * y + inv[2]) / w;
+            const double sy = (inv[3] * x + inv[4] * y + inv[5]) / w;
+            const int x0 = static_cast<int>(std::floor(sx)), y0 = static_cast<int>(std::floor(sy));
+            if (x0 < 0 || y0 < 0 || x0 + 1 >= width || y0 + 1 >= height)
+                continue;
+
+            const double fx = sx - x0, fy = sy - y0;
+            for (int c = 0; c < 3; ++c)
+            {
+                const auto at = [&](int xx, int yy) { return static_cast<double>(image[(yy * width + xx) * 3 + c]); };
+                const double expected = (at(x0, y0) * (1 - fx) + at(x0 + 1, y0) * fx) * (1 - fy) + (at(x0, y0 + 1) * (1 - fx) + at(x0 + 1, y0 + 1) * fx) * fy;
+                const double diff = std::abs(expected - warped[(y * width + x) * 3 + c]);
+                if (diff > 3.0)
+                    ++mismatches;
+            }
+        }
+    }
+    EXPECT_LT(mismatches, width * height * 3 / 50);
+}
+
+// Test perspective warp with points mapped to infinity and a singular matrix
+TEST_F(image_warp_test, perspective_degenerate_cases)
+{
+    auto image = createGradientImage(16, 16, 1);
+
+    // Output pixels on the line x = 8 map to infinity and fall back to the border value
+    const std::array<double, 9> vanishing = {1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.125, 0.0, -1.0};
+    auto warped = tc::img::warp_perspective(image, 16, 16, 1, vanishing, 16, 16, tc::img::interpolation::nearest, tc::img::border_mode::constant, {77});
+    ASSERT_EQ(warped.size(), image.size());
+    for (int y = 0; y < 16; ++y)
+        EXPECT_EQ(warped[y * 16 + 8], 77);
+
+    const std::array<double, 9> singular = {1.0, 2.0, 0.0, 2.0, 4.0, 0.0, 0.0, 0.0, 1.0};
+    EXPECT_THROW(tc::img::make_perspective_remap_plan(singular, 4, 4), std::runtime_error);
+    EXPECT_THROW(tc::img::warp_perspective(image, 16, 16, 1, singular, 4, 4), std::runtime_error);
+
+    const std::array<double, 9> identity3 = {1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
+    auto plan = tc::img::make_perspective_remap_plan(identity3, 4, 4);
+    EXPECT_THROW(tc::img::remap(image, 16, 16, 1, plan, tc::img::border_mode::constant, {1, 2}), std::runtime_error);
+}
+
+}
@@ -0,0 +1,180 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <teiacare/image/image_yuv.hpp>
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace tc::img::tests
+{
+class image_yuv_test : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+    }
+    void TearDown() override
+    {
+    }
+
+    // Random luma and chroma planes, packed both as NV12 and as I420
+    void make_planes(int width, int height, unsigned int seed)
+    {
+        const std::size_t chroma_width = (width + 1) / 2;
+        const std::size_t chroma_height = (height + 1) / 2;
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<int> dist(0, 255);
+
+        y_plane.resize(static_cast<std::size_t>(width) * height);
+        u_plane.resize(chroma_width * chroma_height);
+        v_plane.resize(chroma_width * chroma_height);
+        for (auto& v : y_plane)
+            v = static_cast<std::uint8_t>(dist(rng));
+        for (std::size_t i = 0; i < u_plane.size(); ++i)
+        {
+            u_plane[i] = static_cast<std::uint8_t>(dist(rng));
+            v_plane[i] = static_cast<std::uint8_t>(dist(rng));
+        }
+
+        nv12 = y_plane;
+        i420 = y_plane;
+        for (std::size_t i = 0; i < u_plane.size(); ++i)
+        {
+            nv12.push_back(u_plane[i]);
+            nv12.push_back(v_plane[i]);
+        }
+        i420.insert(i420.end(), u_plane.begin(), u_plane.end());
+        i420.insert(i420.end(), v_plane.begin(), v_plane.end());
+    }
+
+    // Double precision conversion of one pixel
+    static std::vector<double> reference_rgb(int y, int u, int v, tc::img::yuv_matrix matrix, tc::img::yuv_range range)
+    {
+        const double kr = matrix == tc::img::yuv_matrix::bt601 ? 0.299 : 0.2126;
+        const double kb = matrix == tc::img::yuv_matrix::bt601 ? 0.114 : 0.0722;
+        const double kg = 1.0 - kr - kb;
+        const bool limited = range == tc::img::yuv_range::limited;
+        const double yf = limited ? (y - 16) * 255.0 / 219.0 : y;
+        const double uf = (u - 128) * (limited ? 255.0 / 224.0 : 1.0);
+        const double vf = (v - 128) * (limited ? 255.0 / 224.0 : 1.0);
+
+        const double r = yf + 2.0 * (1.0 - kr) * vf;
+        const double g = yf - 2.0 * (1.0 - kb) * kb / kg * uf - 2.0 * (1.0 - kr) * kr / kg * vf;
+        const double b = yf + 2.0 * (1.0 - kb) * uf;
+        return {std::clamp(r, 0.0, 255.0), std::clamp(g, 0.0, 255.0), std::clamp(b, 0.0, 255.0)};
+    }
+
+    std::vector<std::uint8_t> y_plane;
+    std::vector<std::uint8_t> u_plane;
+    std::vector<std::uint8_t> v_plane;
+    std::vector<std::uint8_t> nv12;
+    std::vector<std::uint8_t> i420;
+};
+
+// Test black, white and gray in both ranges
+TEST_F(image_yuv_test, known_colors)
+{
+    // 2x2 NV12 images with one chroma sample
+    const std::vector<std::uint8_t> limited_black = {16, 16, 16, 16, 128, 128};
+    const std::vector<std::uint8_t> limited_white = {235, 235, 235, 235, 128, 128};
+    const std::vector<std::uint8_t> full_gray = {100, 100, 100, 100, 128, 128};
+
+    for (auto v : tc::img::nv12_to_rgb(limited_black, 2, 2))
+        EXPECT_EQ(v, 0);
+    for (auto v : tc::img::nv12_to_rgb(limited_white, 2, 2, tc::img::yuv_matrix::bt709))
+        EXPECT_EQ(v, 255);
+    for (auto v : tc::img::nv12_to_rgb(full_gray, 2, 2, tc::img::yuv_matrix::bt601, tc::img::yuv_range::full))
+        EXPECT_EQ(v, 100);
+}
+
+// Test every matrix and range against a double precision reference
+TEST_F(image_yuv_test, matches_reference)
+{
+    const int width = 67;
+    const int height = 9;
+    make_planes(width, height, 7);
+    const std::size_t chroma_width = (width + 1) / 2;
+
+    for (auto matrix : {tc::img::yuv_matrix::bt601, tc::img::yuv_matrix::bt709})
+    {
+        for (auto range : {tc::img::yuv_range::limited, tc::img::yuv_range::full})
+        {
+            const auto rgb = tc::img::nv12_to_rgb(nv12, width, height, matrix, range);
+            ASSERT_EQ(rgb.size(), static_cast<std::size_t>(width) * height * 3);
+
+            for (int y = 0; y < height; ++y)
+            {
+                for (int x = 0; x < width; ++x)
+                {
+                    const std::size_t c = (y / 2) * chroma_width + x / 2;
+                    const auto expected = reference_rgb(y_plane[y * width + x], u_plane[c], v_plane[c], matrix, range);
+                    for (int ch = 0; ch < 3; ++ch)
+                        EXPECT_NEAR(rgb[(y * width + x) * 3 + ch], expected[ch], 1.0) << "at " << x << "," << y << " channel " << ch;
+                }
+            }
+        }
+    }
+}
+
+// Test NV12 and I420 holding the same planes convert to the same image
+TEST_F(image_yuv_test, nv12_matches_i420)
+{
+    for (auto [width, height] : {std::pair{64, 32}, std::pair{37, 5}, std::pair{1, 1}, std::pair{33, 2}})
+    {
+        make_planes(width, height, 11);
+        std::vector<std::uint8_t> from_nv12;
+        std::vector<std::uint8_t> from_i420;
+        tc::img::nv12_to_rgb(nv12, width, height, from_nv12, tc::img::yuv_matrix::bt709, tc::img::yuv_range::full);
+        tc::img::i420_to_rgb(i420, width, height, from_i420, tc::img::yuv_matrix::bt709, tc::img::yuv_range::full);
+        EXPECT_EQ(from_nv12, from_i420) << width << "x" << height;
+    }
+}
+
+// Test swapRB_channels producing BGR
+TEST_F(image_yuv_test, swap_rb_channels)
+{
+    const int width = 41;
+    const int height = 6;
+    make_planes(width, height, 3);
+
+    const auto rgb = tc::img::i420_to_rgb(i420, width, height);
+    const auto bgr = tc::img::i420_to_rgb(i420, width, height, tc::img::yuv_matrix::bt601, tc::img::yuv_range::limited, true);
+    ASSERT_EQ(rgb.size(), bgr.size());
+    for (std::size_t i = 0; i < rgb.size(); i += 3)
+    {
+        EXPECT_EQ(rgb[i], bgr[i + 2]);
+        EXPECT_EQ(rgb[i + 1], bgr[i + 1]);
+        EXPECT_EQ(rgb[i + 2], bgr[i]);
+    }
+}
+
+// Test data whose size does not match the image size
+TEST_F(image_yuv_test, invalid_size)
+{
+    make_planes(5, 3, 1);
+    EXPECT_EQ(nv12.size(), 5u * 3u + 2u * 3u * 2u);
+    EXPECT_THROW(tc::img::nv12_to_rgb(nv12, 4, 3), std::runtime_error);
+    EXPECT_THROW(tc::img::i420_to_rgb(std::vector<std::uint8_t>(nv12.begin(), nv12.end() - 1), 5, 3), std::runtime_error);
+    EXPECT_NO_THROW(tc::img::i420_to_rgb(i420, 5, 3));
+    EXPECT_TRUE(tc::img::nv12_to_rgb({}, 0, 0).empty());
+}
+
+}
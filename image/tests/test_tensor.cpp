@@ -0,0 +1,135 @@
+// Copyright 2025 TeiaCare
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <teiacare/image/tensor.hpp>
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace tc::img::tests
+{
+class tensor_test : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+    }
+    void TearDown() override
+    {
+    }
+
+    // Helper function to check the alignment of a pointer
+    static bool is_aligned(const void* pointer, std::size_t alignment)
+    {
+        return reinterpret_cast<std::uintptr_t>(pointer) % alignment == 0;
+    }
+};
+
+// Test default constructed tensors
+TEST_F(tensor_test, default_constructed_is_empty)
+{
+    tc::img::tensor<float> t;
+    EXPECT_TRUE(t.empty());
+    EXPECT_EQ(t.size(), 0u);
+    EXPECT_EQ(t.rank(), 0u);
+    EXPECT_EQ(t.data(), nullptr);
+    EXPECT_EQ(t.begin(), t.end());
+}
+
+// Test shape, strides and zero initialization
+TEST_F(tensor_test, shape_and_strides)
+{
+    tc::img::tensor<float> t({2, 3, 4, 5});
+    EXPECT_EQ(t.rank(), 4u);
+    EXPECT_EQ(t.size(), 120u);
+    EXPECT_EQ(t.size_bytes(), 480u);
+    EXPECT_EQ(t.shape(), (std::vector<std::size_t>{2, 3, 4, 5}));
+    EXPECT_EQ(t.strides(), (std::vector<std::size_t>{60, 20, 5, 1}));
+    for (float value : t)
+        EXPECT_EQ(value, 0.0f);
+
+    tc::img::tensor<float> zero_sized({3, 0, 2});
+    EXPECT_TRUE(zero_sized.empty());
+    EXPECT_EQ(zero_sized.data(), nullptr);
+}
+
+// Test buffer alignment, default and custom
+TEST_F(tensor_test, alignment)
+{
+    for (std::size_t n = 1; n < 40; ++n)
+    {
+        EXPECT_TRUE(is_aligned(tc::img::tensor<std::uint8_t>({n}).data(), tc::img::tensor_alignment));
+        EXPECT_TRUE(is_aligned(tc::img::tensor<double>::uninitialized({n, 3}).data(), 64));
+        EXPECT_TRUE(is_aligned((tc::img::tensor<float, 256>({n}).data()), 256));
+    }
+}
+
+// Test element access and conversion to span
+TEST_F(tensor_test, element_access)
+{
+    auto t = tc::img::tensor<int>::uninitialized({2, 3});
+    std::iota(t.begin(), t.end(), 10);
+    EXPECT_EQ(t[0], 10);
+    EXPECT_EQ(t[5], 15);
+
+    const std::span<const int> view = std::as_const(t);
+    EXPECT_EQ(view.size(), 6u);
+    EXPECT_EQ(view.data(), t.data());
+    EXPECT_EQ(std::vector<int>(t.begin(), t.end()), (std::vector<int>{10, 11, 12, 13, 14, 15}));
+}
+
+// Test move construction and assignment transfer ownership
+TEST_F(tensor_test, move_transfers_ownership)
+{
+    tc::img::tensor<float> a({4, 4});
+    a[3] = 7.0f;
+    const float* data = a.data();
+
+    tc::img::tensor<float> b(std::move(a));
+    EXPECT_EQ(b.data(), data);
+    EXPECT_EQ(b[3], 7.0f);
+    EXPECT_EQ(b.shape(), (std::vector<std::size_t>{4, 4}));
+    EXPECT_TRUE(a.empty());
+    EXPECT_EQ(a.data(), nullptr);
+    EXPECT_TRUE(a.shape().empty());
+
+    tc::img::tensor<float> c({2});
+    c = std::move(b);
+    EXPECT_EQ(c.data(), data);
+    EXPECT_EQ(c.size(), 16u);
+    EXPECT_TRUE(b.empty());
+
+    static_assert(!std::is_copy_constructible_v<tc::img::tensor<float>>);
+    static_assert(!std::is_copy_assignable_v<tc::img::tensor<float>>);
+    static_assert(std::is_nothrow_move_constructible_v<tc::img::tensor<float>>);
+}
+
+// Test equality compares shapes and elements
+TEST_F(tensor_test, equality)
+{
+    tc::img::tensor<int> a({2, 3});
+    tc::img::tensor<int> b({2, 3});
+    tc::img::tensor<int> c({3, 2});
+    EXPECT_EQ(a, b);
+    EXPECT_NE(a, c);
+
+    b[4] = 1;
+    EXPECT_NE(a, b);
+}
+
+}